@@ -1,9 +1,21 @@
 #ifndef KANBAN_LITE_ACTIVITY_LOG_H
 #define KANBAN_LITE_ACTIVITY_LOG_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <chrono>
+#include <fstream>
+#include "Compression.h"
 #include "external/json.hpp"
 
 /**
@@ -13,11 +25,90 @@
  * @date 25/09/2025
  */
 
+/**
+ * @enum ActivityType
+ * @brief Tipos de evento estruturado registrados pelo Board.
+ */
+enum class ActivityType : std::uint8_t {
+    Custom,          /**< @brief Texto livre (record(std::string)) */
+    ColumnAdded,     /**< @brief Coluna adicionada ao board */
+    ColumnRemoved,   /**< @brief Coluna removida do board */
+    CardAdded,       /**< @brief Card adicionado a uma coluna */
+    CardRemoved,     /**< @brief Card removido de uma coluna */
+    CardMoved,       /**< @brief Card movido entre colunas */
+    CardReordered,   /**< @brief Card reposicionado na mesma coluna */
+    BatchApplied,    /**< @brief Lote aplicado (contadores em counts) */
+    CardUpdated,     /**< @brief Campos do card alterados (diff no payload) */
+    BoardCheckpoint, /**< @brief Estado completo do board (snapshot no payload) */
+    ColumnMoved,     /**< @brief Coluna movida para outra posição (posição no payload) */
+    ColumnWipChanged /**< @brief Limite WIP da coluna alterado (limite no payload) */
+};
+
+class BoardSnapshot;
+class Card;
+class Column;
+
+/**
+ * @struct ActivityCardChange
+ * @brief Campos alterados de um card (CardUpdated), sem DOM JSON.
+ */
+struct ActivityCardChange {
+    std::optional<std::string> title;                  /**< @brief Novo título */
+    std::optional<std::string> description;            /**< @brief Nova descrição */
+    std::optional<int> priority;                       /**< @brief Nova prioridade */
+    std::string tag;                                   /**< @brief Tag adicionada/removida (vazia = nenhuma) */
+    bool tagAdded { false };                           /**< @brief true = addTags, false = removeTags */
+};
+
+/**
+ * @struct ActivityDetail
+ * @brief Dados de replay tipados, convertidos no "payload" JSON só na leitura.
+ * 
+ * O caminho de gravação guarda posições e ponteiros compartilhados, sem
+ * montar DOM JSON; eventToJson() produz o mesmo payload de antes
+ * (card/coluna completos, posição final, board inteiro no checkpoint,
+ * campos alterados do card, limite WIP).
+ */
+struct ActivityDetail {
+    std::uint64_t position { 0 };                      /**< @brief Posição final (se hasPosition) */
+    bool hasPosition { false };                        /**< @brief position faz parte do payload */
+    std::shared_ptr<const Card> card;                  /**< @brief Card completo (CardAdded) */
+    std::shared_ptr<const Column> column;              /**< @brief Coluna completa (ColumnAdded) */
+    std::shared_ptr<const BoardSnapshot> board;        /**< @brief Board inteiro (BoardCheckpoint) */
+    std::shared_ptr<const ActivityCardChange> change;  /**< @brief Campos alterados (CardUpdated) */
+    int wipLimit { 0 };                                /**< @brief Novo limite (se hasWipLimit) */
+    bool hasWipLimit { false };                        /**< @brief wipLimit faz parte do payload (ColumnWipChanged) */
+};
+
+/**
+ * @struct ActivityEvent
+ * @brief Evento estruturado como fica guardado no log.
+ * 
+ * Nomes de board, coluna e card são IDs internados pelo próprio
+ * ActivityLog (0 = ausente); o texto legível só é montado na leitura
+ * (all(), page(), toJson()). A tabela de nomes conta referências: fica
+ * limitada aos nomes dos eventos em memória, e um ID liberado pode ser
+ * reaproveitado por outro nome.
+ */
+struct ActivityEvent {
+    std::chrono::system_clock::time_point timestamp;  /**< @brief Momento exato do evento */
+    std::uint64_t sequence { 0 };                      /**< @brief Posição na ordem total do log (1, 2, ...) */
+    ActivityType type { ActivityType::Custom };        /**< @brief Tipo do evento */
+    std::uint32_t board { 0 };                         /**< @brief Board (ID internado) */
+    std::uint32_t column { 0 };                        /**< @brief Coluna (origem em CardMoved) */
+    std::uint32_t card { 0 };                          /**< @brief Card envolvido */
+    std::uint32_t target { 0 };                        /**< @brief Coluna destino (CardMoved) */
+    std::array<std::uint32_t, 3> counts {};            /**< @brief Contadores (BatchApplied) */
+    std::string text;                                  /**< @brief Texto livre (somente Custom) */
+    nlohmann::json payload;                            /**< @brief Dados para replay em JSON (lidos do disco, diffs) */
+    ActivityDetail detail;                             /**< @brief Dados para replay tipados (gravação) */
+};
+
 /**
  * @struct ActivityEntry
  * @brief Representa uma entrada individual no log de atividades.
  * 
- * Estrutura simples que armazena um evento com timestamp preciso.
+ * Visão formatada (timestamp + mensagem) de um ActivityEvent.
  * Utiliza std::chrono para garantir precisão temporal e permitir
  * operações matemáticas com datas.
  */
@@ -32,13 +123,22 @@ struct ActivityEntry {
  * 
  * Responsável por registrar e armazenar eventos do sistema para fins de
  * auditoria, debug e rastreabilidade. Implementa padrão de logging simples
- * com timestamps automáticos e armazenamento em memória.
+ * com timestamps automáticos.
+ * 
+ * Apenas as N entradas mais recentes ficam em memória (buffer circular).
+ * Com um diretório de spill anexado, as entradas mais antigas são gravadas
+ * em segmentos append-only ("segment-NNNNNN.jsonl") e um índice temporal
+ * ("index.jsonl") registra início, fim e tamanho de cada segmento selado.
+ * Memória e tempo de save ficam constantes; page() continua percorrendo a
+ * trilha completa.
  * 
  * @details
  * - Responsabilidade única: logging e auditoria de eventos
- * - Thread-safety: não implementada (monothreaded na Etapa 1)
- * - Persistência: planejada para etapas futuras
- * - Armazenamento: em memória (std::vector)
+ * - Thread-safety: opcional, via startConcurrent() (fila MPSC sem locks)
+ * - Persistência: toJson() serializa apenas o buffer em memória e a marca "spilledThrough"
+ * - Armazenamento: buffer circular + segmentos em disco (opcional)
+ * - Sem diretório de spill, entradas que saem do buffer são descartadas
+ * - Eventos estruturados: mensagens só são formatadas na leitura
  * 
  * Conceitos POO aplicados:
  * - Encapsulamento: dados privados com interface controlada
@@ -47,6 +147,118 @@ struct ActivityEntry {
  */
 class ActivityLog {
 public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    /**
+     * @class Range
+     * @brief Visão (sem cópia) de um trecho contíguo do buffer em memória.
+     * 
+     * Itera ActivityEvent da mais antiga para a mais nova. A visão é
+     * invalidada pela próxima gravação no log (record(), load()...).
+     */
+    class Range {
+    public:
+        /**
+         * @class const_iterator
+         * @brief Iterador sobre posições lógicas do buffer circular.
+         */
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = ActivityEvent;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const ActivityEvent*;
+            using reference = const ActivityEvent&;
+
+            const_iterator(const ActivityLog* log, size_t index);
+            reference operator*() const;
+            pointer operator->() const;
+            const_iterator& operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator& other) const;
+            bool operator!=(const const_iterator& other) const;
+
+        private:
+            const ActivityLog* m_log;              /**< @brief Log percorrido */
+            size_t m_index;                        /**< @brief Posição lógica (0 = mais antiga em memória) */
+        };
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        size_t size() const;
+        bool empty() const;
+
+        /**
+         * @brief Evento na posição i da visão.
+         * @pre i < size()
+         */
+        const ActivityEvent& operator[](size_t i) const;
+
+    private:
+        friend class ActivityLog;
+        Range(const ActivityLog* log, size_t first, size_t last);
+
+        const ActivityLog* m_log;                  /**< @brief Log de origem */
+        size_t m_first;                            /**< @brief Primeira posição lógica */
+        size_t m_last;                             /**< @brief Posição lógica após a última */
+    };
+
+    /** @brief Entradas mantidas em memória por padrão. */
+    static constexpr size_t DEFAULT_CAPACITY = 1000;
+
+    /** @brief Entradas por segmento em disco por padrão. */
+    static constexpr size_t DEFAULT_SEGMENT_ENTRIES = 4096;
+
+    /**
+     * @brief Construtor.
+     * @param capacity Máximo de entradas em memória (mínimo 1)
+     * @param segmentEntries Entradas por segmento antes de selá-lo (mínimo 1)
+     */
+    explicit ActivityLog(size_t capacity = DEFAULT_CAPACITY,
+                         size_t segmentEntries = DEFAULT_SEGMENT_ENTRIES);
+
+    /**
+     * @brief Destrutor. Encerra o modo concorrente, se ativo.
+     */
+    ~ActivityLog();
+
+    /** @pre Nenhum dos dois logs em modo concorrente */
+    ActivityLog(ActivityLog&& other) noexcept;
+    ActivityLog& operator=(ActivityLog&& other) noexcept;
+
+    /**
+     * @brief Ativa o modo concorrente: várias threads podem chamar record().
+     * 
+     * Cada record() enfileira o evento em uma fila MPSC sem locks (um
+     * exchange atômico por evento); produtores nunca esperam uns pelos
+     * outros. Uma thread consumidora drena a fila, atribui o número de
+     * sequência global e grava no buffer, definindo a ordem total do log.
+     * 
+     * @post Leituras que copiam (all(), page(), toJson()...), format() e
+     *       name() sincronizam com o consumidor; visões (events(), last(),
+     *       between()) exigem drain() sem produtores ativos
+     * @post Uma exceção ao gravar não encerra o consumidor: fica guardada e
+     *       é relançada por flush()
+     * @note O timestamp é o do produtor, ajustado para nunca recuar na ordem final
+     */
+    void startConcurrent();
+
+    /**
+     * @brief Drena a fila e volta ao modo monothread.
+     * @pre Nenhuma thread ainda chamando record()
+     */
+    void stopConcurrent();
+
+    /**
+     * @brief Indica se o modo concorrente está ativo.
+     */
+    bool isConcurrent() const;
+
+    /**
+     * @brief Aguarda até que tudo o que foi enfileirado antes da chamada esteja no buffer.
+     */
+    void drain();
+
     /**
      * @brief Registra um novo evento no log com timestamp automático.
      * 
@@ -56,7 +268,7 @@ public:
      * 
      * @param event Descrição do evento a ser registrado
      * @pre event não deve ser vazio (recomendação)
-     * @post Nova entrada adicionada ao final do vetor de entries
+     * @post Nova entrada adicionada ao buffer (a mais antiga sai se cheio)
      * @post Timestamp definido como momento atual da chamada
      * 
      * @note Thread-safety não garantida na versão atual
@@ -64,24 +276,222 @@ public:
     void record(const std::string& event);
 
     /**
-     * @brief Retorna cópia de todas as entradas do log.
+     * @brief Registra evento estruturado sem montar mensagem.
+     * 
+     * Os nomes são internados (busca em hash; só alocam na primeira vez
+     * que aparecem) e o evento é escrito direto no slot do buffer.
+     * 
+     * @param type Tipo do evento
+     * @param board Nome do board
+     * @param column Coluna (origem em CardMoved)
+     * @param card ID do card ("" se não se aplica)
+     * @param target Coluna destino ("" se não se aplica)
+     * @param payload Dados necessários ao replay (ver BoardReplay)
+     * @note Um nome sai da tabela quando o último evento que o usa sai do buffer
+     */
+    void record(ActivityType type, const std::string& board, const std::string& column,
+                const std::string& card = std::string(), const std::string& target = std::string(),
+                const nlohmann::json& payload = nlohmann::json());
+
+    /**
+     * @brief Registra evento estruturado com dados de replay tipados.
+     * 
+     * Variante sem DOM JSON para o caminho das mutações: o payload só é
+     * montado quando o evento é serializado.
+     * 
+     * @param type Tipo do evento
+     * @param board Nome do board
+     * @param column Coluna (origem em CardMoved)
+     * @param card ID do card ("" se não se aplica)
+     * @param target Coluna destino ("" se não se aplica)
+     * @param detail Posição e estado compartilhado (card, coluna ou board)
+     */
+    void record(ActivityType type, const std::string& board, const std::string& column,
+                const std::string& card, const std::string& target, ActivityDetail detail);
+
+    /**
+     * @brief Registra aplicação de lote com seus contadores.
+     * @param board Nome do board
+     * @param added Cards adicionados
+     * @param moved Cards movidos
+     * @param tagChanges Alterações de tag
+     * @param operations Operações do lote (payload para replay; movido para o slot, sem cópia)
+     */
+    void recordBatch(const std::string& board, std::uint32_t added, std::uint32_t moved,
+                     std::uint32_t tagChanges, nlohmann::json operations = nlohmann::json());
+
+    /**
+     * @brief Monta a mensagem legível de um evento.
+     * @param event Evento (IDs internados por este log)
+     * @return Texto no mesmo formato das mensagens históricas
+     */
+    std::string format(const ActivityEvent& event) const;
+
+    /**
+     * @brief Nome correspondente a um ID internado.
+     * @param id ID retornado em ActivityEvent
+     * @return Cópia do nome ("" para 0 ou ID desconhecido)
+     */
+    std::string name(std::uint32_t id) const;
+
+    /**
+     * @brief Dados de replay do evento em JSON (mesmo formato salvo em toJson()).
+     * @param event Evento deste log
+     * @return Payload ou null se o evento não tem
+     */
+    nlohmann::json payload(const ActivityEvent& event) const;
+
+    /**
+     * @brief Nome persistido de um tipo ("card_moved"...).
+     */
+    static const char* typeName(ActivityType type);
+
+    /**
+     * @brief Retorna cópia das entradas em memória.
      * 
-     * Fornece acesso completo ao histórico de eventos registrados.
-     * Retorna cópia para evitar modificações acidentais e garantir
-     * thread-safety básica.
+     * Fornece acesso às entradas mais recentes (até capacity()), da mais
+     * antiga para a mais nova. Entradas já gravadas em disco são acessadas
+     * via page().
      * 
-     * @return std::vector<ActivityEntry> Cópia completa do histórico
+     * @return std::vector<ActivityEntry> Cópia das entradas em memória
      * @post Estado do objeto não é alterado (método const)
      * 
-     * @note Retorna cópia (não referência) para simplicidade na Etapa 1
-     * @note Para listas grandes, considerar iteradores ou paginação em versões futuras
+     * @note Formata e copia tudo; para apenas percorrer, use events()
      */
     std::vector<ActivityEntry> all() const;
 
+    /**
+     * @brief Eventos em memória, sem cópia.
+     * @return Visão da mais antiga para a mais nova
+     */
+    Range events() const;
+    Range::const_iterator begin() const;
+    Range::const_iterator end() const;
+
+    /**
+     * @brief Os n eventos mais recentes em memória. O(1).
+     * @param n Quantidade desejada (limitada a size())
+     * @return Visão dos últimos min(n, size()) eventos
+     */
+    Range last(size_t n) const;
+
+    /**
+     * @brief Eventos em memória com from <= timestamp <= to.
+     * 
+     * Timestamps são monotônicos, então os limites são achados por busca
+     * binária: O(log size()) + O(resultado) para percorrer.
+     * 
+     * @param from Início do intervalo (inclusivo)
+     * @param to Fim do intervalo (inclusivo)
+     * @return Visão dos eventos no intervalo
+     */
+    Range between(TimePoint from, TimePoint to) const;
+
+    /**
+     * @brief Posição, na trilha completa, do primeiro evento com timestamp >= t.
+     * 
+     * Busca binária no índice de segmentos; lê no máximo um arquivo de
+     * segmento. Combinado com page(), dá acesso a partir de t mesmo quando
+     * o intervalo começa em disco.
+     * 
+     * @param t Instante procurado
+     * @return Posição (0 = mais antiga), ou totalSize() se nenhum
+     */
+    size_t lowerBound(TimePoint t) const;
+
+    /**
+     * @brief Anexa diretório onde entradas antigas são gravadas.
+     * 
+     * Cria o diretório se necessário. Um log ainda vazio retoma os segmentos
+     * já existentes (o índice e o segmento ativo são lidos, os demais não);
+     * um log com entradas leva sua própria trilha para o diretório (save com
+     * outro nome), substituindo a que estivesse lá.
+     * 
+     * A trilha é de uma sessão por vez: o diretório é arrendado com flock
+     * exclusivo em "lease" (como "<arquivo>.ids") enquanto o log estiver
+     * anexado. Se outra sessão detém o lease, o log se desanexa (entradas
+     * antigas deixam de ir para o disco e toJson() omite "spilledThrough"),
+     * para não gravar sequências próprias nem truncar as da outra sessão.
+     * 
+     * @param directory Caminho do diretório de spill
+     * @return false se o diretório está arrendado por outra sessão
+     * @throws std::runtime_error se o diretório não puder ser criado
+     */
+    bool attachSpillDirectory(const std::string& directory);
+
+    /**
+     * @brief Codec dos segmentos selados daqui em diante.
+     * 
+     * O segmento ativo continua em texto (append); depois de selado é
+     * regravado no codec pelo próximo flush(). A leitura detecta o codec de cada arquivo, então segmentos
+     * antigos em texto continuam legíveis.
+     * 
+     * @param codec Codec (None = sem compressão)
+     * @throws std::runtime_error se o codec não foi compilado
+     */
+    void setSegmentCodec(Compression::Codec codec);
+
+    /**
+     * @brief Retorna uma página da trilha completa (disco + memória).
+     * 
+     * Usa a contagem de cada segmento para abrir somente os arquivos
+     * que contêm a página pedida.
+     * 
+     * @param offset Posição da primeira entrada (0 = mais antiga)
+     * @param count Quantidade máxima de entradas
+     * @return Entradas em ordem cronológica
+     */
+    std::vector<ActivityEntry> page(size_t offset, size_t count) const;
+
+    /**
+     * @brief Como page(), mas com os eventos completos (campos e payload).
+     * @param offset Posição do primeiro evento (0 = mais antigo)
+     * @param count Quantidade máxima de eventos
+     * @return Eventos no formato de toJson(), em ordem cronológica
+     */
+    std::vector<nlohmann::json> records(size_t offset, size_t count) const;
+
+    /**
+     * @brief Eventos do board desde seu último checkpoint em memória.
+     * @param board Nome do board
+     * @return Quantidade, ou size_t(-1) se não há checkpoint em memória
+     */
+    size_t eventsSinceCheckpoint(const std::string& board) const;
+
+    /**
+     * @brief Garante que o segmento ativo foi gravado em disco.
+     * 
+     * Também comprime, no codec atual, os segmentos selados desde o último
+     * flush(): o spill só fecha o arquivo, sem recompressão no caminho de
+     * record(). Chamado no save.
+     * 
+     * @throws std::runtime_error se a compressão falhar
+     * @throws A primeira falha de gravação (spill ou consumidor) desde o último flush()
+     */
+    void flush();
+
+    /**
+     * @brief Quantidade de entradas em memória.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Quantidade total de entradas (disco + memória).
+     */
+    size_t totalSize() const;
+
+    /**
+     * @brief Máximo de entradas em memória.
+     */
+    size_t capacity() const;
+
     /**
      * @brief Serializa o log de atividades para JSON.
      * 
-     * Converte todas as entradas do log para formato JSON.
+     * Converte as entradas em memória para formato JSON; o custo
+     * independe do tamanho da trilha gravada em disco. Só o checkpoint mais
+     * recente de cada board leva o board no payload: os anteriores ficam
+     * como marcadores (a trilha em disco guarda todos completos).
      * 
      * @return Objeto JSON com array de entradas
      */
@@ -98,8 +508,162 @@ public:
      */
     static ActivityLog fromJson(const nlohmann::json& j);
 
+    /**
+     * @brief Acrescenta as entradas de um JSON (formato de toJson()) ao log.
+     * 
+     * Diferente de fromJson(), preserva capacidade e diretório de spill já
+     * configurados: entradas além da capacidade vão para o disco. Entradas
+     * em disco posteriores ao "spilledThrough" do JSON (gravadas por sessões
+     * encerradas sem salvar) são descartadas antes.
+     * 
+     * @param j Objeto JSON com dados do log
+     * @throws json::exception se estrutura inválida
+     */
+    void load(const nlohmann::json& j);
+
 private:
-    std::vector<ActivityEntry> m_entries;         /**< @brief Container com histórico completo de eventos */
+    struct Concurrent;
+    struct SpillLease;
+
+    /**
+     * @struct Segment
+     * @brief Metadados de um segmento em disco (entrada do índice temporal).
+     */
+    struct Segment {
+        std::string file;                                  /**< @brief Nome do arquivo no diretório */
+        std::chrono::system_clock::time_point first;       /**< @brief Timestamp da primeira entrada */
+        std::chrono::system_clock::time_point last;        /**< @brief Timestamp da última entrada */
+        size_t count { 0 };                                /**< @brief Entradas no segmento */
+        std::uint64_t lastSequence { 0 };                  /**< @brief Sequência da última entrada (0 = desconhecida) */
+        bool sealed { false };                             /**< @brief Segmento completo (no índice) */
+        bool compressPending { false };                    /**< @brief Selado nesta execução, ainda em texto */
+    };
+
+    /**
+     * @brief Entrega o evento: enfileira (modo concorrente) ou grava direto.
+     */
+    void submit(ActivityType type, const std::string& board, const std::string& column,
+                const std::string& card, const std::string& target,
+                const std::array<std::uint32_t, 3>& counts, const std::string& text,
+                nlohmann::json payload, ActivityDetail detail);
+
+    /**
+     * @brief Grava evento no buffer, atribuindo sequência e internando nomes.
+     */
+    void write(TimePoint timestamp, ActivityType type, const std::string& board,
+               const std::string& column, const std::string& card, const std::string& target,
+               const std::array<std::uint32_t, 3>& counts, const std::string& text,
+               nlohmann::json payload, ActivityDetail detail);
+
+    /**
+     * @brief Laço da thread consumidora do modo concorrente.
+     */
+    void consume();
+
+    /**
+     * @brief Trava o consumidor durante leituras (lock vazio fora do modo concorrente).
+     */
+    std::unique_lock<std::mutex> readLock() const;
+
+    /**
+     * @brief Trava a tabela de nomes (lock vazio fora do modo concorrente).
+     */
+    std::unique_lock<std::mutex> namesLock() const;
+
+    /**
+     * @brief Libera o próximo slot do buffer (enviando o mais antigo ao disco se cheio).
+     * @param timestamp Momento do novo evento
+     * @return Slot a preencher
+     */
+    ActivityEvent& nextSlot(std::chrono::system_clock::time_point timestamp);
+
+    /**
+     * @brief Grava evento no segmento ativo; falhas ficam para o flush().
+     */
+    void spill(const ActivityEvent& event) noexcept;
+
+    /**
+     * @brief Grava evento no segmento ativo (abrindo/selando conforme necessário).
+     */
+    void spillEvent(const ActivityEvent& event);
+
+    /**
+     * @brief Descarta da trilha em disco as entradas com sequência > through.
+     * @param through Última sequência gravada pelo workspace salvo
+     */
+    void truncateSpilled(std::uint64_t through);
+
+    /**
+     * @brief Passa a trilha atual para o diretório recém-anexado.
+     * @param previous Diretório anterior ("" = trilha ainda vazia)
+     */
+    void adoptSpilled(const std::string& previous);
+
+    /**
+     * @brief Regrava o índice temporal com os segmentos selados.
+     */
+    void writeIndex() const;
+
+    /**
+     * @brief Fecha o segmento ativo, solta o lease e esquece a trilha em disco.
+     */
+    void detachSpill();
+
+    /**
+     * @brief ID internado do nome (cria se ainda não existe) e conta uma referência.
+     */
+    std::uint32_t intern(const std::string& value);
+
+    /**
+     * @brief Solta uma referência; o ID volta a ficar livre com a última.
+     */
+    void release(std::uint32_t id);
+
+    /**
+     * @brief Serializa evento (mensagem formatada + campos estruturados).
+     */
+    nlohmann::json eventToJson(const ActivityEvent& event, bool withPayload = true) const;
+
+    /**
+     * @brief Reconstrói evento a partir de eventToJson() ou do formato antigo.
+     */
+    void appendJson(const nlohmann::json& j);
+
+    /**
+     * @brief Percorre entradas em disco de [offset, offset + count) em ordem.
+     * @return Quantidade de entradas visitadas
+     */
+    size_t visitSpilled(size_t offset, size_t count,
+                        const std::function<void(const nlohmann::json&)>& visit) const;
+
+    /**
+     * @brief Evento na posição lógica i do buffer (0 = mais antigo).
+     */
+    const ActivityEvent& at(size_t i) const;
+
+    /**
+     * @brief Posição lógica do primeiro evento em memória com timestamp >= t.
+     */
+    size_t ringLowerBound(TimePoint t) const;
+
+    std::vector<ActivityEvent> m_entries;         /**< @brief Buffer circular com os eventos mais recentes */
+    std::vector<std::string> m_names;             /**< @brief Tabela de nomes internados (0 = "") */
+    std::unordered_map<std::string, std::uint32_t> m_nameIds; /**< @brief Nome → ID internado */
+    std::vector<std::uint32_t> m_nameRefs;        /**< @brief Eventos em memória que usam cada ID */
+    std::vector<std::uint32_t> m_freeNames;       /**< @brief IDs livres para reaproveitar */
+    size_t m_head { 0 };                          /**< @brief Posição da entrada mais antiga em m_entries */
+    size_t m_size { 0 };                          /**< @brief Entradas válidas em m_entries */
+    size_t m_segmentEntries;                      /**< @brief Entradas por segmento */
+    std::string m_spillDirectory;                 /**< @brief Diretório de spill ("" = descarta) */
+    std::unique_ptr<SpillLease> m_spillLease;     /**< @brief flock do diretório (nullptr = sem lease) */
+    std::vector<Segment> m_segments;              /**< @brief Índice temporal dos segmentos (ordem cronológica) */
+    size_t m_spilledCount { 0 };                  /**< @brief Total de entradas em disco */
+    std::uint64_t m_spilledThrough { 0 };         /**< @brief Sequência da última entrada em disco */
+    mutable std::ofstream m_segmentStream;        /**< @brief Segmento ativo aberto em modo append */
+    Compression::Codec m_segmentCodec { Compression::Codec::None }; /**< @brief Codec ao selar segmento */
+    std::uint64_t m_nextSequence { 1 };           /**< @brief Próximo número de sequência */
+    std::unique_ptr<Concurrent> m_concurrent;     /**< @brief Fila e consumidor (nullptr = monothread) */
+    std::exception_ptr m_error;                   /**< @brief Primeira falha de gravação ainda não relançada */
 };
 
 #endif // KANBAN_LITE_ACTIVITY_LOG_H
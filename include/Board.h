@@ -1,16 +1,22 @@
 #ifndef KANBAN_LITE_BOARD_H
 #define KANBAN_LITE_BOARD_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <unordered_set>
 #include <memory>
+#include <optional>
+#include <unordered_map>
 #include "external/json.hpp"
 
 // Forward declarations
 class Column;
 class Card;
 class ActivityLog;
+class FlowMetrics;
 class User;
+class BoardBatch;
 
 /**
  * @file Board.h
@@ -35,9 +41,13 @@ class User;
  * - Baixo acoplamento: interage com Column através de interface pública
  * - Composição: Board possui e gerencia o ciclo de vida das Columns
  * - Dependency Injection: ActivityLog injetado externamente
+ * - Índice por nome: busca de coluna em O(1) via hash nome → posição
  */
 class Board {
 public:
+    /** @brief Posição especial para addColumn()/addCard()/moveCard(): final do container. */
+    static constexpr size_t END_POSITION = static_cast<size_t>(-1);
+
     /**
      * @brief Construtor da classe Board.
      * 
@@ -59,11 +69,12 @@ public:
      * A coluna é copiada para o container interno (composição).
      * 
      * @param column Coluna a ser adicionada
+     * @param position Índice da nova coluna (END_POSITION = final)
      * @return true se adicionada com sucesso, false se nome já existe
-     * @post Se sucesso, coluna adicionada ao final do vetor de colunas
-     * @todo Implementar verificação de unicidade de nome
+     * @post Se sucesso, coluna adicionada na posição pedida (padrão: final)
+     * @note Unicidade verificada em O(1) pelo índice de nomes
      */
-    bool addColumn(const Column& column);
+    bool addColumn(const Column& column, size_t position = END_POSITION);
 
     /**
      * @brief Remove coluna do board pelo nome.
@@ -73,10 +84,29 @@ public:
      * 
      * @param name Nome da coluna a ser removida
      * @return true se removida com sucesso, false se não encontrada
-     * @todo Implementar validação de existência antes da remoção
+     * @post Posições das colunas seguintes são reajustadas no índice
      */
     bool removeColumn(const std::string& name);
 
+    /**
+     * @brief Move coluna para outra posição, com os seus cards.
+     * 
+     * @param name Nome da coluna
+     * @param position Novo índice (END_POSITION = final)
+     * @return true se movida, false se não encontrada
+     */
+    bool moveColumn(const std::string& name, size_t position);
+
+    /**
+     * @brief Altera o limite WIP de uma coluna.
+     * 
+     * @param name Nome da coluna
+     * @param wipLimit Novo limite (-1 = sem limite)
+     * @return true se alterado (ou já igual), false se a coluna não existe
+     * @note Não retira cards (ver Column::setWipLimit)
+     */
+    bool setColumnWipLimit(const std::string& name, int wipLimit);
+
     /**
      * @brief Busca coluna pelo nome (versão não-const).
      * 
@@ -85,6 +115,7 @@ public:
      * @param name Nome da coluna procurada
      * @return Ponteiro para a coluna encontrada ou nullptr se não existir
      * @note Permite modificação da coluna retornada
+     * @note Complexidade O(1) média (índice hash)
      */
     Column* findColumn(const std::string& name);
 
@@ -96,6 +127,7 @@ public:
      * @param name Nome da coluna procurada
      * @return Ponteiro const para a coluna encontrada ou nullptr se não existir
      * @note Acesso somente leitura à coluna retornada
+     * @note Complexidade O(1) média (índice hash)
      */
     const Column* findColumn(const std::string& name) const;
 
@@ -107,10 +139,100 @@ public:
      * 
      * @param columnName Nome da coluna de destino
      * @param card Card a ser adicionado
+     * @param position Índice do card na coluna (END_POSITION = fim)
      * @return true se adicionado com sucesso, false se coluna não existe
-     * @todo Implementar delegação para Column::addCard()
      */
-    bool addCard(const std::string& columnName, const Card& card);
+    bool addCard(const std::string& columnName, const Card& card, size_t position = END_POSITION);
+
+    /**
+     * @brief Adiciona card na posição definida pela sua chave (Card::getRank).
+     * 
+     * Usado ao aplicar estados gravados: o card mantém chave e versão.
+     * 
+     * @param columnName Nome da coluna de destino
+     * @param card Card a ser adicionado
+     * @return true se adicionado, false se coluna não existe ou está cheia
+     */
+    bool addCardByRank(const std::string& columnName, const Card& card);
+
+    /**
+     * @brief Remove card de uma coluna específica.
+     * 
+     * @param columnName Nome da coluna que contém o card
+     * @param cardId Identificador do card
+     * @return true se removido, false se coluna ou card não existem
+     */
+    bool removeCard(const std::string& columnName, const std::string& cardId);
+
+    /**
+     * @brief Retira do board os cards da coluna cujos IDs estão no conjunto.
+     * 
+     * Passada única sobre a coluna (Column::extractCards); cada card retirado
+     * é registrado como CardRemoved, então o replay continua correto.
+     * 
+     * @param columnName Coluna de origem
+     * @param ids IDs a retirar
+     * @param extracted Recebe os cards retirados, na ordem da coluna
+     * @return Quantidade retirada (0 se a coluna não existe)
+     */
+    size_t extractCards(const std::string& columnName, const std::unordered_set<std::string>& ids,
+                        std::vector<Card>& extracted);
+
+    /**
+     * @brief Busca card pelo ID em todas as colunas.
+     * 
+     * @param cardId Identificador do card
+     * @return Ponteiro para o card ou nullptr se não existir
+     * @note Ponteiro invalidado por qualquer alteração estrutural da coluna
+     */
+    Card* findCard(const std::string& cardId);
+
+    /**
+     * @brief Altera título, descrição e/ou prioridade de um card.
+     * 
+     * Somente campos que de fato mudam são aplicados e registrados
+     * (diff no payload do evento CardUpdated).
+     * 
+     * @param cardId Identificador do card
+     * @param title Novo título (nullopt = mantém)
+     * @param description Nova descrição (nullopt = mantém)
+     * @param priority Nova prioridade (nullopt = mantém)
+     * @return true se o card existe
+     */
+    bool updateCard(const std::string& cardId, const std::optional<std::string>& title,
+                    const std::optional<std::string>& description,
+                    const std::optional<int>& priority);
+
+    /**
+     * @brief updateCard() somente se o card ainda está na versão esperada.
+     * @param cardId Identificador do card
+     * @param expectedVersion Card::getVersion() lida antes da edição
+     * @param title Novo título (nullopt = mantém)
+     * @param description Nova descrição (nullopt = mantém)
+     * @param priority Nova prioridade (nullopt = mantém)
+     * @return false se o card não existe ou foi alterado desde a leitura
+     */
+    bool updateCardIf(const std::string& cardId, std::uint64_t expectedVersion,
+                      const std::optional<std::string>& title,
+                      const std::optional<std::string>& description,
+                      const std::optional<int>& priority);
+
+    /**
+     * @brief Adiciona ou remove tag de um card (registra se houve mudança).
+     * @param cardId Identificador do card
+     * @param tag Tag
+     * @param add true = adicionar, false = remover
+     * @return true se o card existe
+     */
+    bool tagCard(const std::string& cardId, const std::string& tag, bool add);
+
+    /**
+     * @brief Registra o estado completo do board no ActivityLog.
+     * 
+     * Checkpoints são o ponto de partida de BoardReplay: reconstruir o board
+     * em um instante custa O(eventos desde o checkpoint anterior).
+     */
+    void checkpoint() const;
 
     /**
      * @brief Move card entre colunas.
@@ -118,13 +240,45 @@ public:
      * Remove card da coluna origem e adiciona na coluna destino.
      * Verifica regras de WIP (Work In Progress) antes da movimentação.
      * 
+     * Quando fromCol == toCol o card é apenas reordenado na coluna.
+     * Somente a chave de ordenação do card movido é alterada.
+     * 
      * @param cardId Identificador do card a ser movido
      * @param fromCol Nome da coluna origem
      * @param toCol Nome da coluna destino
+     * @param position Índice final do card na coluna destino (END_POSITION = fim)
      * @return true se movido com sucesso, false caso contrário
-     * @todo Implementar verificação de regras de WIP
      */
-    bool moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol);
+    bool moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol,
+                  size_t position = END_POSITION);
+
+    /**
+     * @brief moveCard() somente se o card ainda está na versão esperada.
+     * @param cardId Identificador do card
+     * @param expectedVersion Card::getVersion() lida antes da movimentação
+     * @param fromCol Nome da coluna origem
+     * @param toCol Nome da coluna destino
+     * @param position Índice final na coluna destino (END_POSITION = fim)
+     * @return false se o card foi alterado/movido desde a leitura ou o
+     *         movimento em si falhou
+     */
+    bool moveCardIf(const std::string& cardId, std::uint64_t expectedVersion, const std::string& fromCol,
+                    const std::string& toCol, size_t position = END_POSITION);
+
+    /**
+     * @brief Aplica um lote de operações de forma atômica.
+     * 
+     * Localiza todos os cards com uma única varredura, valida colunas,
+     * existência dos cards e limites WIP (estado final) uma vez para o lote
+     * inteiro, aplica remoções e inclusões agrupadas por coluna e registra
+     * um único evento resumido no ActivityLog.
+     * 
+     * @param batch Operações a aplicar
+     * @return true se aplicado, false se alguma validação falhou (nada é alterado)
+     * @note Cards movidos entram no fim da coluna destino, antes dos cards novos
+     * @see BoardBatch
+     */
+    bool applyBatch(const BoardBatch& batch);
 
     /**
      * @brief Injeta dependência do sistema de log.
@@ -138,11 +292,32 @@ public:
      */
     void attachActivityLog(ActivityLog* log);
 
+    /**
+     * @brief Injeta o agregador de métricas de fluxo.
+     * 
+     * Entradas, saídas e movimentos de cards passam a alimentar as
+     * métricas. Cards já presentes são registrados via FlowMetrics::track().
+     * 
+     * @param metrics Ponteiro para as métricas (pode ser nullptr)
+     * @note Board não possui o FlowMetrics - gerenciamento externo
+     */
+    void attachFlowMetrics(FlowMetrics* metrics);
+
+    /**
+     * @brief Versão do board: incrementada por todo mutador bem-sucedido.
+     * 
+     * Persistida no JSON. Se a versão em disco é igual à carregada, o board
+     * não foi alterado por outro processo (atalho do WorkspaceMerge).
+     * 
+     * @return Contador monotônico
+     */
+    std::uint64_t getVersion() const;
+
     // Getters para acesso aos dados
     const std::string& getId() const;
     const std::string& getName() const;
     const std::vector<Column>& getColumns() const;
-    std::vector<Column>& getColumns();  // Versão não-const para permitir modificação
+    std::vector<Column>& getColumns();  // Versão não-const: altera colunas, não a estrutura (use add/removeColumn)
 
     // Métodos de filtro e busca
     /**
@@ -188,10 +363,18 @@ public:
     static Board fromJson(const nlohmann::json& j);
 
 private:
+    /**
+     * @brief Reconstrói o índice nome → posição a partir de m_columns.
+     */
+    void rebuildColumnIndex();
+
     std::string m_id;                              /**< @brief Identificador único do board */
     std::string m_name;                            /**< @brief Nome descritivo do board */
     std::vector<Column> m_columns;                 /**< @brief Container de colunas (composição) */
+    std::unordered_map<std::string, size_t> m_columnIndex; /**< @brief Índice nome → posição em m_columns */
     ActivityLog* m_activityLog { nullptr };       /**< @brief Ponteiro para sistema de log (não owned) */
+    FlowMetrics* m_flowMetrics { nullptr };       /**< @brief Métricas de fluxo (não owned) */
+    std::uint64_t m_version { 0 };                 /**< @brief Contador de alterações */
 };
 
 #endif // KANBAN_LITE_BOARD_H
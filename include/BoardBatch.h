@@ -0,0 +1,133 @@
+#ifndef KANBAN_LITE_BOARD_BATCH_H
+#define KANBAN_LITE_BOARD_BATCH_H
+
+#include <optional>
+#include <string>
+#include <vector>
+#include "Card.h"
+#include "external/json.hpp"
+
+/**
+ * @file BoardBatch.h
+ * @brief Construtor (builder) de lotes de operações aplicados de uma vez a um Board.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class BoardBatch
+ * @brief Acumula operações sobre cards para aplicação em lote via Board::applyBatch().
+ *
+ * Operações em massa (importar milhares de cards, mover uma coluna inteira,
+ * etiquetar todos os cards de um filtro) passam por uma única validação de
+ * WIP, uma única atualização das estruturas das colunas e um único registro
+ * resumido no ActivityLog, em vez de uma chamada de Board por card.
+ *
+ * @details
+ * - Builder fluente: cada método retorna *this
+ * - O lote é aplicado de forma atômica (tudo ou nada)
+ * - Movimentos do mesmo card são compostos (A→B seguido de B→C = A→C)
+ */
+class BoardBatch {
+public:
+    /**
+     * @enum OperationType
+     * @brief Tipos de operação suportados em lote.
+     */
+    enum class OperationType {
+        AddCard,     /**< @brief Adiciona card novo ao fim de uma coluna */
+        MoveCard,    /**< @brief Move card existente entre colunas */
+        AddTag,      /**< @brief Adiciona tag a um card */
+        RemoveTag    /**< @brief Remove tag de um card */
+    };
+
+    /**
+     * @struct Operation
+     * @brief Uma operação registrada no lote.
+     */
+    struct Operation {
+        OperationType type;                        /**< @brief Tipo da operação */
+        std::string cardId;                        /**< @brief Card alvo */
+        std::string column;                        /**< @brief Coluna destino (AddCard) ou origem (MoveCard) */
+        std::string targetColumn;                  /**< @brief Coluna destino (MoveCard) */
+        std::string tag;                           /**< @brief Tag (AddTag/RemoveTag) */
+        std::optional<Card> card;                  /**< @brief Card novo (AddCard) */
+    };
+
+    /**
+     * @brief Agenda inclusão de card novo ao fim da coluna.
+     * @param column Nome da coluna destino
+     * @param card Card a ser incluído
+     * @return Referência ao próprio lote
+     */
+    BoardBatch& addCard(std::string column, Card card);
+
+    /**
+     * @brief Agenda movimentação de card entre colunas.
+     * @param cardId Identificador do card
+     * @param fromCol Coluna origem
+     * @param toCol Coluna destino
+     * @return Referência ao próprio lote
+     */
+    BoardBatch& moveCard(std::string cardId, std::string fromCol, std::string toCol);
+
+    /**
+     * @brief Agenda inclusão de tag em um card.
+     * @param cardId Identificador do card
+     * @param tag Tag a adicionar
+     * @return Referência ao próprio lote
+     */
+    BoardBatch& addTag(std::string cardId, std::string tag);
+
+    /**
+     * @brief Agenda remoção de tag de um card.
+     * @param cardId Identificador do card
+     * @param tag Tag a remover
+     * @return Referência ao próprio lote
+     */
+    BoardBatch& removeTag(std::string cardId, std::string tag);
+
+    /**
+     * @brief Pré-aloca espaço para n operações.
+     * @param n Quantidade esperada de operações
+     */
+    void reserve(size_t n);
+
+    /**
+     * @brief Retorna as operações na ordem em que foram agendadas.
+     * @return Referência const ao vetor de operações
+     */
+    const std::vector<Operation>& operations() const;
+
+    /**
+     * @brief Quantidade de operações agendadas.
+     * @return Número de operações
+     */
+    size_t size() const;
+
+    /**
+     * @brief Verifica se o lote está vazio.
+     * @return true se nenhuma operação foi agendada
+     */
+    bool empty() const;
+
+    /**
+     * @brief Serializa as operações (payload do evento de lote no ActivityLog).
+     * @return Array JSON de operações
+     */
+    nlohmann::json toJson() const;
+
+    /**
+     * @brief Reconstrói lote a partir de toJson().
+     * @param j Array JSON de operações
+     * @return Lote reconstruído
+     * @throws std::invalid_argument se uma operação é desconhecida
+     * @throws json::exception se estrutura inválida
+     */
+    static BoardBatch fromJson(const nlohmann::json& j);
+
+private:
+    std::vector<Operation> m_operations;           /**< @brief Operações agendadas (ordem preservada) */
+};
+
+#endif // KANBAN_LITE_BOARD_BATCH_H
@@ -0,0 +1,73 @@
+#ifndef KANBAN_LITE_BOARD_REPLAY_H
+#define KANBAN_LITE_BOARD_REPLAY_H
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "external/json.hpp"
+
+class Board;
+class ActivityLog;
+
+/**
+ * @file BoardReplay.h
+ * @brief Reconstrução de boards a partir do fluxo de eventos do ActivityLog.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class BoardReplay
+ * @brief Aplica eventos estruturados (formato de ActivityLog::toJson()) sobre um Board.
+ *
+ * Cada evento que altera estado carrega no payload o necessário para
+ * refazê-lo: card completo na criação, posição final em movimentos,
+ * diff de campos em CardUpdated, operações em BatchApplied e o board
+ * inteiro em BoardCheckpoint. Um board em qualquer instante é o último
+ * checkpoint anterior mais a cauda de eventos até aquele instante.
+ *
+ * @details
+ * - Eventos sem efeito em estado (texto livre, tipos desconhecidos) são ignorados
+ * - Eventos anteriores ao payload (logs antigos) não são reaplicáveis
+ * - Checkpoints sem payload (superados no save) não alteram o board
+ * - updatedAt de cards editados no replay reflete o momento do replay
+ */
+class BoardReplay {
+public:
+    /** @brief Eventos de um board entre checkpoints gravados ao salvar. */
+    static constexpr size_t CHECKPOINT_INTERVAL = 256;
+
+    /**
+     * @brief Aplica um evento ao board.
+     * @param board Board alvo (sem ActivityLog anexado, para não registrar de novo)
+     * @param event Evento no formato de ActivityLog::toJson()
+     * @return true se aplicado ou sem efeito; false se o estado diverge ou falta payload
+     */
+    static bool apply(Board& board, const nlohmann::json& event);
+
+    /**
+     * @brief Aplica uma sequência de eventos em ordem.
+     * @param board Board alvo (em geral recém-criado de um checkpoint)
+     * @param events Cauda de eventos do board
+     * @return true se todos foram aplicados
+     */
+    static bool replay(Board& board, const std::vector<nlohmann::json>& events);
+
+    /**
+     * @brief Reconstrói o board como estava no instante t.
+     *
+     * Percorre a trilha de trás para frente a partir de t, em blocos, até
+     * o checkpoint mais recente do board e reaplica a cauda: O(eventos
+     * desde o checkpoint).
+     *
+     * @param log Log com a trilha (memória + disco)
+     * @param boardName Nome do board
+     * @param t Instante desejado (inclusivo)
+     * @return Board reconstruído, ou nullptr sem checkpoint até t ou se o replay falhar
+     */
+    static std::unique_ptr<Board> at(const ActivityLog& log, const std::string& boardName,
+                                     std::chrono::system_clock::time_point t);
+};
+
+#endif // KANBAN_LITE_BOARD_REPLAY_H
@@ -0,0 +1,161 @@
+#ifndef KANBAN_LITE_BOARD_SNAPSHOT_H
+#define KANBAN_LITE_BOARD_SNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Card.h"
+#include "external/json.hpp"
+
+class Board;
+class Column;
+
+/**
+ * @file BoardSnapshot.h
+ * @brief Snapshots imutáveis de Board com compartilhamento estrutural.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class ColumnSnapshot
+ * @brief Versão imutável de uma coluna: nome, limite WIP e cards compartilhados.
+ */
+class ColumnSnapshot {
+public:
+    using CardPtr = std::shared_ptr<const Card>;
+
+    /**
+     * @brief Copia todos os cards da coluna.
+     * @param column Coluna de origem
+     */
+    explicit ColumnSnapshot(const Column& column);
+
+    /**
+     * @brief Path-copy: reaproveita da versão anterior os cards não alterados.
+     * 
+     * Se a coluna foi renumerada desde a versão anterior (geração de chaves
+     * diferente), todos os cards mudaram de chave e versão: copia todos.
+     * 
+     * @param column Coluna atual
+     * @param previous Versão anterior da mesma coluna
+     * @param changedCards IDs de cards que devem ser copiados de novo
+     */
+    ColumnSnapshot(const Column& column, const ColumnSnapshot& previous,
+                   const std::unordered_set<std::string>& changedCards);
+
+    const std::string& getName() const;
+    int getWipLimit() const;
+    std::uint64_t getVersion() const;
+    const std::vector<CardPtr>& getCards() const;
+    size_t getCardCount() const;
+
+    /**
+     * @brief Busca card pelo ID.
+     * @return Ponteiro para o card ou nullptr
+     */
+    const Card* findCard(const std::string& cardId) const;
+
+    nlohmann::json toJson() const;
+
+private:
+    std::string m_name;                            /**< @brief Nome da coluna */
+    int m_wipLimit;                                /**< @brief Limite WIP (-1 = sem limite) */
+    std::uint64_t m_version;                       /**< @brief Column::getVersion() no snapshot */
+    std::uint64_t m_rankGeneration;                /**< @brief Column::getRankGeneration() no snapshot */
+    std::vector<CardPtr> m_cards;                  /**< @brief Cards em ordem (compartilhados entre versões) */
+};
+
+/**
+ * @class BoardSnapshot
+ * @brief Versão imutável de um Board, copiada em O(1).
+ *
+ * Um snapshot é um ponteiro compartilhado para colunas imutáveis, que por
+ * sua vez apontam para cards imutáveis. update() gera a próxima versão
+ * copiando apenas as colunas e cards alterados; o restante é compartilhado
+ * com a versão anterior, que continua válida para quem ainda a segura.
+ *
+ * @details
+ * - Cópia e atribuição: O(1) (um contador de referência)
+ * - update(): O(colunas + cards das colunas alteradas)
+ * - Leitura não usa lock: nada em um snapshot muda depois de criado
+ * @see SharedBoard::snapshot
+ */
+class BoardSnapshot {
+public:
+    using ColumnPtr = std::shared_ptr<const ColumnSnapshot>;
+
+    /**
+     * @brief Snapshot vazio (sem colunas).
+     */
+    BoardSnapshot();
+
+    /**
+     * @brief Copia o board inteiro.
+     * @param board Board de origem
+     */
+    explicit BoardSnapshot(const Board& board);
+
+    /**
+     * @brief Próxima versão após uma alteração localizada.
+     *
+     * Colunas fora de changedColumns são compartilhadas se existirem com o
+     * mesmo nome nesta versão; as demais são path-copied.
+     *
+     * @param board Board já alterado
+     * @param changedColumns Nomes das colunas alteradas
+     * @param changedCards IDs dos cards alterados
+     * @return Nova versão (esta permanece inalterada)
+     */
+    BoardSnapshot update(const Board& board, const std::unordered_set<std::string>& changedColumns,
+                         const std::unordered_set<std::string>& changedCards) const;
+
+    const std::string& getId() const;
+    const std::string& getName() const;
+    std::uint64_t getVersion() const;
+    const std::vector<ColumnPtr>& getColumns() const;
+
+    /**
+     * @brief Busca coluna pelo nome.
+     * @return Ponteiro para a coluna ou nullptr
+     */
+    const ColumnSnapshot* findColumn(const std::string& name) const;
+
+    /**
+     * @brief Busca card pelo ID em todas as colunas.
+     * @return Ponteiro para o card ou nullptr
+     */
+    const Card* findCard(const std::string& cardId) const;
+
+    std::vector<const Card*> findCardsByTag(const std::string& tag) const;
+    std::vector<const Card*> filterByPriority(int minPriority) const;
+    size_t getCardCount() const;
+
+    /**
+     * @brief Serializa no mesmo formato de Board::toJson().
+     */
+    nlohmann::json toJson() const;
+
+    /**
+     * @brief Reconstrói um Board mutável (cópia completa).
+     */
+    Board toBoard() const;
+
+private:
+    /**
+     * @struct Data
+     * @brief Conteúdo compartilhado entre cópias do snapshot.
+     */
+    struct Data {
+        std::string id;                            /**< @brief ID do board */
+        std::string name;                          /**< @brief Nome do board */
+        std::uint64_t version { 0 };               /**< @brief Board::getVersion() no snapshot */
+        std::vector<ColumnPtr> columns;            /**< @brief Colunas em ordem */
+    };
+
+    std::shared_ptr<const Data> m_data;            /**< @brief Versão imutável */
+};
+
+#endif // KANBAN_LITE_BOARD_SNAPSHOT_H
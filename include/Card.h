@@ -5,6 +5,8 @@
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <cstdint>
+#include "DescriptionStore.h"
 #include "external/json.hpp"
 
 class User; // forward declaration
@@ -71,6 +73,7 @@ public:
      * 
      * @param d Nova descrição (pode ser vazia)
      * @post updatedAt atualizado para momento atual
+     * @note Cards com a mesma descrição compartilham uma única cópia (DescriptionStore)
      */
     void setDescription(const std::string& d);
 
@@ -126,6 +129,24 @@ public:
     const std::chrono::system_clock::time_point& getCreatedAt() const;
     const std::chrono::system_clock::time_point& getUpdatedAt() const;
 
+    /**
+     * @brief Versão do card: incrementada por todo método que o altera.
+     *
+     * Persistida no JSON; usada por updates condicionais e pelo merge ao
+     * salvar (WorkspaceMerge) para saber quem alterou o card.
+     *
+     * @return Contador monotônico (0 = nunca alterado)
+     */
+    std::uint64_t getVersion() const;
+
+    /**
+     * @brief Define o título somente se a versão ainda é a esperada.
+     * @param expectedVersion Versão lida antes da edição
+     * @param t Novo título
+     * @return true se aplicado, false se o card mudou desde a leitura
+     */
+    bool setTitleIf(std::uint64_t expectedVersion, const std::string& t);
+
     /**
      * @brief Adiciona uma tag/etiqueta ao card.
      * @param tag Nome da tag a ser adicionada
@@ -153,6 +174,27 @@ public:
      */
     const std::vector<std::string>& getTags() const;
 
+    /**
+     * @brief Retorna a chave de ordenação do card dentro da coluna.
+     * @return Chave fracionária (vazia se o card ainda não está em coluna)
+     * @see RankKey
+     */
+    const std::string& getRank() const;
+
+    /**
+     * @brief Define a chave de ordenação do card.
+     *
+     * Usado por Column ao posicionar o card. Não altera updatedAt, pois a
+     * posição não faz parte do conteúdo da tarefa. Só o reposicionamento
+     * pedido pelo usuário incrementa a versão (é uma alteração para o
+     * merge); chaves recalculadas na inserção ou na renumeração da coluna
+     * não, senão cada card renumerado pareceria alterado.
+     *
+     * @param rank Nova chave fracionária
+     * @param moved true se o card foi reposicionado na coluna
+     */
+    void setRank(std::string rank, bool moved = false);
+
     /**
      * @brief Serializa o card para JSON.
      * 
@@ -180,12 +222,14 @@ public:
 private:
     std::string m_id;                              /**< @brief Identificador único do card */
     std::string m_title;                           /**< @brief Título da tarefa */
-    std::string m_description;                     /**< @brief Descrição detalhada (opcional) */
+    DescriptionStore::Handle m_description;        /**< @brief Descrição compartilhada entre cards iguais (nullptr = vazia) */
     User* m_assignee { nullptr };                 /**< @brief Ponteiro para usuário responsável (não owned) */
     int m_priority { 0 };                          /**< @brief Prioridade numérica (0=baixa, valores maiores=alta) */
     std::chrono::system_clock::time_point m_createdAt;   /**< @brief Timestamp de criação */
     std::chrono::system_clock::time_point m_updatedAt;   /**< @brief Timestamp da última modificação */
     std::vector<std::string> m_tags;               /**< @brief Etiquetas/tags para categorização */
+    std::string m_rank;                            /**< @brief Chave de ordenação na coluna (RankKey) */
+    std::uint64_t m_version { 0 };                 /**< @brief Contador de alterações */
 };
 
 #endif // KANBAN_LITE_CARD_H
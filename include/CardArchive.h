@@ -0,0 +1,112 @@
+#ifndef KANBAN_LITE_CARD_ARCHIVE_H
+#define KANBAN_LITE_CARD_ARCHIVE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Card.h"
+#include "Compression.h"
+
+/**
+ * @file CardArchive.h
+ * @brief Arquivo frio (append-only, comprimido e indexado) de cards concluídos.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CardArchive
+ * @brief Guarda cards retirados do board fora das estruturas quentes.
+ *
+ * Cada arquivamento acrescenta um membro gzip a "cards.jsonl" (um registro
+ * por linha: board, coluna, data e o card no formato de Card::toJson()) e
+ * uma linha por card a "index.jsonl" com o deslocamento do membro. A busca
+ * por ID lê o índice e descomprime só o membro do card; a busca por texto
+ * percorre o arquivo em streaming, sem carregá-lo na memória.
+ *
+ * @details
+ * - Diretório ao lado do workspace ("<arquivo>.archive.d"), como o spill do ActivityLog
+ * - Nada é reescrito: arquivar o mesmo ID de novo acrescenta; vale o registro mais recente
+ * - O índice só é lido no primeiro uso (carregar o workspace não custa nada)
+ * - Sem zlib os membros são gravados em texto; a leitura detecta o codec de cada um
+ */
+class CardArchive {
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    /**
+     * @struct Record
+     * @brief Card arquivado com a origem.
+     */
+    struct Record {
+        std::string board;                         /**< @brief Board de origem */
+        std::string column;                        /**< @brief Coluna de origem */
+        TimePoint archivedAt;                      /**< @brief Momento do arquivamento */
+        Card card;                                 /**< @brief Card (assignee não resolvido) */
+    };
+
+    /**
+     * @param directory Diretório do arquivo (criado no primeiro append())
+     */
+    explicit CardArchive(std::string directory);
+
+    /**
+     * @brief Acrescenta cards ao arquivo em um único membro comprimido.
+     * @param board Board de origem
+     * @param column Coluna de origem
+     * @param cards Cards retirados
+     * @throws std::runtime_error em falha de escrita (nada é indexado nesse caso)
+     */
+    void append(const std::string& board, const std::string& column, const std::vector<Card>& cards);
+
+    /**
+     * @brief Card arquivado pelo ID.
+     * @return Registro mais recente do ID, ou nullopt
+     * @throws std::runtime_error se o arquivo está ilegível
+     */
+    std::optional<Record> find(const std::string& cardId) const;
+
+    /**
+     * @brief Cards cujo ID, título, descrição ou tag contém o texto (sem diferenciar maiúsculas).
+     * @param text Texto procurado
+     * @param limit Máximo de resultados
+     * @return Registros na ordem de arquivamento
+     */
+    std::vector<Record> search(std::string_view text, size_t limit) const;
+
+    /**
+     * @brief Cards no índice (IDs distintos).
+     */
+    size_t size() const;
+
+    /**
+     * @brief Diretório do arquivo.
+     */
+    const std::string& directory() const;
+
+private:
+    /**
+     * @struct Entry
+     * @brief Linha do índice.
+     */
+    struct Entry {
+        std::uint64_t offset { 0 };                /**< @brief Início do membro em cards.jsonl */
+        TimePoint archivedAt;                      /**< @brief Momento do arquivamento */
+    };
+
+    void loadIndex() const;
+    std::string dataFile() const;
+    std::string indexFile() const;
+
+    std::string m_directory;                                       /**< @brief Diretório do arquivo */
+    Compression::Codec m_codec;                                    /**< @brief Codec dos novos membros */
+    mutable bool m_indexLoaded { false };                          /**< @brief Índice já lido */
+    mutable std::unordered_map<std::string, Entry> m_index;        /**< @brief ID → membro mais recente */
+};
+
+#endif // KANBAN_LITE_CARD_ARCHIVE_H
@@ -0,0 +1,136 @@
+#ifndef KANBAN_LITE_CARD_EXPORTER_H
+#define KANBAN_LITE_CARD_EXPORTER_H
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Card;
+class Board;
+class CsvWriter;
+class JsonLinesWriter;
+
+/**
+ * @file CardExporter.h
+ * @brief Exportação de cards em CSV ou JSON Lines, com projeção de campos.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CardExporter
+ * @brief Escreve uma linha por card direto das colunas, sem cópias nem DOM.
+ *
+ * Cada card é projetado nos campos pedidos e acrescentado ao buffer do
+ * CsvWriter / JsonLinesWriter, que o repassa ao ostream quando enche: a
+ * memória usada não depende do tamanho do board.
+ *
+ * @details
+ * - Campos: board, column, id, title, description, priority, tags, assignee,
+ *   createdAt, updatedAt, rank, version
+ * - CSV começa com o cabeçalho (nomes dos campos); tags unidas por ';'
+ * - Timestamps em milissegundos desde a época
+ * - Saída compatível com CardImporter (reimportável)
+ *
+ * @code
+ * CardExporter out(file, CardExporter::Format::Csv, CardExporter::parseFields("id,title,tags"));
+ * out.writeBoard(board, filter);
+ * @endcode
+ */
+class CardExporter {
+public:
+    /**
+     * @enum Format
+     * @brief Formato de saída.
+     */
+    enum class Format {
+        Csv,         /**< @brief Cabeçalho + uma linha por card */
+        JsonLines    /**< @brief Um objeto por card */
+    };
+
+    /**
+     * @enum Field
+     * @brief Campo projetado.
+     */
+    enum class Field { Board, Column, Id, Title, Description, Priority, Tags, Assignee,
+                       CreatedAt, UpdatedAt, Rank, Version };
+
+    /**
+     * @struct Filter
+     * @brief Predicados opcionais (todos precisam valer).
+     */
+    struct Filter {
+        std::string column;                        /**< @brief Só esta coluna (vazio = todas) */
+        std::string tag;                           /**< @brief Só cards com a tag (vazio = qualquer) */
+        int minPriority { INT_MIN };               /**< @brief Prioridade mínima */
+
+        bool matches(const std::string& columnName, const Card& card) const;
+    };
+
+    /**
+     * @brief Converte "id,title,tags" em campos.
+     * @throws std::invalid_argument com o nome do campo desconhecido
+     */
+    static std::vector<Field> parseFields(std::string_view list);
+
+    /**
+     * @brief Campos usados quando --fields não é informado.
+     */
+    static const std::vector<Field>& defaultFields();
+
+    /**
+     * @param out Destino
+     * @param format Csv ou JsonLines
+     * @param fields Campos, na ordem de saída
+     * @note Em CSV o cabeçalho é escrito aqui
+     */
+    CardExporter(std::ostream& out, Format format, std::vector<Field> fields);
+    ~CardExporter();
+
+    CardExporter(const CardExporter&) = delete;
+    CardExporter& operator=(const CardExporter&) = delete;
+
+    /**
+     * @brief Escreve um card.
+     */
+    void write(std::string_view board, std::string_view column, const Card& card);
+
+    /**
+     * @brief Escreve os cards do board que passam no filtro, coluna a coluna.
+     * @return Quantidade de cards escritos
+     */
+    size_t writeBoard(const Board& board, const Filter& filter);
+
+    /**
+     * @brief Escreve todos os cards do board.
+     */
+    size_t writeBoard(const Board& board);
+
+    /**
+     * @brief Cards escritos até agora.
+     */
+    size_t rows() const;
+
+    /**
+     * @brief Repassa o buffer ao ostream.
+     */
+    void flush();
+
+private:
+    /**
+     * @brief Um campo no escritor ativo.
+     */
+    template <typename T>
+    void put(const char* key, const T& value);
+
+    std::vector<Field> m_fields;                   /**< @brief Projeção */
+    std::unique_ptr<CsvWriter> m_csv;              /**< @brief Escritor (formato Csv) */
+    std::unique_ptr<JsonLinesWriter> m_json;       /**< @brief Escritor (formato JsonLines) */
+    size_t m_rows { 0 };                           /**< @brief Cards escritos */
+};
+
+#endif // KANBAN_LITE_CARD_EXPORTER_H
@@ -0,0 +1,114 @@
+#ifndef KANBAN_LITE_CARD_ID_ALLOCATOR_H
+#define KANBAN_LITE_CARD_ID_ALLOCATOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+/**
+ * @file CardIdAllocator.h
+ * @brief Gerador de IDs de cards monotônico, seguro entre threads e processos.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CardIdAllocator
+ * @brief Aloca IDs numéricos de 64 bits únicos para cards.
+ *
+ * Mantém um contador atômico em memória que consome blocos de IDs
+ * arrendados (leases). Sem arquivo de lease, os blocos são gerados
+ * localmente a partir de 1. Com um arquivo de lease anexado, cada bloco
+ * é reservado sob lock exclusivo do arquivo, de modo que vários processos
+ * (CLI e GUI) trabalhando no mesmo workspace nunca recebem o mesmo ID.
+ *
+ * @details
+ * - Caminho rápido: compare-and-swap no contador, sem lock por card
+ * - Reabastecimento: mutex local + lock do arquivo apenas a cada bloco
+ * - Par (próximo, fim) trocado sob geração (seqlock): ID emitido durante a
+ *   troca é descartado, nunca devolvido do bloco antigo
+ * - Monotonicidade: IDs nunca voltam, mesmo após reserveThrough()
+ * - Formato do arquivo: um único inteiro decimal (próximo ID livre)
+ */
+class CardIdAllocator {
+public:
+    /**
+     * @brief Construtor do alocador.
+     * @param blockSize Quantidade de IDs reservados por lease (mínimo 1)
+     * @post Nenhum arquivo anexado; primeiro ID emitido será 1
+     */
+    explicit CardIdAllocator(std::uint64_t blockSize = 64);
+
+    CardIdAllocator(const CardIdAllocator&) = delete;
+    CardIdAllocator& operator=(const CardIdAllocator&) = delete;
+
+    /**
+     * @brief Instância compartilhada pelo processo (CLI e GUI).
+     * @return Referência para o alocador global
+     */
+    static CardIdAllocator& instance();
+
+    /**
+     * @brief Emite o próximo ID livre.
+     *
+     * @return ID numérico único (> 0)
+     * @throws std::runtime_error se o arquivo de lease não puder ser atualizado
+     * @note Thread-safe; bloqueia apenas quando o bloco atual se esgota
+     */
+    std::uint64_t next();
+
+    /**
+     * @brief Emite o próximo ID já formatado como "card_<n>".
+     * @return Identificador textual do card
+     */
+    std::string nextCardId();
+
+    /**
+     * @brief Anexa o arquivo de lease do workspace.
+     *
+     * O bloco local remanescente é descartado e o próximo next()
+     * reserva um bloco novo a partir do arquivo.
+     *
+     * @param path Caminho do arquivo de lease (criado se não existir)
+     */
+    void attachLeaseFile(const std::string& path);
+
+    /**
+     * @brief Garante que IDs futuros sejam maiores que highest.
+     *
+     * Usado ao carregar um workspace cujos cards já consumiram IDs.
+     *
+     * @param highest Maior ID já utilizado
+     */
+    void reserveThrough(std::uint64_t highest);
+
+    /**
+     * @brief Retorna o maior ID emitido até o momento.
+     * @return Último ID emitido (0 se nenhum)
+     */
+    std::uint64_t highestIssued() const;
+
+    /**
+     * @brief Extrai o valor numérico de um ID no formato "card_<n>".
+     * @param cardId Identificador textual
+     * @return Valor numérico ou 0 se o formato não corresponder (ou exceder 64 bits)
+     */
+    static std::uint64_t parseCardId(const std::string& cardId);
+
+private:
+    void refillLocked();
+    void beginUpdate();
+    void endUpdate();
+    std::uint64_t leaseFromFile(std::uint64_t floor);
+
+    std::atomic<std::uint64_t> m_next { 1 };       /**< @brief Próximo ID do bloco atual */
+    std::atomic<std::uint64_t> m_end { 1 };        /**< @brief Fim (exclusivo) do bloco atual */
+    std::atomic<std::uint64_t> m_floor { 0 };      /**< @brief Maior ID que nunca deve ser reemitido */
+    std::atomic<std::uint64_t> m_generation { 0 }; /**< @brief Ímpar enquanto (m_next, m_end) é trocado */
+    std::uint64_t m_blockSize;                     /**< @brief Tamanho de cada lease */
+    std::string m_leasePath;                       /**< @brief Arquivo de lease (vazio = somente memória) */
+    std::mutex m_refillMutex;                      /**< @brief Serializa reabastecimentos */
+};
+
+#endif // KANBAN_LITE_CARD_ID_ALLOCATOR_H
@@ -0,0 +1,90 @@
+#ifndef KANBAN_LITE_CARD_IMPORTER_H
+#define KANBAN_LITE_CARD_IMPORTER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file CardImporter.h
+ * @brief Leitura paralela de cards em CSV e JSON Lines para importação em lote.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CardImporter
+ * @brief Converte exportações de trackers (CSV / JSON Lines) em linhas de card.
+ *
+ * O arquivo é lido inteiro para a memória e dividido em blocos que terminam
+ * em fim de registro; cada bloco é analisado em sua própria thread e os
+ * resultados são concatenados na ordem do arquivo. A montagem dos Card e a
+ * validação (colunas, IDs duplicados, WIP) ficam para o chamador, em um
+ * único BoardBatch.
+ *
+ * @details
+ * - CSV (RFC 4180): primeira linha é o cabeçalho; campos entre aspas podem
+ *   conter vírgulas, quebras de linha e "" (aspas escapadas)
+ * - Cabeçalhos reconhecidos (sem diferenciar maiúsculas): id/key, title/summary/name,
+ *   description, column/status/state, priority, tags/labels, assignee/owner;
+ *   demais colunas são ignoradas
+ * - JSON Lines: um objeto por linha com as mesmas chaves (assigneeId também vale)
+ * - Tags em CSV são separadas por ';'; em JSON Lines, array ou texto com ';'
+ * - Prioridade: inteiro ou lowest/low/medium/high/highest (0 a 4)
+ * - Erros lançam std::runtime_error com o número da linha no arquivo
+ */
+class CardImporter {
+public:
+    /**
+     * @enum Format
+     * @brief Formato do arquivo, deduzido pela extensão.
+     */
+    enum class Format {
+        JsonArray,   /**< @brief Array JSON no formato de Card::toJson() (.json e demais) */
+        JsonLines,   /**< @brief Um objeto por linha (.jsonl, .ndjson) */
+        Csv          /**< @brief Valores separados por vírgula com cabeçalho (.csv) */
+    };
+
+    /**
+     * @struct Row
+     * @brief Card lido do arquivo (campos vazios = não informados).
+     */
+    struct Row {
+        std::string id;                            /**< @brief ID (vazio = gerar) */
+        std::string title;                         /**< @brief Título (obrigatório) */
+        std::string description;                   /**< @brief Descrição */
+        std::string column;                        /**< @brief Coluna destino (vazio = padrão) */
+        std::string assignee;                      /**< @brief ID ou nome do responsável */
+        int priority { 0 };                        /**< @brief Prioridade */
+        std::vector<std::string> tags;             /**< @brief Tags */
+    };
+
+    static const size_t MIN_CHUNK_SIZE = 256 * 1024; /**< @brief Menor bloco entregue a uma thread */
+
+    /**
+     * @brief Formato pela extensão (.csv, .jsonl/.ndjson; demais = JsonArray).
+     */
+    static Format detectFormat(const std::string& filename);
+
+    /**
+     * @brief Lê e analisa um arquivo CSV ou JSON Lines.
+     * @param filename Caminho do arquivo
+     * @param threads Threads de análise (0 = hardware_concurrency)
+     * @return Linhas na ordem do arquivo
+     * @throws std::runtime_error se o arquivo não abre ou tem registro inválido
+     */
+    static std::vector<Row> parseFile(const std::string& filename, unsigned threads = 0);
+
+    /**
+     * @brief Analisa o conteúdo já em memória.
+     * @param data Conteúdo do arquivo
+     * @param format Csv ou JsonLines
+     * @param threads Threads de análise (0 = hardware_concurrency)
+     * @throws std::runtime_error em registro inválido
+     * @throws std::invalid_argument se format == JsonArray
+     */
+    static std::vector<Row> parse(std::string_view data, Format format, unsigned threads = 0);
+};
+
+#endif // KANBAN_LITE_CARD_IMPORTER_H
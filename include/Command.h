@@ -0,0 +1,185 @@
+#ifndef KANBAN_LITE_COMMAND_H
+#define KANBAN_LITE_COMMAND_H
+
+#include <optional>
+#include <string>
+#include "Board.h"
+#include "Card.h"
+#include "Column.h"
+
+/**
+ * @file Command.h
+ * @brief Comandos reversíveis (padrão Command) que alteram um Board.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class Command
+ * @brief Interface de uma alteração do board que sabe desfazer a si mesma.
+ *
+ * Cada comando guarda apenas o mínimo necessário para sua inversa
+ * (coluna e índice anteriores, título antigo, tag alterada...), nunca uma
+ * cópia do board. O custo de memória é proporcional ao que foi alterado.
+ *
+ * @details
+ * - execute() captura o estado anterior e aplica a alteração
+ * - undo() aplica a inversa usando o estado capturado
+ * - execute() pode ser chamado novamente após undo() (refazer)
+ * - Falhas retornam false e deixam o board inalterado
+ * @see CommandHistory
+ */
+class Command {
+public:
+    virtual ~Command() = default;
+
+    /**
+     * @brief Aplica a alteração ao board.
+     * @param board Board alvo
+     * @return true se aplicada, false se inválida no estado atual
+     */
+    virtual bool execute(Board& board) = 0;
+
+    /**
+     * @brief Desfaz a alteração aplicada pelo último execute().
+     * @param board Board alvo (o mesmo de execute())
+     * @return true se desfeita, false se o estado atual não permite
+     */
+    virtual bool undo(Board& board) = 0;
+
+    /**
+     * @brief Descrição curta para mensagens de desfazer/refazer.
+     * @return Texto descritivo
+     */
+    virtual std::string describe() const = 0;
+};
+
+/**
+ * @class AddCardCommand
+ * @brief Inclui card no fim de uma coluna; a inversa o remove.
+ */
+class AddCardCommand : public Command {
+public:
+    AddCardCommand(std::string column, Card card);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    std::string m_column;                          /**< @brief Coluna destino */
+    Card m_card;                                   /**< @brief Card a incluir */
+};
+
+/**
+ * @class RemoveCardCommand
+ * @brief Remove card; a inversa o reinsere no mesmo índice.
+ */
+class RemoveCardCommand : public Command {
+public:
+    RemoveCardCommand(std::string column, std::string cardId);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    std::string m_column;                          /**< @brief Coluna que contém o card */
+    std::string m_cardId;                          /**< @brief Card removido */
+    std::optional<Card> m_removed;                 /**< @brief Card capturado em execute() */
+    size_t m_previousIndex { 0 };                  /**< @brief Índice do card antes da remoção */
+};
+
+/**
+ * @class MoveCardCommand
+ * @brief Move (ou reordena) card; a inversa volta à coluna e índice anteriores.
+ */
+class MoveCardCommand : public Command {
+public:
+    MoveCardCommand(std::string cardId, std::string fromCol, std::string toCol,
+                    size_t position = Board::END_POSITION);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    std::string m_cardId;                          /**< @brief Card movido */
+    std::string m_fromCol;                         /**< @brief Coluna origem */
+    std::string m_toCol;                           /**< @brief Coluna destino */
+    size_t m_position;                             /**< @brief Índice pedido no destino */
+    size_t m_previousIndex { 0 };                  /**< @brief Índice na origem antes do movimento */
+};
+
+/**
+ * @class EditCardCommand
+ * @brief Altera título, descrição e/ou prioridade; guarda só os campos alterados.
+ */
+class EditCardCommand : public Command {
+public:
+    EditCardCommand(std::string cardId, std::optional<std::string> title,
+                    std::optional<std::string> description, std::optional<int> priority);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    /**
+     * @brief Troca os valores do card pelos guardados (execute e undo são simétricos).
+     */
+    bool swapFields(Board& board);
+
+    std::string m_cardId;                          /**< @brief Card editado */
+    std::optional<std::string> m_title;            /**< @brief Título a aplicar (ou anterior, após execute) */
+    std::optional<std::string> m_description;      /**< @brief Descrição a aplicar (ou anterior) */
+    std::optional<int> m_priority;                 /**< @brief Prioridade a aplicar (ou anterior) */
+};
+
+/**
+ * @class TagCardCommand
+ * @brief Adiciona ou remove tag; a inversa só age se a tag de fato mudou.
+ */
+class TagCardCommand : public Command {
+public:
+    TagCardCommand(std::string cardId, std::string tag, bool add);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    std::string m_cardId;                          /**< @brief Card alvo */
+    std::string m_tag;                             /**< @brief Tag alterada */
+    bool m_add;                                    /**< @brief true = adicionar, false = remover */
+    bool m_changed { false };                      /**< @brief Se execute() alterou o card */
+};
+
+/**
+ * @class AddColumnCommand
+ * @brief Inclui coluna no fim do board; a inversa a remove.
+ */
+class AddColumnCommand : public Command {
+public:
+    explicit AddColumnCommand(Column column);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    Column m_column;                               /**< @brief Coluna a incluir */
+};
+
+/**
+ * @class RemoveColumnCommand
+ * @brief Remove coluna; a inversa a reinsere (com seus cards) na mesma posição.
+ */
+class RemoveColumnCommand : public Command {
+public:
+    explicit RemoveColumnCommand(std::string name);
+    bool execute(Board& board) override;
+    bool undo(Board& board) override;
+    std::string describe() const override;
+
+private:
+    std::string m_name;                            /**< @brief Coluna removida */
+    std::optional<Column> m_removed;               /**< @brief Coluna capturada em execute() */
+    size_t m_previousIndex { 0 };                  /**< @brief Posição da coluna antes da remoção */
+};
+
+#endif // KANBAN_LITE_COMMAND_H
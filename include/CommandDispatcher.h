@@ -0,0 +1,164 @@
+#ifndef KANBAN_LITE_COMMAND_DISPATCHER_H
+#define KANBAN_LITE_COMMAND_DISPATCHER_H
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file CommandDispatcher.h
+ * @brief Tabela de comandos da CLI (verbo/subverbo → handler).
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CommandArgs
+ * @brief Operandos de um comando (o que vem depois do verbo/subverbo).
+ *
+ * Os operandos são std::string_view para a linha já separada (ver
+ * CommandLine), sem cópia. Conversões numéricas exigem o texto inteiro
+ * válido ("5x" é rejeitado) e lançam CommandArgs::Error com a mensagem
+ * pronta para o usuário.
+ */
+class CommandArgs {
+public:
+    /**
+     * @class Error
+     * @brief Operando com tipo inválido.
+     */
+    class Error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @param args Linha completa
+     * @param first Índice do primeiro operando em args
+     */
+    CommandArgs(const std::vector<std::string_view>& args, size_t first);
+
+    size_t size() const;
+    std::string_view operator[](size_t index) const;
+
+    /**
+     * @brief Operando opcional.
+     * @return args[index] ou fallback se ausente
+     */
+    std::string_view get(size_t index, std::string_view fallback) const;
+
+    /**
+     * @brief Converte texto em inteiro (mesma validação de integer()).
+     * @throws CommandArgs::Error se não for um inteiro
+     */
+    static int toInteger(std::string_view text, const char* what);
+
+    /**
+     * @brief Operando inteiro.
+     * @param index Posição do operando
+     * @param what Nome usado na mensagem de erro (ex.: "priority")
+     * @throws CommandArgs::Error se não for um inteiro
+     */
+    int integer(size_t index, const char* what) const;
+
+    /**
+     * @brief Operando inteiro não negativo (posição, página, contagem).
+     * @throws CommandArgs::Error se não for um inteiro >= 0
+     */
+    size_t count(size_t index, const char* what) const;
+
+private:
+    const std::vector<std::string_view>& m_args;   /**< @brief Linha completa */
+    size_t m_first;                                /**< @brief Índice do primeiro operando */
+};
+
+/**
+ * @class CommandDispatcher
+ * @brief Despacho de comandos por tabela.
+ *
+ * Cada comando é registrado com verbo (e subverbo opcional), aridade e
+ * handler. dispatch() faz uma busca por nível (direto com string_view, sem
+ * montar std::string) e valida a aridade antes de chamar o handler, então
+ * comandos novos não mexem no despacho.
+ *
+ * @details
+ * - Um verbo pode ter handler próprio e subverbos ("history", "history --page")
+ * - O subverbo tem precedência quando o segundo argumento o identifica
+ * - Aridade conta somente os operandos depois do verbo/subverbo
+ */
+class CommandDispatcher {
+public:
+    using Handler = std::function<void(const CommandArgs& args)>;
+
+    /**
+     * @enum Result
+     * @brief Resultado de dispatch().
+     */
+    enum class Result {
+        Handled,          /**< @brief Handler executado */
+        UnknownVerb,      /**< @brief Verbo não registrado */
+        UnknownSubverb,   /**< @brief Verbo existe, subverbo não */
+        BadArity,         /**< @brief Quantidade de operandos fora do declarado */
+        BadArgument       /**< @brief Handler rejeitou um operando (CommandArgs::Error) */
+    };
+
+    /**
+     * @brief Registra um verbo sem subverbo.
+     * @param verb Verbo
+     * @param minArgs Mínimo de operandos
+     * @param maxArgs Máximo de operandos
+     * @param usage Sintaxe mostrada quando a aridade não confere
+     * @param handler Executa o comando
+     * @throws std::invalid_argument se o verbo já tem handler próprio
+     */
+    void add(const std::string& verb, size_t minArgs, size_t maxArgs,
+             const std::string& usage, Handler handler);
+
+    /**
+     * @brief Registra verbo + subverbo.
+     * @throws std::invalid_argument se o par já foi registrado
+     */
+    void add(const std::string& verb, const std::string& subverb, size_t minArgs, size_t maxArgs,
+             const std::string& usage, Handler handler);
+
+    /**
+     * @brief Executa a linha já separada em argumentos.
+     * @param args Verbo, subverbo e operandos
+     * @param message Recebe a sintaxe (BadArity) ou o erro do operando (BadArgument)
+     * @return Resultado do despacho
+     */
+    Result dispatch(const std::vector<std::string_view>& args, std::string& message) const;
+
+private:
+    /**
+     * @struct Spec
+     * @brief Entrada da tabela.
+     */
+    struct Spec {
+        size_t minArgs;                            /**< @brief Mínimo de operandos */
+        size_t maxArgs;                            /**< @brief Máximo de operandos */
+        std::string usage;                         /**< @brief Sintaxe completa */
+        Handler handler;                           /**< @brief Execução */
+    };
+
+    /**
+     * @struct Verb
+     * @brief Handler próprio e/ou tabela de subverbos.
+     */
+    struct Verb {
+        std::unique_ptr<Spec> direct;              /**< @brief Handler sem subverbo (opcional) */
+        std::map<std::string, Spec, std::less<>> subverbs; /**< @brief Subverbo → entrada */
+    };
+
+    static Result run(const Spec& spec, const std::vector<std::string_view>& args, size_t first,
+                      std::string& message);
+
+    std::map<std::string, Verb, std::less<>> m_verbs; /**< @brief Verbo → entradas */
+};
+
+#endif // KANBAN_LITE_COMMAND_DISPATCHER_H
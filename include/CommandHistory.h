@@ -0,0 +1,111 @@
+#ifndef KANBAN_LITE_COMMAND_HISTORY_H
+#define KANBAN_LITE_COMMAND_HISTORY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "Command.h"
+
+class Board;
+
+/**
+ * @file CommandHistory.h
+ * @brief Histórico limitado de comandos para desfazer/refazer.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CommandHistory
+ * @brief Pilhas de desfazer/refazer guardadas em um buffer circular de tamanho fixo.
+ *
+ * Cada entrada associa o comando ao board em que foi executado. Quando o
+ * buffer enche, o comando mais antigo é descartado; executar um comando
+ * novo descarta tudo o que poderia ser refeito.
+ *
+ * @details
+ * - Memória: capacidade × (tamanho do delta de cada comando)
+ * - Boards não são possuídos: chame clear() antes de destruí-los
+ * - Se desfazer/refazer falhar (board alterado por fora do histórico),
+ *   o histórico é descartado para não aplicar inversas sobre estado divergente
+ */
+class CommandHistory {
+public:
+    /**
+     * @brief Construtor.
+     * @param capacity Quantidade máxima de comandos desfazíveis (mínimo 1)
+     */
+    explicit CommandHistory(size_t capacity = 100);
+
+    /**
+     * @brief Executa o comando e, se bem-sucedido, registra no histórico.
+     * @param board Board alvo
+     * @param command Comando a executar
+     * @return true se executado
+     * @post Se sucesso, a pilha de refazer é esvaziada
+     */
+    bool execute(Board& board, std::unique_ptr<Command> command);
+
+    /**
+     * @brief Executa via histórico, se houver; sem ele aplica direto (sem desfazer).
+     * @param history Histórico (nullptr = sem desfazer)
+     * @param board Board alvo
+     * @param command Comando a executar
+     * @return true se executado
+     */
+    static bool apply(CommandHistory* history, Board& board, std::unique_ptr<Command> command);
+
+    /**
+     * @brief Desfaz o último comando executado.
+     * @return true se desfeito, false se não há o que desfazer ou a inversa falhou
+     */
+    bool undo();
+
+    /**
+     * @brief Refaz o último comando desfeito.
+     * @return true se refeito, false se não há o que refazer ou a execução falhou
+     */
+    bool redo();
+
+    /**
+     * @brief Descrição do comando que undo() desfaria ("" se nenhum).
+     */
+    std::string undoDescription() const;
+
+    /**
+     * @brief Descrição do comando que redo() refaria ("" se nenhum).
+     */
+    std::string redoDescription() const;
+
+    bool canUndo() const;
+    bool canRedo() const;
+    size_t capacity() const;
+
+    /**
+     * @brief Descarta todos os comandos (ex.: ao carregar outro estado).
+     */
+    void clear();
+
+private:
+    /**
+     * @struct Entry
+     * @brief Comando registrado e o board em que foi executado.
+     */
+    struct Entry {
+        Board* board { nullptr };                  /**< @brief Board alvo (não owned) */
+        std::unique_ptr<Command> command;          /**< @brief Comando com sua inversa */
+    };
+
+    /**
+     * @brief Entrada na posição lógica i (0 = mais antiga).
+     */
+    Entry& at(size_t i);
+    const Entry& at(size_t i) const;
+
+    std::vector<Entry> m_ring;                     /**< @brief Buffer circular de comandos */
+    size_t m_head { 0 };                           /**< @brief Posição física da entrada mais antiga */
+    size_t m_undoCount { 0 };                      /**< @brief Entradas desfazíveis */
+    size_t m_redoCount { 0 };                      /**< @brief Entradas refazíveis (após as desfazíveis) */
+};
+
+#endif // KANBAN_LITE_COMMAND_HISTORY_H
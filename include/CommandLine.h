@@ -0,0 +1,47 @@
+#ifndef KANBAN_LITE_COMMAND_LINE_H
+#define KANBAN_LITE_COMMAND_LINE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file CommandLine.h
+ * @brief Separação de linhas de comando em argumentos, com aspas e escapes.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CommandLine
+ * @brief Tokenizador de linhas do modo interativo, do modo lote e do cliente.
+ *
+ * Os argumentos são std::string_view apontando para a própria linha: aspas e
+ * barras são removidas no lugar (a linha é reescrita), então nenhum argumento
+ * é copiado. Reutilizando a linha e o vetor de uma leitura para a próxima,
+ * separar um comando não aloca memória.
+ *
+ * @details
+ * - Espaço, tab, '\\r' e '\\n' separam argumentos
+ * - "..." e '...' agrupam espaços; trechos adjacentes formam um argumento só (a"b c" → ab c)
+ * - \\x fora de aspas simples vale o caractere x (\\", \\\\, \\ espaço)
+ * - "" produz um argumento vazio
+ *
+ * @code
+ * std::string line = "card add Projeto ToDo \"Escrever docs\"";
+ * std::vector<std::string_view> args;
+ * CommandLine::tokenize(line, args); // args[4] == "Escrever docs"
+ * @endcode
+ */
+class CommandLine {
+public:
+    /**
+     * @brief Separa a linha em argumentos.
+     * @param line Linha (reescrita no lugar; deve viver enquanto os argumentos forem usados)
+     * @param tokens Recebe os argumentos (limpo antes; a capacidade é reaproveitada)
+     * @return false se uma aspa não foi fechada ou a linha termina em '\\'
+     */
+    static bool tokenize(std::string& line, std::vector<std::string_view>& tokens);
+};
+
+#endif // KANBAN_LITE_COMMAND_LINE_H
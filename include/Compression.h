@@ -0,0 +1,132 @@
+#ifndef KANBAN_LITE_COMPRESSION_H
+#define KANBAN_LITE_COMPRESSION_H
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+/**
+ * @file Compression.h
+ * @brief Leitura e escrita transparente de arquivos comprimidos (gzip).
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class Compression
+ * @brief Escolha do codec e operações de arquivo inteiro.
+ *
+ * Na leitura o codec é detectado pelos bytes mágicos (1f 8b), então o mesmo
+ * código abre arquivos comprimidos e em texto puro. Na escrita o codec vem
+ * da extensão (.gz) ou de flag explícita.
+ *
+ * @details
+ * - gzip via zlib (opcional na compilação; sem zlib, abrir .gz lança exceção)
+ * - Escrita no nível mais rápido do deflate: o JSON indentado já comprime 5-10x
+ * - Arquivos sem compressão passam direto pelo std::filebuf (sem custo extra)
+ */
+class Compression {
+public:
+    /**
+     * @enum Codec
+     * @brief Formato do arquivo em disco.
+     */
+    enum class Codec {
+        None,        /**< @brief Texto puro */
+        Gzip         /**< @brief gzip (RFC 1952) */
+    };
+
+    /**
+     * @brief Codec pela extensão (".gz" = Gzip; demais = None).
+     */
+    static Codec forFilename(const std::string& filename);
+
+    /**
+     * @brief Codec pelos bytes mágicos do arquivo (None se não existe ou é texto).
+     */
+    static Codec detect(const std::string& filename);
+
+    /**
+     * @brief Indica se o codec foi compilado (Gzip depende da zlib).
+     */
+    static bool isAvailable(Codec codec);
+
+    /**
+     * @brief Nome curto para mensagens ("none", "gzip").
+     */
+    static const char* name(Codec codec);
+
+    /**
+     * @brief Regrava o arquivo no codec pedido (via arquivo temporário + rename).
+     * @throws std::runtime_error em falha de leitura/escrita ou codec indisponível
+     */
+    static void compressFile(const std::string& filename, Codec codec);
+};
+
+/**
+ * @class CompressedIFStream
+ * @brief Substituto de std::ifstream que descomprime gzip sob demanda.
+ *
+ * @code
+ * CompressedIFStream file("workspace.json.gz");
+ * json state;
+ * file >> state;
+ * @endcode
+ */
+class CompressedIFStream : public std::istream {
+public:
+    /**
+     * @param filename Caminho do arquivo (comprimido ou não)
+     * @param offset Início da leitura (ex.: membro gzip anexado depois); o codec é detectado ali
+     * @throws std::runtime_error se o arquivo é gzip e a zlib não foi compilada
+     * @note Dados corrompidos lançam std::runtime_error durante a leitura
+     */
+    explicit CompressedIFStream(const std::string& filename, std::streamoff offset = 0);
+    ~CompressedIFStream() override;
+
+    bool is_open() const;
+
+    /**
+     * @brief Codec detectado na abertura.
+     */
+    Compression::Codec codec() const;
+
+private:
+    std::unique_ptr<std::streambuf> m_buffer;        /**< @brief filebuf ou descompressor */
+    Compression::Codec m_codec { Compression::Codec::None }; /**< @brief Codec detectado */
+};
+
+/**
+ * @class CompressedOFStream
+ * @brief Substituto de std::ofstream que comprime ao escrever.
+ *
+ * O trailer gzip é gravado em close() (ou no destrutor); verifique o estado
+ * do stream depois de close() para saber se a escrita foi completa.
+ */
+class CompressedOFStream : public std::ostream {
+public:
+    /**
+     * @param filename Caminho do arquivo
+     * @param codec Codec de escrita
+     * @param append Acrescenta ao fim (em gzip, um novo membro) em vez de truncar
+     * @throws std::runtime_error se o codec não foi compilado
+     */
+    CompressedOFStream(const std::string& filename, Compression::Codec codec, bool append = false);
+    ~CompressedOFStream() override;
+
+    bool is_open() const;
+
+    /**
+     * @brief Finaliza o stream comprimido e fecha o arquivo.
+     */
+    void close();
+
+private:
+    std::unique_ptr<std::streambuf> m_buffer;        /**< @brief filebuf ou compressor */
+    Compression::Codec m_codec;                      /**< @brief Codec de escrita */
+    bool m_open { false };                           /**< @brief Arquivo aberto e não fechado */
+};
+
+#endif // KANBAN_LITE_COMPRESSION_H
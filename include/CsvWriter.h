@@ -0,0 +1,86 @@
+#ifndef KANBAN_LITE_CSV_WRITER_H
+#define KANBAN_LITE_CSV_WRITER_H
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file CsvWriter.h
+ * @brief Escrita de CSV (RFC 4180) linha a linha com buffer próprio.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class CsvWriter
+ * @brief Par do JsonLinesWriter para saída tabular.
+ *
+ * Campos são acrescentados ao buffer na ordem das chamadas e endRow()
+ * termina a linha; o buffer vai para o ostream só quando enche, então a
+ * memória fica constante independente da quantidade de linhas.
+ *
+ * @details
+ * - Campos com vírgula, aspas ou quebra de linha saem entre aspas ("" escapa aspas)
+ * - Listas (tags) são unidas por ';', o mesmo separador lido pelo CardImporter
+ * - Timestamps saem em milissegundos desde a época, como no JSON
+ * - Linhas terminam em '\\n'
+ */
+class CsvWriter {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 64 * 1024; /**< @brief Bytes acumulados antes de escrever */
+
+    explicit CsvWriter(std::ostream& out, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    ~CsvWriter();
+
+    CsvWriter(const CsvWriter&) = delete;
+    CsvWriter& operator=(const CsvWriter&) = delete;
+
+    CsvWriter& field(std::string_view value);
+    CsvWriter& field(const char* value);
+    CsvWriter& field(const std::vector<std::string>& values);
+    CsvWriter& field(std::chrono::system_clock::time_point value);
+
+    /**
+     * @brief Campo numérico inteiro.
+     */
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, CsvWriter&>::type
+    field(T value) {
+        separate();
+        m_buffer += std::to_string(value);
+        return *this;
+    }
+
+    /**
+     * @brief Termina a linha atual.
+     */
+    CsvWriter& endRow();
+
+    /**
+     * @brief Repassa o buffer ao ostream.
+     */
+    void flush();
+
+    /**
+     * @brief Linhas terminadas até agora (inclui cabeçalho).
+     */
+    size_t rows() const;
+
+private:
+    void separate();
+    void appendQuoted(std::string_view value);
+
+    std::ostream& m_out;                           /**< @brief Destino */
+    size_t m_capacity;                             /**< @brief Limite do buffer antes de escrever */
+    std::string m_buffer;                          /**< @brief Bytes ainda não repassados */
+    std::string m_joined;                          /**< @brief Lista unida por ';' (reaproveitada) */
+    bool m_firstField { true };                    /**< @brief Próximo campo dispensa vírgula */
+    size_t m_rows { 0 };                           /**< @brief Linhas terminadas */
+};
+
+#endif // KANBAN_LITE_CSV_WRITER_H
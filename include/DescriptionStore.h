@@ -0,0 +1,103 @@
+#ifndef KANBAN_LITE_DESCRIPTION_STORE_H
+#define KANBAN_LITE_DESCRIPTION_STORE_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "external/json.hpp"
+
+/**
+ * @file DescriptionStore.h
+ * @brief Armazenamento deduplicado (endereçado por conteúdo) das descrições de cards.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class DescriptionStore
+ * @brief Guarda uma única cópia de cada descrição distinta.
+ *
+ * Descrições costumam ser texto longo repetido (formulários de bug, templates).
+ * Em memória, cada Card guarda um Handle (contagem de referências) para o
+ * corpo compartilhado; o corpo sai do store quando o último card o solta.
+ * Em disco, pack() move os corpos repetidos para uma tabela "descriptions"
+ * indexada pelo hash do conteúdo, e os cards (inclusive os guardados no
+ * activity log) passam a ter só "descriptionRef".
+ *
+ * @details
+ * - Índice em memória pelo próprio conteúdo (sem risco de colisão de hash)
+ * - Chave em disco: FNV-1a de 64 bits em hexadecimal; em colisão o texto fica inline
+ * - Só entram na tabela descrições com MIN_SHARED_SIZE bytes ou mais e usadas por 2+ cards
+ * - Thread-safe (mutex interno)
+ */
+class DescriptionStore {
+public:
+    /** @brief Corpo compartilhado, imutável. */
+    using Handle = std::shared_ptr<const std::string>;
+
+    /** @brief Menor descrição movida para a tabela em disco. */
+    static constexpr size_t MIN_SHARED_SIZE = 32;
+
+    /**
+     * @brief Instância compartilhada pelo processo (CLI e GUI).
+     * @note Nunca destruída: cards em objetos estáticos podem soltar handles depois de main()
+     */
+    static DescriptionStore& instance();
+
+    DescriptionStore() = default;
+    DescriptionStore(const DescriptionStore&) = delete;
+    DescriptionStore& operator=(const DescriptionStore&) = delete;
+
+    /**
+     * @brief Handle do corpo com este conteúdo (criado se ainda não existe).
+     * @param text Descrição
+     * @return Handle compartilhado, ou nullptr para texto vazio
+     */
+    Handle intern(std::string_view text);
+
+    /**
+     * @brief Corpos distintos em uso.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Bytes somados dos corpos distintos em uso.
+     */
+    size_t bytes() const;
+
+    /**
+     * @brief Chave de conteúdo usada em disco (16 dígitos hexadecimais).
+     */
+    static std::string hashOf(std::string_view text);
+
+    /**
+     * @brief Move descrições repetidas do workspace para state["descriptions"].
+     *
+     * Considera todo objeto com id e title (cards dos boards e dos payloads
+     * do activity log).
+     * @param state Workspace no formato de saveState()
+     */
+    static void pack(nlohmann::json& state);
+
+    /**
+     * @brief Desfaz pack(): devolve o texto aos cards e remove a tabela.
+     * @param state Workspace lido do disco (sem tabela = inalterado)
+     * @throws std::invalid_argument se um card referencia chave ausente da tabela
+     */
+    static void unpack(nlohmann::json& state);
+
+private:
+    /**
+     * @brief Remove o corpo do índice (deleter do Handle).
+     */
+    void release(const std::string* body);
+
+    mutable std::mutex m_mutex;                                    /**< @brief Protege o índice */
+    std::unordered_map<std::string_view, std::weak_ptr<const std::string>> m_bodies; /**< @brief Conteúdo → corpo */
+    size_t m_bytes { 0 };                                          /**< @brief Bytes dos corpos no índice */
+};
+
+#endif // KANBAN_LITE_DESCRIPTION_STORE_H
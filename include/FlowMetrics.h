@@ -0,0 +1,225 @@
+#ifndef KANBAN_LITE_FLOW_METRICS_H
+#define KANBAN_LITE_FLOW_METRICS_H
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "external/json.hpp"
+
+class Board;
+
+/**
+ * @file FlowMetrics.h
+ * @brief Métricas de fluxo (lead/cycle time, throughput, CFD) mantidas incrementalmente.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class FlowMetrics
+ * @brief Agregados de fluxo por board, alimentados pelos eventos de Board.
+ *
+ * Board chama os ganchos (cardAdded, cardMoved...) a cada alteração; nada
+ * é recalculado a partir do histórico. Convenções:
+ * - Início do trabalho: primeira entrada do card em coluna que não a primeira
+ * - Conclusão: entrada na última coluna do board, contada uma vez por card;
+ *   desfeita se o card sai da última coluna (reaberto ou move desfeito)
+ * - Lead time: criação → conclusão; cycle time: início → conclusão
+ * - Dias em UTC
+ *
+ * @details
+ * - Por card: criação, início, coluna atual e entrada nela
+ * - Por coluna: contagem atual e contagem ao fim de cada dia com alteração
+ * - report() custa O(dias × colunas) + ordenação das amostras concluídas
+ * - Mesmo padrão do ActivityLog: um objeto por workspace, injetado nos boards
+ * - Thread-safe: um mutex por board; ganchos de boards distintos não se
+ *   bloqueiam (o mapa de boards só é travado com exclusividade ao
+ *   acompanhar um board novo, em removeBoard() e em load())
+ */
+class FlowMetrics {
+public:
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    /**
+     * @struct Report
+     * @brief Resultado de report() para um board.
+     */
+    struct Report {
+        size_t completed { 0 };                         /**< @brief Cards concluídos */
+        std::array<double, 3> leadHours {};             /**< @brief Lead time p50/p85/p95 (horas) */
+        std::array<double, 3> cycleHours {};            /**< @brief Cycle time p50/p85/p95 (horas) */
+        long long firstDay { 0 };                       /**< @brief Primeiro dia da série (dias desde a época) */
+        std::vector<size_t> throughput;                 /**< @brief Concluídos por dia, a partir de firstDay */
+        std::vector<std::string> columns;               /**< @brief Colunas do CFD (ordem do board) */
+        std::vector<std::vector<size_t>> cfd;           /**< @brief Cards por coluna ao fim de cada dia */
+    };
+
+    /**
+     * @brief Registra board já existente (cards atuais entram na contagem).
+     *
+     * Sem efeito se o board já é acompanhado (ex.: estado carregado).
+     * Cards sem histórico usam createdAt como criação e, fora da
+     * primeira coluna, o momento atual como início.
+     *
+     * @param board Board a acompanhar
+     */
+    void track(const Board& board);
+
+    /**
+     * @brief Alinha os agregados a um board reconstruído (merge com o disco).
+     *
+     * Cards desconhecidos entram com o histórico salvo pela outra sessão
+     * (saved, formato de toJson()) ou, sem ele, como em track(); cards em
+     * outra coluna contam como movidos e cards ausentes como removidos.
+     *
+     * @param board Board resultante do merge
+     * @param saved Métricas gravadas no arquivo (objeto vazio = sem histórico)
+     */
+    void reconcile(const Board& board, const nlohmann::json& saved);
+
+    /**
+     * @brief Card entrou no board.
+     * @param board Nome do board
+     * @param cardId ID do card
+     * @param column Coluna onde entrou
+     * @param created Criação do card (Card::getCreatedAt)
+     * @param started true se a coluna não é a primeira
+     * @param done true se a coluna é a última
+     * @param when Momento do evento
+     */
+    void cardAdded(const std::string& board, const std::string& cardId, const std::string& column,
+                   TimePoint created, bool started, bool done, TimePoint when);
+
+    /**
+     * @brief Card mudou de coluna.
+     * @param board Nome do board
+     * @param cardId ID do card
+     * @param toColumn Coluna destino
+     * @param started true se o destino não é a primeira coluna
+     * @param done true se o destino é a última coluna
+     * @param when Momento do evento
+     */
+    void cardMoved(const std::string& board, const std::string& cardId, const std::string& toColumn,
+                   bool started, bool done, TimePoint when);
+
+    /**
+     * @brief Card saiu do board.
+     * @param board Nome do board
+     * @param cardId ID do card
+     * @param when Momento do evento
+     */
+    void cardRemoved(const std::string& board, const std::string& cardId, TimePoint when);
+
+    /**
+     * @brief Para de acompanhar um board (board removido).
+     * @param board Nome do board
+     */
+    void removeBoard(const std::string& board);
+
+    /**
+     * @brief Momento em que o card entrou na coluna atual.
+     * @param board Nome do board
+     * @param cardId ID do card
+     * @return Entrada na coluna, ou nullopt se desconhecida (card sem
+     *         histórico: acompanhado por track() ou estado salvo antigo)
+     */
+    std::optional<TimePoint> enteredColumn(const std::string& board, const std::string& cardId) const;
+
+    /**
+     * @brief Calcula o relatório do board.
+     * @param board Board (define a ordem das colunas do CFD)
+     * @return Relatório; vazio se o board não é acompanhado
+     */
+    Report report(const Board& board) const;
+
+    /**
+     * @brief Serializa os agregados (estado salvo junto ao workspace).
+     * @return Objeto JSON
+     */
+    nlohmann::json toJson() const;
+
+    /**
+     * @brief Substitui os agregados pelos de toJson().
+     * @param j Objeto JSON (sem "boards" = esvazia)
+     * @throws json::exception se estrutura inválida
+     */
+    void load(const nlohmann::json& j);
+
+    /**
+     * @brief Dia (UTC, desde a época) de um instante.
+     */
+    static long long dayOf(TimePoint t);
+
+private:
+    /**
+     * @struct CardFlow
+     * @brief Estado de fluxo de um card.
+     */
+    struct CardFlow {
+        TimePoint created;                              /**< @brief Criação do card */
+        TimePoint started;                              /**< @brief Início do trabalho (época = não iniciado) */
+        std::string column;                             /**< @brief Coluna atual */
+        TimePoint entered;                              /**< @brief Entrada na coluna atual (época = desconhecida) */
+    };
+
+    /**
+     * @struct Completion
+     * @brief Conclusão de um card (reversível enquanto ele está no board).
+     */
+    struct Completion {
+        TimePoint when;                                 /**< @brief Entrada na última coluna */
+        double leadHours { 0 };                         /**< @brief Criação → conclusão */
+        double cycleHours { 0 };                        /**< @brief Início → conclusão */
+    };
+
+    /**
+     * @struct BoardFlow
+     * @brief Agregados de um board.
+     */
+    struct BoardFlow {
+        std::mutex mutex;                                           /**< @brief Serializa ganchos e leituras deste board */
+        std::unordered_map<std::string, CardFlow> cards;            /**< @brief Cards no board */
+        std::unordered_map<std::string, size_t> counts;             /**< @brief Cards por coluna agora */
+        std::map<long long, std::unordered_map<std::string, size_t>> daily; /**< @brief Dia → contagens alteradas no dia */
+        std::map<long long, size_t> throughput;                     /**< @brief Dia → cards concluídos */
+        std::unordered_map<std::string, Completion> completed;      /**< @brief Card → conclusão */
+        std::vector<double> leadHours;                              /**< @brief Amostras sem card (estado salvo antigo) */
+        std::vector<double> cycleHours;                             /**< @brief Amostras sem card (estado salvo antigo) */
+    };
+
+    /**
+     * @brief Ajusta contagem da coluna e grava no dia do evento.
+     */
+    static void adjust(BoardFlow& flow, const std::string& column, long long delta, TimePoint when);
+
+    /**
+     * @brief Registra conclusão (amostras e throughput), se o card ainda não tem uma.
+     */
+    static void complete(BoardFlow& flow, const std::string& cardId, const CardFlow& card, TimePoint when);
+
+    /**
+     * @brief Desfaz a conclusão do card (saiu da última coluna).
+     */
+    static void reopen(BoardFlow& flow, const std::string& cardId);
+
+    /**
+     * @brief Executa fn(BoardFlow&) sob o mutex do board.
+     * @param board Nome do board
+     * @param create Acompanha o board se ainda não é acompanhado
+     * @param fn Alteração ou leitura
+     */
+    template <typename Fn>
+    void withBoard(const std::string& board, bool create, Fn&& fn);
+
+    mutable std::shared_mutex m_mutex;                   /**< @brief Estrutura de m_boards (compartilhado nos ganchos) */
+    std::unordered_map<std::string, std::unique_ptr<BoardFlow>> m_boards; /**< @brief Agregados por nome de board */
+};
+
+#endif // KANBAN_LITE_FLOW_METRICS_H
@@ -0,0 +1,107 @@
+#ifndef KANBAN_LITE_JSON_LINES_WRITER_H
+#define KANBAN_LITE_JSON_LINES_WRITER_H
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file JsonLinesWriter.h
+ * @brief Escrita de JSON Lines (um objeto compacto por linha) sem DOM.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class JsonLinesWriter
+ * @brief Serializa objetos JSON direto em um buffer de saída.
+ *
+ * Campos são escritos na ordem das chamadas, sem montar nlohmann::json por
+ * linha. O buffer é repassado ao ostream só quando enche (ou em flush() /
+ * no destrutor), então milhares de linhas custam poucas escritas.
+ *
+ * @details
+ * - Chaves são literais confiáveis (não são escapadas)
+ * - Strings são escapadas conforme RFC 8259; UTF-8 passa intacto
+ * - Timestamps saem em milissegundos desde a época, como em Card::toJson()
+ *
+ * @code
+ * JsonLinesWriter out(std::cout);
+ * out.beginObject().field("id", card.getId()).field("priority", card.getPriority()).endObject();
+ * @endcode
+ */
+class JsonLinesWriter {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 64 * 1024; /**< @brief Bytes acumulados antes de escrever */
+
+    /**
+     * @param out Destino (ex.: std::cout)
+     * @param bufferSize Tamanho do buffer interno
+     */
+    explicit JsonLinesWriter(std::ostream& out, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    ~JsonLinesWriter();
+
+    JsonLinesWriter(const JsonLinesWriter&) = delete;
+    JsonLinesWriter& operator=(const JsonLinesWriter&) = delete;
+
+    JsonLinesWriter& beginObject();
+
+    /**
+     * @brief Fecha o objeto e termina a linha.
+     */
+    JsonLinesWriter& endObject();
+
+    JsonLinesWriter& field(const char* key, std::string_view value);
+    JsonLinesWriter& field(const char* key, const char* value);
+    JsonLinesWriter& field(const char* key, bool value);
+    JsonLinesWriter& field(const char* key, const std::vector<std::string>& values);
+    JsonLinesWriter& field(const char* key, std::chrono::system_clock::time_point value);
+
+    /**
+     * @brief Campo numérico inteiro (qualquer tipo integral exceto bool).
+     */
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, JsonLinesWriter&>::type
+    field(const char* key, T value) {
+        appendKey(key);
+        m_buffer += std::to_string(value);
+        return *this;
+    }
+
+    /**
+     * @brief Campo null.
+     */
+    JsonLinesWriter& null(const char* key);
+
+    /**
+     * @brief Campo com JSON já serializado (copiado sem validação).
+     */
+    JsonLinesWriter& raw(const char* key, std::string_view serialized);
+
+    /**
+     * @brief Repassa o buffer ao ostream.
+     */
+    void flush();
+
+    /**
+     * @brief Linhas completas escritas até agora.
+     */
+    size_t lines() const;
+
+private:
+    void appendKey(const char* key);
+    void appendString(std::string_view value);
+    void flushIfFull();
+
+    std::ostream& m_out;                           /**< @brief Destino */
+    size_t m_capacity;                             /**< @brief Limite do buffer antes de escrever */
+    std::string m_buffer;                          /**< @brief Bytes ainda não repassados */
+    bool m_firstField { true };                    /**< @brief Próximo campo dispensa vírgula */
+    size_t m_lines { 0 };                          /**< @brief Objetos terminados */
+};
+
+#endif // KANBAN_LITE_JSON_LINES_WRITER_H
@@ -0,0 +1,152 @@
+#ifndef KANBAN_LITE_LOCAL_SOCKET_H
+#define KANBAN_LITE_LOCAL_SOCKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @file LocalSocket.h
+ * @brief Socket Unix com mensagens delimitadas por tamanho.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class LocalSocket
+ * @brief Conexão (ou listener) em socket de domínio Unix.
+ *
+ * Cada mensagem (frame) é um prefixo de 4 bytes big-endian com o tamanho
+ * seguido do conteúdo. Leituras são bufferizadas: vários frames pequenos
+ * chegam em uma única chamada ao sistema.
+ *
+ * @details
+ * - Somente movível; o descritor é fechado no destrutor
+ * - O listener remove o arquivo do socket ao ser destruído
+ * - Sem suporte em Windows: listen/connect lançam exceção
+ * @see KanbanCLI::serve
+ */
+class LocalSocket {
+public:
+    static const std::uint32_t MAX_FRAME_SIZE = 64u * 1024u * 1024u; /**< @brief Maior frame aceito */
+
+    /**
+     * @brief Cria o socket em path e passa a aceitar conexões.
+     *
+     * Um arquivo de socket abandonado (sem servidor) é substituído.
+     *
+     * @param path Caminho do socket
+     * @throws std::runtime_error se o caminho está em uso ou em falha de I/O
+     */
+    static LocalSocket listen(const std::string& path);
+
+    /**
+     * @brief Conecta ao servidor em path.
+     * @throws std::runtime_error se não há servidor escutando
+     */
+    static LocalSocket connect(const std::string& path);
+
+    LocalSocket(LocalSocket&& other) noexcept;
+    LocalSocket& operator=(LocalSocket&& other) noexcept;
+    LocalSocket(const LocalSocket&) = delete;
+    LocalSocket& operator=(const LocalSocket&) = delete;
+    ~LocalSocket();
+
+    /**
+     * @brief Aguarda a próxima conexão (listener).
+     * @throws std::runtime_error em falha de I/O
+     */
+    LocalSocket accept() const;
+
+    /**
+     * @brief Envia um frame.
+     * @return false se a conexão foi fechada
+     */
+    bool sendFrame(const std::string& payload);
+
+    /**
+     * @brief Envia vários frames em uma única escrita.
+     * @return false se a conexão foi fechada
+     */
+    bool sendFrames(const std::vector<std::string>& payloads);
+
+    /**
+     * @brief Recebe o próximo frame.
+     * @param payload Recebe o conteúdo
+     * @return false em fim de conexão, erro ou frame maior que MAX_FRAME_SIZE
+     */
+    bool receiveFrame(std::string& payload);
+
+    bool isOpen() const;
+
+private:
+    friend class LocalServer;
+
+    explicit LocalSocket(int fd, std::string unlinkPath = std::string());
+
+    bool writeAll(const char* data, size_t size);
+    bool fill(size_t needed);
+    bool hasBufferedFrame() const;
+    void close();
+
+    // Modo não bloqueante (clientes do LocalServer)
+    bool setBlocking(bool blocking);
+    bool readAvailable();
+    bool takeFrame(std::string& payload);
+    void queueFrames(const std::vector<std::string>& payloads);
+    bool flushPending();
+    bool hasPending() const;
+
+    int m_fd;                                      /**< @brief Descritor (-1 = fechado) */
+    std::string m_unlinkPath;                      /**< @brief Arquivo do socket (só no listener) */
+    std::string m_buffer;                          /**< @brief Bytes lidos ainda não consumidos */
+    size_t m_offset { 0 };                         /**< @brief Início dos bytes não consumidos */
+    std::string m_outgoing;                        /**< @brief Respostas ainda não enviadas (não bloqueante) */
+    size_t m_sent { 0 };                           /**< @brief Bytes de m_outgoing já enviados */
+    bool m_peerClosed { false };                   /**< @brief Outro lado encerrou a escrita */
+};
+
+/**
+ * @class LocalServer
+ * @brief Atende vários clientes em uma única thread.
+ *
+ * As requisições são processadas uma de cada vez, na ordem em que chegam,
+ * então o handler não precisa de sincronização. Os clientes usam sockets
+ * não bloqueantes com buffers de leitura e escrita próprios: um cliente
+ * ocioso, que envia um frame pela metade ou que lê devagar não bloqueia os
+ * demais (poll). O handler só recebe frames completos.
+ *
+ * @details
+ * - Enquanto a resposta de um cliente não foi toda enviada, as próximas
+ *   requisições dele esperam (o buffer de saída não cresce sem limite)
+ * - Ao encerrar, a última resposta é enviada por completo antes de run() retornar
+ */
+class LocalServer {
+public:
+    /**
+     * @brief Processa uma requisição.
+     * @param request Frame recebido
+     * @param reply Frames de resposta (enviados juntos)
+     * @return false para encerrar o servidor após responder
+     */
+    using Handler = std::function<bool(const std::string& request, std::vector<std::string>& reply)>;
+
+    /**
+     * @brief Escuta em path (ver LocalSocket::listen).
+     * @throws std::runtime_error se o caminho está em uso
+     */
+    explicit LocalServer(const std::string& path);
+
+    /**
+     * @brief Atende até o handler pedir para parar.
+     * @throws std::runtime_error em falha de I/O no listener
+     */
+    void run(const Handler& handler);
+
+private:
+    LocalSocket m_listener;                        /**< @brief Socket de escuta */
+};
+
+#endif // KANBAN_LITE_LOCAL_SOCKET_H
@@ -0,0 +1,52 @@
+#ifndef KANBAN_LITE_RANK_KEY_H
+#define KANBAN_LITE_RANK_KEY_H
+
+#include <string>
+
+/**
+ * @file RankKey.h
+ * @brief Chaves de ordenação fracionárias (lexicográficas) para cards.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class RankKey
+ * @brief Gera chaves de ordenação entre duas chaves existentes.
+ *
+ * Cada card guarda uma chave textual em base 62 ("0-9A-Za-z", que já
+ * está em ordem ASCII). A ordem dos cards em uma coluna é a ordem
+ * lexicográfica dessas chaves. Para reposicionar um card basta gerar uma
+ * chave entre as dos novos vizinhos: nenhum outro card é reescrito, o que
+ * torna a alteração persistida um delta de um único card.
+ *
+ * @details
+ * - Parte inteira com prefixo de comprimento: inserir no fim ou no início
+ *   repetidamente gera chaves de tamanho O(log n)
+ * - Frações nunca terminam no menor dígito ('0'), garantindo que sempre
+ *   existe espaço entre duas chaves
+ * - String vazia representa os extremos (início/fim) em between()
+ * - Classe utilitária sem estado (apenas métodos estáticos)
+ */
+class RankKey {
+public:
+    /**
+     * @brief Gera chave estritamente entre lo e hi.
+     *
+     * @param lo Chave anterior ("" = início da coluna)
+     * @param hi Chave posterior ("" = fim da coluna)
+     * @return Nova chave k com lo < k < hi
+     * @pre lo < hi quando ambos não vazios
+     * @throws std::invalid_argument se lo >= hi ou alguma chave for inválida
+     */
+    static std::string between(const std::string& lo, const std::string& hi);
+
+    /**
+     * @brief Verifica se a chave tem formato válido (cabeçalho, alfabeto base 62, fração).
+     * @param key Chave a validar
+     * @return true se a chave pode ser usada em between()
+     */
+    static bool isValid(const std::string& key);
+};
+
+#endif // KANBAN_LITE_RANK_KEY_H
@@ -0,0 +1,189 @@
+#ifndef KANBAN_LITE_SHARED_BOARD_H
+#define KANBAN_LITE_SHARED_BOARD_H
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "Board.h"
+#include "BoardSnapshot.h"
+#include "Card.h"
+#include "external/json.hpp"
+
+class BoardBatch;
+
+/**
+ * @file SharedBoard.h
+ * @brief Fachada thread-safe de Board (escritor exclusivo, leitores sobre snapshots).
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class SharedBoard
+ * @brief Board protegido por std::shared_mutex, publicado como snapshot imutável.
+ *
+ * Mutações (write() e atalhos) usam lock exclusivo apenas deste board e,
+ * ao terminar, publicam um novo BoardSnapshot. Consultas (filtros, toJson,
+ * snapshot()) leem o snapshot publicado sem lock algum: nunca esperam por
+ * escritores nem os bloqueiam. read() continua disponível para ler o
+ * Board vivo sob lock compartilhado.
+ *
+ * Os atalhos de mutação sabem o que alteraram e fazem path-copy só das
+ * colunas/cards envolvidos; write() genérico republica o board inteiro.
+ *
+ * @details
+ * - Board, Column e Card continuam sem sincronização própria
+ * - ActivityLog compartilhado entre boards escritos por threads distintas
+ *   precisa estar em modo concorrente (ActivityLog::startConcurrent)
+ * - FlowMetrics é thread-safe e pode ser compartilhado (um mutex por board:
+ *   boards distintos não disputam as métricas)
+ * - Board::checkpoint() grava no log: chame via write(), não via read()
+ */
+class SharedBoard {
+public:
+    /**
+     * @brief Assume o board (movido para dentro da fachada).
+     * @param board Board a proteger
+     */
+    explicit SharedBoard(Board board);
+
+    SharedBoard(const SharedBoard&) = delete;
+    SharedBoard& operator=(const SharedBoard&) = delete;
+
+    /**
+     * @brief Executa fn(const Board&) sob lock compartilhado.
+     * @param fn Função de leitura
+     * @return Valor retornado por fn
+     * @note Não retorne referências/ponteiros para dentro do board
+     */
+    template <typename Fn>
+    auto read(Fn&& fn) const -> decltype(fn(std::declval<const Board&>())) {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return fn(static_cast<const Board&>(m_board));
+    }
+
+    /**
+     * @brief Executa fn(Board&) sob lock exclusivo e republica o snapshot.
+     * @param fn Função de escrita
+     * @return Valor retornado por fn
+     * @note Snapshot reconstruído por inteiro (O(cards)): prefira os atalhos
+     */
+    template <typename Fn>
+    auto write(Fn&& fn) -> decltype(fn(std::declval<Board&>())) {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        Republish republish { *this }; // Também se fn lançar exceção
+        return fn(m_board);
+    }
+
+    /**
+     * @brief Versão publicada mais recente (O(1), sem lock).
+     * @return Snapshot imutável; válido enquanto for mantido
+     */
+    BoardSnapshot snapshot() const;
+
+    /**
+     * @brief Nome do board (imutável, sem lock).
+     */
+    const std::string& getName() const;
+
+    // Mutações (lock exclusivo; mesma semântica de Board)
+    bool addCard(const std::string& columnName, const Card& card, size_t position = Board::END_POSITION);
+    bool removeCard(const std::string& columnName, const std::string& cardId);
+    bool moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol,
+                  size_t position = Board::END_POSITION);
+    bool updateCard(const std::string& cardId, const std::optional<std::string>& title,
+                    const std::optional<std::string>& description,
+                    const std::optional<int>& priority);
+    bool tagCard(const std::string& cardId, const std::string& tag, bool add);
+    bool applyBatch(const BoardBatch& batch);
+
+    // Consultas sobre o snapshot publicado (sem lock; devolvem cópias)
+    std::optional<Card> findCard(const std::string& cardId) const;
+    std::vector<Card> findCardsByTag(const std::string& tag) const;
+    std::vector<Card> filterByPriority(int minPriority) const;
+    size_t cardCount() const;
+    Board copy() const;
+    nlohmann::json toJson() const;
+
+private:
+    /**
+     * @brief Republica o board inteiro ao sair de write().
+     */
+    struct Republish {
+        SharedBoard& owner;
+        ~Republish() { owner.publish(BoardSnapshot(owner.m_board)); }
+    };
+
+    /**
+     * @brief Publica a próxima versão do snapshot (lock exclusivo já obtido).
+     */
+    void publish(BoardSnapshot next);
+
+    /**
+     * @brief Path-copy das colunas/cards alterados e publicação.
+     */
+    void publishChanges(const std::unordered_set<std::string>& columns,
+                        const std::unordered_set<std::string>& cards);
+
+    /**
+     * @brief Coluna que contém o card ("" se nenhuma).
+     */
+    std::string columnOf(const std::string& cardId) const;
+
+    mutable std::shared_mutex m_mutex;             /**< @brief Escritores (e read()) do board vivo */
+    Board m_board;                                 /**< @brief Board protegido */
+    const std::string m_name;                      /**< @brief Cópia do nome, lida sem lock */
+    std::shared_ptr<const BoardSnapshot> m_snapshot; /**< @brief Versão publicada (std::atomic_load/store) */
+};
+
+/**
+ * @class SharedWorkspace
+ * @brief Conjunto de SharedBoard indexado por nome.
+ *
+ * O mapa tem lock próprio, mantido só durante a busca: escritas em boards
+ * diferentes não disputam um lock exclusivo (FlowMetrics tem um mutex por
+ * board e o ActivityLog em modo concorrente não trava produtores; o mapa
+ * de FlowMetrics só é travado com exclusividade ao acompanhar um board
+ * novo). Boards são devolvidos como
+ * shared_ptr, válidos mesmo se removidos do workspace durante o uso.
+ */
+class SharedWorkspace {
+public:
+    /**
+     * @brief Inclui board.
+     * @param board Board a incluir
+     * @return Board compartilhado ou nullptr se o nome já existe
+     */
+    std::shared_ptr<SharedBoard> add(Board board);
+
+    /**
+     * @brief Remove board pelo nome.
+     * @return true se existia
+     */
+    bool remove(const std::string& name);
+
+    /**
+     * @brief Busca board pelo nome.
+     * @return Board compartilhado ou nullptr
+     */
+    std::shared_ptr<SharedBoard> find(const std::string& name) const;
+
+    /**
+     * @brief Nomes dos boards (ordem alfabética).
+     */
+    std::vector<std::string> names() const;
+
+    size_t size() const;
+
+private:
+    mutable std::shared_mutex m_mutex;             /**< @brief Protege apenas o mapa */
+    std::unordered_map<std::string, std::shared_ptr<SharedBoard>> m_boards; /**< @brief Nome → board */
+};
+
+#endif // KANBAN_LITE_SHARED_BOARD_H
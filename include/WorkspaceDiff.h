@@ -0,0 +1,101 @@
+#ifndef KANBAN_LITE_WORKSPACE_DIFF_H
+#define KANBAN_LITE_WORKSPACE_DIFF_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Board.h"
+#include "external/json.hpp"
+
+/**
+ * @file WorkspaceDiff.h
+ * @brief Delta entre duas versões de um workspace (diff) e sua aplicação (patch).
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class WorkspaceDiff
+ * @brief Compara dois arquivos de workspace card a card e aplica o delta.
+ *
+ * Os arquivos são lidos em streaming (SAX, gzip detectado como no load):
+ * uma passada colhe a estrutura (boards e colunas) e a tabela de descrições,
+ * outra entrega os cards um a um sem montar o documento. Os cards de "from"
+ * entram em uma tabela hash pelo ID que guarda só a localização e o hash do
+ * conteúdo; os de "to" são comparados com ela ao passar (hash join). A
+ * memória cresce com o número de cards, não com o tamanho do arquivo.
+ *
+ * O delta é JSON Lines, uma operação por linha (gzip opcional):
+ * - delta / end: cabeçalho e rodapé (o rodapé traz o total de operações)
+ * - removeBoard, removeColumn, addBoard, addColumn, updateColumn (WIP e posição)
+ * - description: corpo compartilhado, antes do primeiro card que o referencia
+ * - putCard: card novo ou alterado, completo ("from" = onde estava)
+ * - removeCard: card ausente em "to" (cards de boards/colunas removidos não repetem)
+ *
+ * @details
+ * - Board identificado pelo ID; coluna pelo nome dentro do board (renomear = remover + adicionar)
+ * - Conteúdo comparado pelo FNV-1a de 64 bits do JSON do card, com a descrição resolvida
+ * - apply() valida o delta inteiro antes de alterar o workspace e retira os
+ *   cards alterados antes de reinseri-los (limites WIP de "to" são respeitados)
+ */
+class WorkspaceDiff {
+public:
+    static constexpr int FORMAT_VERSION = 1;          /**< @brief Versão do formato do delta */
+
+    /**
+     * @struct Summary
+     * @brief Operações por tipo.
+     */
+    struct Summary {
+        size_t boardsAdded { 0 };                  /**< @brief addBoard */
+        size_t boardsRemoved { 0 };                /**< @brief removeBoard */
+        size_t columnsAdded { 0 };                 /**< @brief addColumn */
+        size_t columnsChanged { 0 };               /**< @brief updateColumn */
+        size_t columnsRemoved { 0 };               /**< @brief removeColumn */
+        size_t cardsAdded { 0 };                   /**< @brief putCard sem "from" */
+        size_t cardsChanged { 0 };                 /**< @brief putCard com "from" */
+        size_t cardsRemoved { 0 };                 /**< @brief removeCard */
+
+        /**
+         * @brief Total de operações (sem cabeçalho, rodapé e descrições).
+         */
+        size_t operations() const;
+    };
+
+    /**
+     * @struct PatchResult
+     * @brief Resultado de apply().
+     */
+    struct PatchResult {
+        Summary applied;                           /**< @brief Operações aplicadas */
+        std::vector<std::string> skipped;          /**< @brief Operações que não couberam no workspace, com o motivo */
+    };
+
+    /** @brief Recebe cada operação do delta, na ordem do arquivo. */
+    using Sink = std::function<void(const nlohmann::json& op)>;
+
+    /**
+     * @brief Calcula o delta de um workspace para outro.
+     * @param fromFile Workspace de origem (texto ou gzip)
+     * @param toFile Workspace de destino (texto ou gzip)
+     * @param sink Recebe as operações, do cabeçalho ao rodapé
+     * @return Contagem das operações emitidas
+     * @throws std::runtime_error se um arquivo não abre ou não é um workspace válido
+     */
+    static Summary diff(const std::string& fromFile, const std::string& toFile, const Sink& sink);
+
+    /**
+     * @brief Aplica um delta aos boards em memória.
+     * @param deltaFile Arquivo gerado a partir de diff() (texto ou gzip)
+     * @param boards Boards do workspace
+     * @param attach Chamado para cada board criado pelo delta (log, métricas)
+     * @return Operações aplicadas e as que foram ignoradas
+     * @throws std::runtime_error se o delta está truncado ou malformado (nada é alterado)
+     */
+    static PatchResult apply(const std::string& deltaFile, std::vector<std::unique_ptr<Board>>& boards,
+                             const std::function<void(Board&)>& attach);
+};
+
+#endif // KANBAN_LITE_WORKSPACE_DIFF_H
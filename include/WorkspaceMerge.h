@@ -0,0 +1,89 @@
+#ifndef KANBAN_LITE_WORKSPACE_MERGE_H
+#define KANBAN_LITE_WORKSPACE_MERGE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "external/json.hpp"
+
+class ActivityLog;
+class Board;
+class FlowMetrics;
+
+/**
+ * @file WorkspaceMerge.h
+ * @brief Merge de três vias dos boards de um workspace ao salvar.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @class WorkspaceMerge
+ * @brief Combina o estado em memória com o que outro processo salvou.
+ *
+ * Entradas são arrays de boards no formato de Board::toJson():
+ * - base: como estavam ao carregar/salvar pela última vez
+ * - ours: estado atual deste processo
+ * - theirs: o que está no arquivo agora
+ *
+ * A unidade de conflito é o card. Um card alterado só de um lado fica com
+ * a versão alterada; alterado dos dois lados (de formas diferentes) é
+ * conflito e a versão do disco prevalece. Cards sem conflito nunca são
+ * rejeitados. A versão (getVersion) decide se algo mudou: board/coluna/card
+ * com a mesma versão da base não foi tocado.
+ *
+ * @details
+ * - Board inalterado em disco: fica o nosso, sem olhar cards
+ * - Board/coluna removidos de um lado e intocados do outro: removidos
+ * - Limites WIP: card nosso que não cabe mais na coluna é conflito
+ */
+class WorkspaceMerge {
+public:
+    /**
+     * @struct Result
+     * @brief Resultado de merge().
+     */
+    struct Result {
+        nlohmann::json boards = nlohmann::json::array(); /**< @brief Boards combinados */
+        std::vector<std::string> conflicts;         /**< @brief "board/card" (ou "board") rejeitados deste lado */
+        size_t fromDisk { 0 };                      /**< @brief Alterações trazidas do disco */
+    };
+
+    /**
+     * @brief Merge de três vias.
+     * @param base Boards da última leitura/gravação
+     * @param ours Boards em memória
+     * @param theirs Boards no arquivo
+     * @return Boards combinados, conflitos e contagem do que veio do disco
+     * @throws json::exception se algum board estiver malformado
+     */
+    static Result merge(const nlohmann::json& base, const nlohmann::json& ours, const nlohmann::json& theirs);
+
+    /**
+     * @brief Substitui os boards em memória pelos do merge (CLI e GUI).
+     *
+     * Cards e movimentos da outra sessão entram nas métricas antes de anexar
+     * cada board (FlowMetrics::reconcile, com o histórico salvo no arquivo);
+     * boards que saíram deixam de ser acompanhados e cada board recebe um
+     * checkpoint, para o replay partir do estado mesclado.
+     *
+     * @param merged Result::boards
+     * @param diskMetrics "flowMetrics" do arquivo (objeto vazio se ausente)
+     * @param boards Boards em memória (substituídos)
+     * @param log Log anexado aos boards (pode ser nulo)
+     * @param metrics Métricas do workspace
+     * @throws json::exception se algum board estiver malformado
+     */
+    static void adopt(const nlohmann::json& merged, const nlohmann::json& diskMetrics,
+                      std::vector<std::unique_ptr<Board>>& boards, ActivityLog* log, FlowMetrics& metrics);
+
+private:
+    /**
+     * @brief Merge card a card de um board alterado dos dois lados.
+     */
+    static nlohmann::json mergeBoard(const nlohmann::json* base, const nlohmann::json& ours,
+                                     const nlohmann::json& theirs, Result& result);
+};
+
+#endif // KANBAN_LITE_WORKSPACE_MERGE_H
@@ -1,4 +1,21 @@
 #include "ActivityLog.h"
+#include "BoardSnapshot.h"
+#include "Column.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
 
 using json = nlohmann::json;
 
@@ -9,46 +26,1356 @@ using json = nlohmann::json;
  * @date 01/10/2025
  */
 
+namespace {
+
+constexpr char kIndexFile[] = "index.jsonl";
+constexpr char kLeaseFile[] = "lease";
+
+// Nomes persistidos dos tipos (mesma ordem de ActivityType)
+constexpr const char* kTypeNames[] = {
+    "custom", "column_added", "column_removed", "card_added",
+    "card_removed", "card_moved", "card_reordered", "batch_applied",
+    "card_updated", "board_checkpoint", "column_moved", "column_wip_changed"
+};
+constexpr size_t kTypeCount = sizeof(kTypeNames) / sizeof(kTypeNames[0]);
+
+/**
+ * @brief Converte timestamp em milissegundos desde a época.
+ */
+long long toMillis(const std::chrono::system_clock::time_point& t) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+}
+
 /**
- * @brief Registra uma nova atividade no log.
+ * @brief Converte milissegundos desde a época em timestamp.
+ */
+std::chrono::system_clock::time_point fromMillis(long long ms) {
+    return std::chrono::system_clock::time_point(std::chrono::milliseconds(ms));
+}
+
+/**
+ * @brief Payload JSON (formato lido por BoardReplay) dos dados tipados.
+ */
+json detailToJson(const ActivityDetail& detail) {
+    if (detail.board) {
+        return detail.board->toJson();
+    }
+    json payload;
+    if (detail.card) {
+        payload["card"] = detail.card->toJson();
+    }
+    if (detail.column) {
+        payload["column"] = detail.column->toJson();
+    }
+    if (detail.hasPosition) {
+        payload["position"] = detail.position;
+    }
+    if (detail.change) {
+        const ActivityCardChange& change = *detail.change;
+        payload = json::object();
+        if (change.title) {
+            payload["title"] = *change.title;
+        }
+        if (change.description) {
+            payload["description"] = *change.description;
+        }
+        if (change.priority) {
+            payload["priority"] = *change.priority;
+        }
+        if (!change.tag.empty()) {
+            payload[change.tagAdded ? "addTags" : "removeTags"] = json::array({change.tag});
+        }
+    }
+    if (detail.hasWipLimit) {
+        payload["wipLimit"] = detail.wipLimit;
+    }
+    return payload;
+}
+
+/**
+ * @brief Nome do arquivo do n-ésimo segmento (1-based).
+ */
+std::string segmentFileName(size_t number) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "segment-%06zu.jsonl", number);
+    return name;
+}
+
+} // namespace
+
+/**
+ * @struct ActivityLog::Concurrent
+ * @brief Fila MPSC intrusiva (Vyukov) e thread consumidora do modo concorrente.
+ * 
+ * Produtores fazem um único exchange em m_head e ligam o nó anterior ao
+ * novo; a ordem dos exchanges é a ordem total do log. Só o consumidor
+ * mexe em tail.
+ */
+struct ActivityLog::Concurrent {
+    struct Node {
+        std::atomic<Node*> next { nullptr };
+        TimePoint timestamp;
+        ActivityType type { ActivityType::Custom };
+        std::string board, column, card, target, text;
+        std::array<std::uint32_t, 3> counts {};
+        json payload;
+        ActivityDetail detail;
+    };
+
+    Node stub;                                     // Sentinela: fila nunca fica sem nós
+    std::atomic<Node*> head { &stub };             // Último nó enfileirado (produtores)
+    Node* tail { &stub };                          // Próximo a consumir (consumidor)
+    std::atomic<std::uint64_t> enqueued { 0 };
+    std::uint64_t applied { 0 };                   // Protegido por mutex
+    std::atomic<bool> stopping { false };
+    std::mutex mutex;                              // Consumidor gravando × leitores
+    std::mutex namesMutex;                         // intern()/release() × name()
+    std::condition_variable drained;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::thread consumer;
+
+    void push(Node* node) {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node* previous = head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    // Retorna nullptr se vazia ou se um produtor ainda não ligou seu nó
+    Node* pop() {
+        Node* first = tail;
+        Node* next = first->next.load(std::memory_order_acquire);
+        if (first == &stub) {
+            if (!next) {
+                return nullptr;
+            }
+            tail = next;
+            first = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            tail = next;
+            return first;
+        }
+        if (first != head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        push(&stub);
+        next = first->next.load(std::memory_order_acquire);
+        if (next) {
+            tail = next;
+            return first;
+        }
+        return nullptr;
+    }
+
+    ~Concurrent() {
+        while (Node* node = pop()) {
+            delete node;
+        }
+    }
+};
+
+/**
+ * @struct ActivityLog::SpillLease
+ * @brief Descritor com flock exclusivo do diretório de spill (liberado ao fechar).
+ */
+struct ActivityLog::SpillLease {
+    int fd { -1 };
+    ~SpillLease() {
+#ifndef _WIN32
+        if (fd >= 0) ::close(fd);
+#endif
+    }
+};
+
+/**
+ * @brief Construtor.
+ * @param capacity Máximo de entradas em memória
+ * @param segmentEntries Entradas por segmento em disco
+ */
+ActivityLog::ActivityLog(size_t capacity, size_t segmentEntries)
+    : m_entries(std::max<size_t>(capacity, 1)),
+      m_names{std::string()},
+      m_nameIds{{std::string(), 0}},
+      m_nameRefs{0},
+      m_segmentEntries(std::max<size_t>(segmentEntries, 1))
+{
+}
+
+ActivityLog::~ActivityLog() {
+    stopConcurrent();
+}
+
+ActivityLog::ActivityLog(ActivityLog&& other) noexcept = default;
+ActivityLog& ActivityLog::operator=(ActivityLog&& other) noexcept = default;
+
+/**
+ * @brief Registra uma nova atividade (texto livre) no log.
  * @param event Descrição do evento a ser registrado
  */
 void ActivityLog::record(const std::string& event) {
-    ActivityEntry entry;
-    entry.timestamp = std::chrono::system_clock::now();
-    entry.message = event;
-    m_entries.push_back(entry);  // Removido std::move - deixa o compilador otimizar
+    static const std::string none;
+    submit(ActivityType::Custom, none, none, none, none, {}, event, json(), ActivityDetail());
+}
+
+/**
+ * @brief Registra evento estruturado.
+ * @param type Tipo do evento
+ * @param board Nome do board
+ * @param column Coluna (origem em movimentações)
+ * @param card ID do card
+ * @param target Coluna destino
+ * @param payload Dados para replay
+ */
+void ActivityLog::record(ActivityType type, const std::string& board, const std::string& column,
+                         const std::string& card, const std::string& target, const json& payload) {
+    static const std::string none;
+    submit(type, board, column, card, target, {}, none, payload, ActivityDetail());
+}
+
+/**
+ * @brief Registra evento estruturado com dados de replay tipados.
+ * @param type Tipo do evento
+ * @param board Nome do board
+ * @param column Coluna (origem em movimentações)
+ * @param card ID do card
+ * @param target Coluna destino
+ * @param detail Posição e estado compartilhado
+ */
+void ActivityLog::record(ActivityType type, const std::string& board, const std::string& column,
+                         const std::string& card, const std::string& target, ActivityDetail detail) {
+    static const std::string none;
+    submit(type, board, column, card, target, {}, none, json(), std::move(detail));
+}
+
+/**
+ * @brief Registra aplicação de lote.
+ * @param board Nome do board
+ * @param added Cards adicionados
+ * @param moved Cards movidos
+ * @param tagChanges Alterações de tag
+ * @param operations Operações do lote
+ */
+void ActivityLog::recordBatch(const std::string& board, std::uint32_t added, std::uint32_t moved,
+                              std::uint32_t tagChanges, json operations) {
+    static const std::string none;
+    submit(ActivityType::BatchApplied, board, none, none, none, {added, moved, tagChanges}, none,
+           std::move(operations), ActivityDetail());
+}
+
+/**
+ * @brief Grava direto ou, no modo concorrente, enfileira para o consumidor.
+ */
+void ActivityLog::submit(ActivityType type, const std::string& board, const std::string& column,
+                         const std::string& card, const std::string& target,
+                         const std::array<std::uint32_t, 3>& counts, const std::string& text,
+                         json payload, ActivityDetail detail) {
+    TimePoint now = std::chrono::system_clock::now();
+    if (!m_concurrent) {
+        write(now, type, board, column, card, target, counts, text, std::move(payload), std::move(detail));
+        return;
+    }
+
+    auto* node = new Concurrent::Node;
+    node->timestamp = now;
+    node->type = type;
+    node->board = board;
+    node->column = column;
+    node->card = card;
+    node->target = target;
+    node->text = text;
+    node->counts = counts;
+    node->payload = std::move(payload);
+    node->detail = std::move(detail);
+    m_concurrent->enqueued.fetch_add(1, std::memory_order_relaxed);
+    m_concurrent->push(node);
+    m_concurrent->wake.notify_one();
+}
+
+/**
+ * @brief Preenche o próximo slot do buffer.
+ * 
+ * Slots são reaproveitados: strings e IDs são atribuídos no lugar, sem
+ * alocar depois que o buffer aquece.
+ */
+void ActivityLog::write(TimePoint timestamp, ActivityType type, const std::string& board,
+                        const std::string& column, const std::string& card, const std::string& target,
+                        const std::array<std::uint32_t, 3>& counts, const std::string& text,
+                        json payload, ActivityDetail detail) {
+    // Mantém timestamps monotônicos na ordem do log (busca binária em between())
+    if (m_size > 0 && timestamp < at(m_size - 1).timestamp) {
+        timestamp = at(m_size - 1).timestamp;
+    }
+
+    // Interna antes de liberar o slot: nome repetido não sai e volta da tabela
+    std::uint32_t boardId = intern(board);
+    std::uint32_t columnId = intern(column);
+    std::uint32_t cardId = intern(card);
+    std::uint32_t targetId = intern(target);
+
+    ActivityEvent& slot = nextSlot(timestamp);
+    slot.sequence = m_nextSequence++;
+    slot.type = type;
+    slot.board = boardId;
+    slot.column = columnId;
+    slot.card = cardId;
+    slot.target = targetId;
+    slot.counts = counts;
+    slot.text = text;
+    slot.payload = std::move(payload);
+    slot.detail = std::move(detail);
+}
+
+/**
+ * @brief Ativa o modo concorrente.
+ */
+void ActivityLog::startConcurrent() {
+    if (m_concurrent) {
+        return;
+    }
+    m_concurrent = std::make_unique<Concurrent>();
+    m_concurrent->consumer = std::thread(&ActivityLog::consume, this);
+}
+
+/**
+ * @brief Drena a fila, encerra o consumidor e volta ao modo monothread.
+ */
+void ActivityLog::stopConcurrent() {
+    if (!m_concurrent) {
+        return;
+    }
+    m_concurrent->stopping.store(true, std::memory_order_release);
+    m_concurrent->wake.notify_one();
+    m_concurrent->consumer.join();
+    m_concurrent.reset();
+}
+
+bool ActivityLog::isConcurrent() const {
+    return m_concurrent != nullptr;
+}
+
+/**
+ * @brief Aguarda o consumidor gravar tudo o que já foi enfileirado.
+ */
+void ActivityLog::drain() {
+    if (!m_concurrent) {
+        return;
+    }
+    Concurrent& concurrent = *m_concurrent;
+    std::uint64_t target = concurrent.enqueued.load(std::memory_order_acquire);
+    concurrent.wake.notify_one();
+
+    std::unique_lock<std::mutex> lock(concurrent.mutex);
+    concurrent.drained.wait(lock, [&] { return concurrent.applied >= target; });
+}
+
+/**
+ * @brief Laço do consumidor: drena a fila em lotes e grava no buffer.
+ */
+void ActivityLog::consume() {
+    Concurrent& concurrent = *m_concurrent;
+    const size_t maxBatch = 256; // Limita o tempo em que leitores ficam bloqueados
+
+    for (;;) {
+        bool stopping = concurrent.stopping.load(std::memory_order_acquire);
+        size_t consumed = 0;
+        {
+            std::lock_guard<std::mutex> lock(concurrent.mutex);
+            while (consumed < maxBatch) {
+                Concurrent::Node* node = concurrent.pop();
+                if (!node) {
+                    break;
+                }
+                try {
+                    write(node->timestamp, node->type, node->board, node->column, node->card,
+                          node->target, node->counts, node->text, std::move(node->payload),
+                          std::move(node->detail));
+                } catch (...) {
+                    // Exceção não pode escapar da thread; flush() a relança
+                    if (!m_error) {
+                        m_error = std::current_exception();
+                    }
+                }
+                delete node;
+                ++consumed;
+            }
+            concurrent.applied += consumed;
+        }
+
+        if (consumed > 0) {
+            concurrent.drained.notify_all();
+            continue;
+        }
+        if (stopping && concurrent.applied == concurrent.enqueued.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // Fila vazia (ou produtor no meio do push): espera curta; produtores só notificam
+        std::unique_lock<std::mutex> lock(concurrent.wakeMutex);
+        concurrent.wake.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+/**
+ * @brief Lock do consumidor para leituras.
+ * @return Lock adquirido, ou vazio fora do modo concorrente
+ */
+std::unique_lock<std::mutex> ActivityLog::readLock() const {
+    return m_concurrent ? std::unique_lock<std::mutex>(m_concurrent->mutex)
+                        : std::unique_lock<std::mutex>();
+}
+
+/**
+ * @brief Lock da tabela de nomes.
+ * @return Lock adquirido, ou vazio fora do modo concorrente
+ */
+std::unique_lock<std::mutex> ActivityLog::namesLock() const {
+    return m_concurrent ? std::unique_lock<std::mutex>(m_concurrent->namesMutex)
+                        : std::unique_lock<std::mutex>();
+}
+
+/**
+ * @brief Monta a mensagem legível do evento.
+ * @param event Evento a formatar
+ * @return Mensagem
+ */
+std::string ActivityLog::format(const ActivityEvent& event) const {
+    const std::string board = name(event.board);
+    const std::string column = name(event.column);
+    const std::string card = name(event.card);
+
+    switch (event.type) {
+    case ActivityType::ColumnAdded:
+        return "Column '" + column + "' added to board '" + board + "'";
+    case ActivityType::ColumnRemoved:
+        return "Column '" + column + "' removed from board '" + board + "'";
+    case ActivityType::CardAdded:
+        return "Card '" + card + "' added to column '" + column + "' in board '" + board + "'";
+    case ActivityType::CardRemoved:
+        return "Card '" + card + "' removed from column '" + column + "' in board '" + board + "'";
+    case ActivityType::CardMoved:
+        return "Card '" + card + "' moved from '" + column + "' to '" + name(event.target) +
+               "' in board '" + board + "'";
+    case ActivityType::CardReordered:
+        return "Card '" + card + "' reordered in column '" + column + "' in board '" + board + "'";
+    case ActivityType::BatchApplied:
+        return "Batch applied to board '" + board + "': " +
+               std::to_string(event.counts[0]) + " card(s) added, " +
+               std::to_string(event.counts[1]) + " moved, " +
+               std::to_string(event.counts[2]) + " tag change(s)";
+    case ActivityType::CardUpdated:
+        return "Card '" + card + "' updated in board '" + board + "'";
+    case ActivityType::BoardCheckpoint:
+        return "Checkpoint of board '" + board + "'";
+    case ActivityType::ColumnMoved:
+        return "Column '" + column + "' moved to position " +
+               std::to_string(payload(event).value("position", std::uint64_t(0))) + " in board '" + board + "'";
+    case ActivityType::ColumnWipChanged: {
+        int wipLimit = event.detail.hasWipLimit ? event.detail.wipLimit : payload(event).value("wipLimit", -1);
+        return "WIP limit of column '" + column + "' in board '" + board + "' set to " +
+               (wipLimit == -1 ? std::string("none") : std::to_string(wipLimit));
+    }
+    case ActivityType::Custom:
+        break;
+    }
+    return event.text;
+}
+
+/**
+ * @brief Nome de um ID internado.
+ * @param id ID internado
+ * @return Nome ou "" se desconhecido
+ */
+std::string ActivityLog::name(std::uint32_t id) const {
+    auto lock = namesLock();
+    return id < m_names.size() ? m_names[id] : std::string();
+}
+
+/**
+ * @brief Interna um nome (mais uma referência se já existe).
+ * @param value Nome
+ * @return ID (0 para "")
+ */
+std::uint32_t ActivityLog::intern(const std::string& value) {
+    auto lock = namesLock();
+    auto it = m_nameIds.find(value);
+    if (it != m_nameIds.end()) {
+        ++m_nameRefs[it->second];
+        return it->second;
+    }
+
+    std::uint32_t id;
+    if (!m_freeNames.empty()) {
+        id = m_freeNames.back();
+        m_freeNames.pop_back();
+        m_names[id] = value;
+    } else {
+        id = static_cast<std::uint32_t>(m_names.size());
+        m_names.push_back(value);
+        m_nameRefs.push_back(0);
+    }
+    m_nameRefs[id] = 1;
+    m_nameIds.emplace(value, id);
+    return id;
+}
+
+/**
+ * @brief Solta uma referência; o nome sai da tabela com a última.
+ * @param id ID internado (0 nunca sai)
+ */
+void ActivityLog::release(std::uint32_t id) {
+    if (id == 0) {
+        return;
+    }
+    auto lock = namesLock();
+    if (--m_nameRefs[id] > 0) {
+        return;
+    }
+    m_nameIds.erase(m_names[id]);
+    m_names[id].clear();
+    m_freeNames.push_back(id);
+}
+
+/**
+ * @brief Libera o próximo slot do buffer circular.
+ * @param timestamp Momento do novo evento
+ * @return Slot a preencher
+ */
+ActivityEvent& ActivityLog::nextSlot(std::chrono::system_clock::time_point timestamp) {
+    if (m_size < m_entries.size()) {
+        ActivityEvent& slot = m_entries[(m_head + m_size) % m_entries.size()];
+        ++m_size;
+        slot.timestamp = timestamp;
+        return slot;
+    }
+
+    // Buffer cheio: o evento mais antigo vai para o disco (ou é descartado)
+    if (!m_spillDirectory.empty()) {
+        spill(m_entries[m_head]);
+    }
+    ActivityEvent& slot = m_entries[m_head];
+    release(slot.board);
+    release(slot.column);
+    release(slot.card);
+    release(slot.target);
+    m_head = (m_head + 1) % m_entries.size();
+    slot.timestamp = timestamp;
+    return slot;
+}
+
+/**
+ * @brief Serializa evento: mensagem formatada e, se estruturado, seus campos.
+ * @param event Evento
+ * @param withPayload false = omite o payload (checkpoints superados em toJson())
+ * @return Objeto JSON (formato de toJson() e dos segmentos)
+ */
+json ActivityLog::eventToJson(const ActivityEvent& event, bool withPayload) const {
+    json j = {
+        {"timestamp", toMillis(event.timestamp)},
+        {"sequence", event.sequence},
+        {"message", format(event)}
+    };
+    if (event.type != ActivityType::Custom) {
+        j["type"] = typeName(event.type);
+        j["board"] = name(event.board);
+        if (event.column) j["column"] = name(event.column);
+        if (event.card) j["card"] = name(event.card);
+        if (event.target) j["target"] = name(event.target);
+        if (event.type == ActivityType::BatchApplied) j["counts"] = event.counts;
+        if (withPayload) {
+            json data = payload(event);
+            if (!data.is_null()) j["payload"] = std::move(data);
+        }
+    }
+    return j;
+}
+
+/**
+ * @brief Payload do evento: o lido do disco ou o montado dos dados tipados.
+ * @param event Evento deste log
+ * @return Payload ou null
+ */
+json ActivityLog::payload(const ActivityEvent& event) const {
+    if (event.type == ActivityType::Custom) {
+        return json();
+    }
+    return event.payload.is_null() ? detailToJson(event.detail) : event.payload;
+}
+
+/**
+ * @brief Nome persistido do tipo.
+ * @param type Tipo do evento
+ * @return Nome usado em "type"
+ */
+const char* ActivityLog::typeName(ActivityType type) {
+    return kTypeNames[static_cast<size_t>(type)];
+}
+
+/**
+ * @brief Reconstrói evento de JSON e o insere no buffer.
+ * @param j Entrada no formato de eventToJson() (ou apenas timestamp + message)
+ */
+void ActivityLog::appendJson(const json& j) {
+    size_t type = 0;
+    if (j.contains("type")) {
+        std::string typeName = j["type"].get<std::string>();
+        while (type < kTypeCount && typeName != kTypeNames[type]) {
+            ++type;
+        }
+        if (type == kTypeCount) {
+            type = 0; // Tipo desconhecido (versão mais nova): preserva a mensagem
+        }
+    }
+
+    std::uint32_t boardId = intern(j.value("board", std::string()));
+    std::uint32_t columnId = intern(j.value("column", std::string()));
+    std::uint32_t cardId = intern(j.value("card", std::string()));
+    std::uint32_t targetId = intern(j.value("target", std::string()));
+
+    // Reconstrução do timestamp
+    ActivityEvent& slot = nextSlot(fromMillis(j["timestamp"].get<long long>()));
+    slot.sequence = j.value("sequence", m_nextSequence);
+    m_nextSequence = std::max(m_nextSequence, slot.sequence + 1);
+    slot.type = static_cast<ActivityType>(type);
+    slot.board = boardId;
+    slot.column = columnId;
+    slot.card = cardId;
+    slot.target = targetId;
+    slot.counts = {};
+    if (j.contains("counts") && j["counts"].is_array() && j["counts"].size() == 3) {
+        slot.counts = j["counts"].get<std::array<std::uint32_t, 3>>();
+    }
+    slot.text = slot.type == ActivityType::Custom ? j.value("message", std::string()) : std::string();
+    slot.payload = j.contains("payload") ? j["payload"] : json();
+    slot.detail = ActivityDetail();
+}
+
+/**
+ * @brief Grava evento no segmento ativo.
+ *
+ * Roda no caminho de cada gravação (ou no consumidor): não comprime nem
+ * lança. Uma falha de escrita perde só este evento da trilha e fica
+ * guardada para o próximo flush().
+ *
+ * @param event Evento removido do buffer
+ */
+void ActivityLog::spill(const ActivityEvent& event) noexcept {
+    try {
+        spillEvent(event);
+    } catch (...) {
+        m_segmentStream.close();
+        m_segmentStream.clear();
+        if (!m_error) {
+            m_error = std::current_exception();
+        }
+    }
+}
+
+/**
+ * @brief Acrescenta o evento ao segmento ativo e sela o segmento se completo.
+ * @param event Evento removido do buffer
+ * @throws std::runtime_error em falha de escrita
+ */
+void ActivityLog::spillEvent(const ActivityEvent& event) {
+    namespace fs = std::filesystem;
+
+    if (m_segments.empty() || m_segments.back().sealed) {
+        Segment segment;
+        segment.file = segmentFileName(m_segments.size() + 1);
+        segment.first = event.timestamp;
+        m_segments.push_back(segment);
+    }
+    Segment& active = m_segments.back();
+
+    if (!m_segmentStream.is_open()) {
+        m_segmentStream.open(fs::path(m_spillDirectory) / active.file, std::ios::app);
+        if (!m_segmentStream) {
+            throw std::runtime_error("Could not open activity segment '" + active.file + "'");
+        }
+    }
+
+    m_segmentStream << eventToJson(event).dump() << '\n';
+    if (!m_segmentStream) {
+        throw std::runtime_error("Could not write activity segment '" + active.file + "'");
+    }
+    active.last = event.timestamp;
+    active.lastSequence = event.sequence;
+    ++active.count;
+    ++m_spilledCount;
+    m_spilledThrough = event.sequence;
+
+    if (active.count >= m_segmentEntries) {
+        // Sela o segmento: fecha o arquivo e registra no índice temporal (comprime no flush())
+        m_segmentStream.close();
+        active.sealed = true;
+        active.compressPending = true;
+
+        std::ofstream index(fs::path(m_spillDirectory) / kIndexFile, std::ios::app);
+        index << json{
+            {"file", active.file},
+            {"first", toMillis(active.first)},
+            {"last", toMillis(active.last)},
+            {"count", active.count},
+            {"lastSequence", active.lastSequence}
+        }.dump() << '\n';
+    }
+}
+
+/**
+ * @brief Regrava o índice temporal (arquivo temporário + rename).
+ * @throws std::runtime_error se o índice não puder ser gravado
+ */
+void ActivityLog::writeIndex() const {
+    namespace fs = std::filesystem;
+
+    fs::path path = fs::path(m_spillDirectory) / kIndexFile;
+    fs::path temporary = path.string() + ".tmp";
+    {
+        std::ofstream index(temporary, std::ios::trunc);
+        for (const auto& segment : m_segments) {
+            if (!segment.sealed) {
+                continue;
+            }
+            index << json{
+                {"file", segment.file},
+                {"first", toMillis(segment.first)},
+                {"last", toMillis(segment.last)},
+                {"count", segment.count},
+                {"lastSequence", segment.lastSequence}
+            }.dump() << '\n';
+        }
+        if (!index) {
+            throw std::runtime_error("Could not write activity index '" + temporary.string() + "'");
+        }
+    }
+    std::error_code error;
+    fs::rename(temporary, path, error);
+    if (error) {
+        throw std::runtime_error("Could not replace activity index '" + path.string() + "': " +
+                                 error.message());
+    }
 }
 
 /**
- * @brief Retorna todas as entradas do log de atividades.
- * @return Cópia do vetor contendo todas as entradas de atividade
+ * @brief Descarta a cauda da trilha em disco que o workspace salvo não conhece.
+ *
+ * Entradas saem do buffer (e vão para o disco) durante a sessão, não no
+ * save; uma sessão encerrada sem salvar deixa em disco entradas que o
+ * arquivo não tem, e a próxima sessão gravaria de novo as mesmas
+ * sequências. Segmentos inteiros além da marca são apagados; o que a
+ * atravessa é regravado em texto e volta a ser o segmento ativo.
+ *
+ * @param through Última sequência em disco quando o workspace foi salvo
+ */
+void ActivityLog::truncateSpilled(std::uint64_t through) {
+    namespace fs = std::filesystem;
+
+    size_t keep = 0;
+    while (keep < m_segments.size() && m_segments[keep].lastSequence <= through) {
+        ++keep;
+    }
+    if (keep == m_segments.size()) {
+        return;
+    }
+    m_segmentStream.close();
+
+    Segment cut = m_segments[keep];
+    fs::path cutPath = fs::path(m_spillDirectory) / cut.file;
+    std::vector<std::string> lines;
+    cut.count = 0;
+    cut.lastSequence = 0;
+    {
+        CompressedIFStream file(cutPath.string());
+        std::string line;
+        while (std::getline(file, line)) {
+            json j = json::parse(line, nullptr, false);
+            if (j.is_discarded() || j.value("sequence", std::uint64_t(0)) > through) {
+                continue;
+            }
+            auto timestamp = fromMillis(j.value("timestamp", 0LL));
+            if (cut.count == 0) {
+                cut.first = timestamp;
+            }
+            cut.last = timestamp;
+            cut.lastSequence = j.value("sequence", std::uint64_t(0));
+            ++cut.count;
+            lines.push_back(std::move(line));
+        }
+    }
+
+    std::error_code error;
+    for (size_t i = keep; i < m_segments.size(); ++i) {
+        fs::remove(fs::path(m_spillDirectory) / m_segments[i].file, error);
+    }
+    m_segments.resize(keep);
+    if (cut.count > 0) {
+        std::ofstream file(cutPath, std::ios::trunc);
+        for (const auto& line : lines) {
+            file << line << '\n';
+        }
+        if (!file) {
+            throw std::runtime_error("Could not rewrite activity segment '" + cut.file + "'");
+        }
+        cut.sealed = false;
+        cut.compressPending = false;
+        m_segments.push_back(std::move(cut));
+    }
+    writeIndex();
+
+    m_spilledCount = 0;
+    for (const auto& segment : m_segments) {
+        m_spilledCount += segment.count;
+    }
+    m_spilledThrough = m_segments.empty() ? 0 : m_segments.back().lastSequence;
+}
+
+/**
+ * @brief Leva a trilha deste log para o diretório recém-anexado.
+ *
+ * O diretório pode guardar a trilha de outro workspace salvo antes com o
+ * mesmo nome: ela é substituída pelos segmentos deste log (copiados do
+ * diretório anterior, que continua intacto para o arquivo antigo).
+ *
+ * @param previous Diretório anterior ("" se nada foi gravado em disco)
+ * @throws std::runtime_error se um segmento não puder ser copiado
+ */
+void ActivityLog::adoptSpilled(const std::string& previous) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    for (const auto& entry : fs::directory_iterator(m_spillDirectory, error)) {
+        std::string file = entry.path().filename().string();
+        if (file == kIndexFile || file.rfind("segment-", 0) == 0) {
+            fs::remove(entry.path(), error);
+        }
+    }
+
+    for (const auto& segment : m_segments) {
+        fs::copy_file(fs::path(previous) / segment.file, fs::path(m_spillDirectory) / segment.file,
+                      fs::copy_options::overwrite_existing, error);
+        if (error) {
+            throw std::runtime_error("Could not copy activity segment '" + segment.file + "': " +
+                                     error.message());
+        }
+    }
+    writeIndex();
+}
+
+/**
+ * @brief Desanexa o diretório de spill (trilha em disco fica intacta).
+ */
+void ActivityLog::detachSpill() {
+    m_segmentStream.close();
+    m_spillLease.reset();
+    m_spillDirectory.clear();
+    m_segments.clear();
+    m_spilledCount = 0;
+    m_spilledThrough = 0;
+}
+
+/**
+ * @brief Anexa diretório de spill e retoma segmentos existentes.
+ * @param directory Caminho do diretório
+ * @return false se outra sessão detém o lease do diretório
+ * @throws std::runtime_error se o diretório não puder ser criado
+ */
+bool ActivityLog::attachSpillDirectory(const std::string& directory) {
+    namespace fs = std::filesystem;
+
+    auto lock = readLock();
+    if (directory == m_spillDirectory) {
+        return true;
+    }
+
+    std::error_code error;
+    fs::create_directories(directory, error);
+    if (error) {
+        throw std::runtime_error("Could not create activity spill directory '" + directory +
+                                 "': " + error.message());
+    }
+
+    auto lease = std::make_unique<SpillLease>();
+#ifndef _WIN32
+    std::string leasePath = (fs::path(directory) / kLeaseFile).string();
+    lease->fd = ::open(leasePath.c_str(), O_RDWR | O_CREAT, 0644);
+    if (lease->fd < 0) {
+        throw std::runtime_error("Could not open activity lease file '" + leasePath + "'");
+    }
+    if (::flock(lease->fd, LOCK_EX | LOCK_NB) != 0) {
+        // Outra sessão grava a trilha: segmentos e sequências seriam intercalados
+        detachSpill();
+        return false;
+    }
+#endif
+    // Sem flock no Windows: lease melhor-esforço (apenas um processo por workspace)
+
+    m_segmentStream.close();
+    std::string previous = std::move(m_spillDirectory);
+    m_spillDirectory = directory;
+    if (!previous.empty() || m_size > 0) {
+        // Save com outro nome: a trilha gravada até aqui acompanha o workspace
+        adoptSpilled(previous);
+        m_spillLease = std::move(lease); // Lease anterior liberado após a cópia
+        return true;
+    }
+    m_spillLease = std::move(lease);
+    m_segments.clear();
+    m_spilledCount = 0;
+    m_spilledThrough = 0;
+
+    // Segmentos selados: apenas o índice é lido
+    std::ifstream index(fs::path(directory) / kIndexFile);
+    std::string line;
+    while (std::getline(index, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        json j = json::parse(line, nullptr, false);
+        if (j.is_discarded() || !j.contains("file") || !j.contains("count")) {
+            continue; // Linha truncada (queda durante escrita): ignora
+        }
+        Segment segment;
+        segment.file = j["file"].get<std::string>();
+        segment.first = fromMillis(j.value("first", 0LL));
+        segment.last = fromMillis(j.value("last", 0LL));
+        segment.count = j["count"].get<size_t>();
+        segment.lastSequence = j.value("lastSequence", std::uint64_t(0));
+        segment.sealed = true;
+        m_spilledCount += segment.count;
+        m_segments.push_back(std::move(segment));
+    }
+
+    // Segmento ativo (não selado) de uma execução anterior: conta as linhas
+    Segment active;
+    active.file = segmentFileName(m_segments.size() + 1);
+    std::ifstream activeFile(fs::path(directory) / active.file);
+    while (std::getline(activeFile, line)) {
+        json j = json::parse(line, nullptr, false);
+        if (j.is_discarded() || !j.contains("timestamp")) {
+            continue;
+        }
+        auto timestamp = fromMillis(j["timestamp"].get<long long>());
+        if (active.count == 0) {
+            active.first = timestamp;
+        }
+        active.last = timestamp;
+        active.lastSequence = j.value("sequence", std::uint64_t(0));
+        ++active.count;
+    }
+    if (active.count > 0) {
+        m_spilledCount += active.count;
+        m_segments.push_back(std::move(active));
+    }
+    if (!m_segments.empty()) {
+        m_spilledThrough = m_segments.back().lastSequence;
+    }
+    return true;
+}
+
+/**
+ * @brief Codec dos próximos segmentos selados.
+ * @param codec Codec
+ * @throws std::runtime_error se o codec não foi compilado
+ */
+void ActivityLog::setSegmentCodec(Compression::Codec codec) {
+    if (!Compression::isAvailable(codec)) {
+        throw std::runtime_error(std::string("Codec '") + Compression::name(codec) + "' is not available");
+    }
+    auto lock = readLock();
+    m_segmentCodec = codec;
+}
+
+/**
+ * @brief Retorna uma página da trilha completa.
+ * @param offset Posição da primeira entrada (0 = mais antiga)
+ * @param count Máximo de entradas
+ * @return Entradas em ordem cronológica
+ */
+std::vector<ActivityEntry> ActivityLog::page(size_t offset, size_t count) const {
+    auto lock = readLock();
+    std::vector<ActivityEntry> result;
+    size_t total = m_spilledCount + m_size;
+    if (offset >= total || count == 0) {
+        return result;
+    }
+    result.reserve(std::min(count, total - offset));
+
+    size_t visited = visitSpilled(offset, count, [&](const json& j) {
+        result.push_back(ActivityEntry{fromMillis(j.value("timestamp", 0LL)),
+                                       j.value("message", std::string())});
+    });
+
+    // Restante vem do buffer em memória
+    size_t ringOffset = offset > m_spilledCount ? offset - m_spilledCount : 0;
+    for (size_t i = ringOffset; i < m_size && visited < count; ++i, ++visited) {
+        const ActivityEvent& event = at(i);
+        result.push_back(ActivityEntry{event.timestamp, format(event)});
+    }
+    return result;
+}
+
+/**
+ * @brief Página da trilha completa com os eventos estruturados.
+ * @param offset Posição do primeiro evento
+ * @param count Máximo de eventos
+ * @return Eventos em JSON, em ordem cronológica
+ */
+std::vector<json> ActivityLog::records(size_t offset, size_t count) const {
+    auto lock = readLock();
+    std::vector<json> result;
+    size_t total = m_spilledCount + m_size;
+    if (offset >= total || count == 0) {
+        return result;
+    }
+    result.reserve(std::min(count, total - offset));
+
+    size_t visited = visitSpilled(offset, count, [&](const json& j) { result.push_back(j); });
+
+    size_t ringOffset = offset > m_spilledCount ? offset - m_spilledCount : 0;
+    for (size_t i = ringOffset; i < m_size && visited < count; ++i, ++visited) {
+        result.push_back(eventToJson(at(i)));
+    }
+    return result;
+}
+
+/**
+ * @brief Percorre as entradas em disco dentro do intervalo pedido.
+ * @param offset Posição da primeira entrada
+ * @param count Máximo de posições
+ * @param visit Chamado para cada linha válida
+ * @return Posições percorridas (linhas inválidas contam, mas não são visitadas)
+ */
+size_t ActivityLog::visitSpilled(size_t offset, size_t count,
+                                 const std::function<void(const json&)>& visit) const {
+    namespace fs = std::filesystem;
+
+    if (offset >= m_spilledCount) {
+        return 0;
+    }
+    m_segmentStream.flush();
+
+    size_t visited = 0;
+    size_t segmentStart = 0;
+    for (const auto& segment : m_segments) {
+        if (visited == count) {
+            break;
+        }
+        if (offset >= segmentStart + segment.count) {
+            segmentStart += segment.count;
+            continue; // Página começa depois deste segmento: nem abre o arquivo
+        }
+
+        CompressedIFStream file((fs::path(m_spillDirectory) / segment.file).string());
+        std::string line;
+        size_t position = segmentStart;
+        while (visited < count && std::getline(file, line)) {
+            if (position++ < offset) {
+                continue;
+            }
+            ++visited;
+            json j = json::parse(line, nullptr, false);
+            if (!j.is_discarded()) {
+                visit(j);
+            }
+        }
+        segmentStart += segment.count;
+    }
+    return visited;
+}
+
+/**
+ * @brief Eventos do board desde seu último checkpoint em memória.
+ * @param board Nome do board
+ * @return Quantidade ou size_t(-1)
+ */
+size_t ActivityLog::eventsSinceCheckpoint(const std::string& board) const {
+    auto lock = readLock();
+    auto id = m_nameIds.find(board);
+    if (id == m_nameIds.end()) {
+        return static_cast<size_t>(-1);
+    }
+
+    size_t count = 0;
+    for (size_t i = m_size; i-- > 0;) {
+        const ActivityEvent& event = at(i);
+        if (event.board != id->second) {
+            continue;
+        }
+        if (event.type == ActivityType::BoardCheckpoint) {
+            return count;
+        }
+        ++count;
+    }
+    return static_cast<size_t>(-1);
+}
+
+/**
+ * @brief Descarrega o segmento ativo e comprime os segmentos selados pendentes.
+ * @throws std::runtime_error se a compressão falhar, ou a falha guardada de uma gravação anterior
+ */
+void ActivityLog::flush() {
+    namespace fs = std::filesystem;
+
+    auto lock = readLock();
+    m_segmentStream.flush();
+
+    // Segmentos selados desde o último flush: compressão fora do caminho das gravações
+    for (auto& segment : m_segments) {
+        if (!segment.compressPending) {
+            continue;
+        }
+        if (m_segmentCodec != Compression::Codec::None) {
+            Compression::compressFile((fs::path(m_spillDirectory) / segment.file).string(), m_segmentCodec);
+        }
+        segment.compressPending = false;
+    }
+
+    if (m_error) {
+        std::exception_ptr error = m_error;
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Quantidade de entradas em memória.
+ * @return Entradas no buffer
+ */
+size_t ActivityLog::size() const {
+    auto lock = readLock();
+    return m_size;
+}
+
+/**
+ * @brief Quantidade total de entradas.
+ * @return Entradas em disco + memória
+ */
+size_t ActivityLog::totalSize() const {
+    auto lock = readLock();
+    return m_spilledCount + m_size;
+}
+
+/**
+ * @brief Máximo de entradas em memória.
+ * @return Capacidade do buffer
+ */
+size_t ActivityLog::capacity() const {
+    return m_entries.size();
+}
+
+/**
+ * @brief Retorna as entradas em memória (formatadas neste momento).
+ * @return Entradas, da mais antiga para a mais nova
  */
 std::vector<ActivityEntry> ActivityLog::all() const {
-    return m_entries; // Retorna cópia como especificado no header
+    auto lock = readLock();
+    std::vector<ActivityEntry> entries;
+    entries.reserve(m_size);
+    for (const ActivityEvent& event : events()) {
+        entries.push_back(ActivityEntry{event.timestamp, format(event)});
+    }
+    return entries;
+}
+
+/**
+ * @brief Eventos em memória, sem cópia.
+ * @return Visão completa do buffer
+ */
+ActivityLog::Range ActivityLog::events() const {
+    return Range(this, 0, m_size);
+}
+
+ActivityLog::Range::const_iterator ActivityLog::begin() const {
+    return Range::const_iterator(this, 0);
+}
+
+ActivityLog::Range::const_iterator ActivityLog::end() const {
+    return Range::const_iterator(this, m_size);
+}
+
+/**
+ * @brief Os n eventos mais recentes em memória.
+ * @param n Quantidade desejada
+ * @return Visão dos últimos min(n, size()) eventos
+ */
+ActivityLog::Range ActivityLog::last(size_t n) const {
+    return Range(this, m_size - std::min(n, m_size), m_size);
+}
+
+/**
+ * @brief Eventos em memória dentro do intervalo [from, to].
+ * @param from Início (inclusivo)
+ * @param to Fim (inclusivo)
+ * @return Visão dos eventos no intervalo
+ */
+ActivityLog::Range ActivityLog::between(TimePoint from, TimePoint to) const {
+    if (to < from) {
+        return Range(this, 0, 0);
+    }
+    size_t first = ringLowerBound(from);
+    size_t last = to == TimePoint::max()
+        ? m_size
+        : ringLowerBound(to + TimePoint::duration(1)); // Primeiro evento depois de to
+    return Range(this, first, last);
+}
+
+/**
+ * @brief Posição na trilha completa do primeiro evento com timestamp >= t.
+ * @param t Instante procurado
+ * @return Posição ou totalSize()
+ */
+size_t ActivityLog::lowerBound(TimePoint t) const {
+    namespace fs = std::filesystem;
+
+    auto lock = readLock();
+    // Primeiro segmento que termina em t ou depois
+    auto segment = std::partition_point(m_segments.begin(), m_segments.end(),
+                                        [&](const Segment& s) { return s.last < t; });
+    if (segment == m_segments.end()) {
+        return m_spilledCount + ringLowerBound(t);
+    }
+
+    size_t position = 0;
+    for (auto it = m_segments.begin(); it != segment; ++it) {
+        position += it->count;
+    }
+    if (segment->first >= t) {
+        return position;
+    }
+
+    // t cai dentro do segmento: varre só este arquivo
+    m_segmentStream.flush();
+    CompressedIFStream file((fs::path(m_spillDirectory) / segment->file).string());
+    std::string line;
+    while (std::getline(file, line)) {
+        json j = json::parse(line, nullptr, false);
+        if (j.is_discarded()) {
+            continue;
+        }
+        if (fromMillis(j.value("timestamp", 0LL)) >= t) {
+            break;
+        }
+        ++position;
+    }
+    return position;
+}
+
+/**
+ * @brief Evento na posição lógica i.
+ * @param i Posição (0 = mais antigo em memória)
+ * @return Referência ao evento no buffer
+ */
+const ActivityEvent& ActivityLog::at(size_t i) const {
+    return m_entries[(m_head + i) % m_entries.size()];
+}
+
+/**
+ * @brief Busca binária no buffer pelo primeiro timestamp >= t.
+ * @param t Instante procurado
+ * @return Posição lógica ou size()
+ */
+size_t ActivityLog::ringLowerBound(TimePoint t) const {
+    size_t low = 0;
+    size_t high = m_size;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (at(middle).timestamp < t) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// ------------------------------------------------------------------ Range
+
+ActivityLog::Range::Range(const ActivityLog* log, size_t first, size_t last)
+    : m_log(log), m_first(first), m_last(last)
+{
+}
+
+ActivityLog::Range::const_iterator ActivityLog::Range::begin() const {
+    return const_iterator(m_log, m_first);
+}
+
+ActivityLog::Range::const_iterator ActivityLog::Range::end() const {
+    return const_iterator(m_log, m_last);
+}
+
+size_t ActivityLog::Range::size() const {
+    return m_last - m_first;
+}
+
+bool ActivityLog::Range::empty() const {
+    return m_first == m_last;
+}
+
+const ActivityEvent& ActivityLog::Range::operator[](size_t i) const {
+    return m_log->at(m_first + i);
+}
+
+ActivityLog::Range::const_iterator::const_iterator(const ActivityLog* log, size_t index)
+    : m_log(log), m_index(index)
+{
+}
+
+const ActivityEvent& ActivityLog::Range::const_iterator::operator*() const {
+    return m_log->at(m_index);
+}
+
+const ActivityEvent* ActivityLog::Range::const_iterator::operator->() const {
+    return &m_log->at(m_index);
+}
+
+ActivityLog::Range::const_iterator& ActivityLog::Range::const_iterator::operator++() {
+    ++m_index;
+    return *this;
+}
+
+ActivityLog::Range::const_iterator ActivityLog::Range::const_iterator::operator++(int) {
+    const_iterator previous = *this;
+    ++m_index;
+    return previous;
+}
+
+bool ActivityLog::Range::const_iterator::operator==(const const_iterator& other) const {
+    return m_index == other.m_index && m_log == other.m_log;
+}
+
+bool ActivityLog::Range::const_iterator::operator!=(const const_iterator& other) const {
+    return !(*this == other);
 }
 
 /**
  * @brief Serializa o log de atividades para JSON.
- * @return Objeto JSON com array de entradas
+ * @return Objeto JSON com array de entradas em memória
  */
 json ActivityLog::toJson() const {
+    auto lock = readLock();
     json entriesArray = json::array();
-    
-    for (const auto& entry : m_entries) {
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            entry.timestamp.time_since_epoch()
-        ).count();
-        
-        entriesArray.push_back({
-            {"timestamp", ms},
-            {"message", entry.message}
-        });
-    }
-    
-    return json{
-        {"entries", entriesArray}
-    };
+
+    // Checkpoints com um mais recente do mesmo board em memória não repetem o board
+    std::vector<bool> superseded(m_size, false);
+    std::unordered_set<std::uint32_t> checkpointed;
+    for (size_t i = m_size; i-- > 0;) {
+        const ActivityEvent& event = at(i);
+        if (event.type == ActivityType::BoardCheckpoint) {
+            superseded[i] = !checkpointed.insert(event.board).second;
+        }
+    }
+
+    for (size_t i = 0; i < m_size; ++i) {
+        entriesArray.push_back(eventToJson(at(i), !superseded[i]));
+    }
+
+    json j = {{"entries", entriesArray}};
+    if (!m_spillDirectory.empty()) {
+        // Sem trilha anexada a marca não vale: o load() seguinte não trunca
+        j["spilledThrough"] = m_spilledThrough;
+    }
+    return j;
 }
 
 /**
@@ -59,23 +1386,26 @@ json ActivityLog::toJson() const {
  */
 ActivityLog ActivityLog::fromJson(const json& j) {
     ActivityLog log;
-    
+    log.load(j);
+    return log;
+}
+
+/**
+ * @brief Acrescenta entradas de um JSON ao log.
+ * @param j Objeto JSON com dados do log
+ * @throws json::exception se estrutura inválida
+ */
+void ActivityLog::load(const json& j) {
+    auto lock = readLock();
+    if (!m_spillDirectory.empty() && j.contains("spilledThrough")) {
+        truncateSpilled(j["spilledThrough"].get<std::uint64_t>());
+    }
     if (j.contains("entries") && j["entries"].is_array()) {
         for (const auto& entryJson : j["entries"]) {
-            if (entryJson.contains("timestamp") && entryJson.contains("message")) {
-                ActivityEntry entry;
-                
-                // Reconstrução do timestamp
-                auto ms = std::chrono::milliseconds(
-                    entryJson["timestamp"].get<long long>()
-                );
-                entry.timestamp = std::chrono::system_clock::time_point(ms);
-                entry.message = entryJson["message"].get<std::string>();
-                
-                log.m_entries.push_back(std::move(entry));
+            if (entryJson.contains("timestamp") &&
+                (entryJson.contains("message") || entryJson.contains("type"))) {
+                appendJson(entryJson);
             }
         }
     }
-    
-    return log;
-}
\ No newline at end of file
+}
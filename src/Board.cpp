@@ -2,9 +2,14 @@
 #include "Column.h"
 #include "Card.h"
 #include "ActivityLog.h"
+#include "BoardBatch.h"
+#include "BoardSnapshot.h"
+#include "FlowMetrics.h"
 #include "external/json.hpp"
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 using json = nlohmann::json;
 
@@ -15,6 +20,20 @@ using json = nlohmann::json;
  * @date 01/10/2025
  */
 
+namespace {
+
+/**
+ * @brief Dados de replay com apenas a posição final.
+ */
+ActivityDetail positionDetail(size_t position) {
+    ActivityDetail detail;
+    detail.position = position;
+    detail.hasPosition = true;
+    return detail;
+}
+
+} // namespace
+
 /**
  * @brief Construtor da classe Board.
  * @param id Identificador único do quadro
@@ -28,22 +47,40 @@ Board::Board(std::string id, std::string name)
 /**
  * @brief Adiciona uma nova coluna ao quadro.
  * @param column Coluna a ser adicionada
+ * @param position Índice da nova coluna (END_POSITION = final)
  * @return true se adicionada com sucesso, false se nome já existe
  */
-bool Board::addColumn(const Column& column) {
-    // Verifica se já existe coluna com o mesmo nome
-    auto it = std::find_if(m_columns.begin(), m_columns.end(),
-        [&column](const Column& existing) { return existing.getName() == column.getName(); });
+bool Board::addColumn(const Column& column, size_t position) {
+    size_t slot = std::min(position, m_columns.size());
     
-    if (it != m_columns.end()) {
+    // Verifica se já existe coluna com o mesmo nome (O(1) pelo índice)
+    auto inserted = m_columnIndex.emplace(column.getName(), slot);
+    if (!inserted.second) {
         return false; // Nome já existe
     }
     
-    m_columns.push_back(column);
+    m_columns.insert(m_columns.begin() + static_cast<std::ptrdiff_t>(slot), column);
+    
+    // Colunas após a inserida deslocam uma posição para frente
+    for (size_t i = slot + 1; i < m_columns.size(); ++i) {
+        m_columnIndex[m_columns[i].getName()] = i;
+    }
+    ++m_version;
+    
+    if (m_flowMetrics) {
+        auto now = std::chrono::system_clock::now();
+        bool last = slot + 1 == m_columns.size();
+        for (const auto& card : column.getCards()) {
+            m_flowMetrics->cardAdded(m_name, card.getId(), column.getName(), card.getCreatedAt(),
+                                     slot > 0, last, now);
+        }
+    }
     
     // Log da operação se ActivityLog disponível
     if (m_activityLog) {
-        m_activityLog->record("Column '" + column.getName() + "' added to board '" + m_name + "'");
+        ActivityDetail detail = positionDetail(slot);
+        detail.column = std::make_shared<const Column>(column);
+        m_activityLog->record(ActivityType::ColumnAdded, m_name, column.getName(), "", "", std::move(detail));
     }
     
     return true;
@@ -55,17 +92,92 @@ bool Board::addColumn(const Column& column) {
  * @return true se removida com sucesso, false se não encontrada
  */
 bool Board::removeColumn(const std::string& name) {
-    auto it = std::find_if(m_columns.begin(), m_columns.end(),
-        [&name](const Column& column) { return column.getName() == name; });
+    auto indexIt = m_columnIndex.find(name);
+    if (indexIt == m_columnIndex.end()) {
+        return false;
+    }
     
-    if (it != m_columns.end()) {
-        if (m_activityLog) {
-            m_activityLog->record("Column '" + name + "' removed from board '" + m_name + "'");
+    size_t slot = indexIt->second;
+    if (m_activityLog) {
+        m_activityLog->record(ActivityType::ColumnRemoved, m_name, name);
+    }
+    if (m_flowMetrics) {
+        auto now = std::chrono::system_clock::now();
+        for (const auto& card : m_columns[slot].getCards()) {
+            m_flowMetrics->cardRemoved(m_name, card.getId(), now);
         }
-        m_columns.erase(it);
+    }
+    m_columnIndex.erase(indexIt);
+    m_columns.erase(m_columns.begin() + static_cast<std::ptrdiff_t>(slot));
+    
+    // Colunas após a removida deslocam uma posição para trás
+    for (size_t i = slot; i < m_columns.size(); ++i) {
+        m_columnIndex[m_columns[i].getName()] = i;
+    }
+    ++m_version;
+    return true;
+}
+
+/**
+ * @brief Move uma coluna para outro índice.
+ * @param name Nome da coluna
+ * @param position Novo índice (END_POSITION = final)
+ * @return true se movida, false se não encontrada
+ */
+bool Board::moveColumn(const std::string& name, size_t position) {
+    auto indexIt = m_columnIndex.find(name);
+    if (indexIt == m_columnIndex.end()) {
+        return false;
+    }
+    
+    size_t from = indexIt->second;
+    size_t to = std::min(position, m_columns.size() - 1);
+    if (from == to) {
         return true;
     }
-    return false;
+    auto first = m_columns.begin();
+    if (from < to) {
+        std::rotate(first + static_cast<std::ptrdiff_t>(from), first + static_cast<std::ptrdiff_t>(from + 1),
+                    first + static_cast<std::ptrdiff_t>(to + 1));
+    } else {
+        std::rotate(first + static_cast<std::ptrdiff_t>(to), first + static_cast<std::ptrdiff_t>(from),
+                    first + static_cast<std::ptrdiff_t>(from + 1));
+    }
+    for (size_t i = std::min(from, to); i <= std::max(from, to); ++i) {
+        m_columnIndex[m_columns[i].getName()] = i;
+    }
+    ++m_version;
+    
+    if (m_activityLog) {
+        m_activityLog->record(ActivityType::ColumnMoved, m_name, name, "", "", positionDetail(to));
+    }
+    return true;
+}
+
+/**
+ * @brief Altera o limite WIP de uma coluna.
+ * @param name Nome da coluna
+ * @param wipLimit Novo limite (-1 = sem limite)
+ * @return true se alterado (ou já igual), false se não encontrada
+ */
+bool Board::setColumnWipLimit(const std::string& name, int wipLimit) {
+    Column* column = findColumn(name);
+    if (!column) {
+        return false;
+    }
+    if (column->getWipLimit() == wipLimit) {
+        return true;
+    }
+    column->setWipLimit(wipLimit);
+    ++m_version;
+    
+    if (m_activityLog) {
+        ActivityDetail detail;
+        detail.wipLimit = wipLimit;
+        detail.hasWipLimit = true;
+        m_activityLog->record(ActivityType::ColumnWipChanged, m_name, name, "", "", std::move(detail));
+    }
+    return true;
 }
 
 /**
@@ -74,10 +186,8 @@ bool Board::removeColumn(const std::string& name) {
  * @return Ponteiro para a coluna ou nullptr se não encontrada
  */
 Column* Board::findColumn(const std::string& name) {
-    auto it = std::find_if(m_columns.begin(), m_columns.end(),
-        [&name](const Column& column) { return column.getName() == name; });
-    
-    return (it != m_columns.end()) ? &(*it) : nullptr;
+    auto it = m_columnIndex.find(name);
+    return (it != m_columnIndex.end()) ? &m_columns[it->second] : nullptr;
 }
 
 /**
@@ -86,40 +196,254 @@ Column* Board::findColumn(const std::string& name) {
  * @return Ponteiro constante para a coluna ou nullptr se não encontrada
  */
 const Column* Board::findColumn(const std::string& name) const {
-    auto it = std::find_if(m_columns.begin(), m_columns.end(),
-        [&name](const Column& column) { return column.getName() == name; });
-    
-    return (it != m_columns.end()) ? &(*it) : nullptr;
+    auto it = m_columnIndex.find(name);
+    return (it != m_columnIndex.end()) ? &m_columns[it->second] : nullptr;
 }
 
 /**
  * @brief Adiciona um cartão a uma coluna específica do quadro.
  * @param columnName Nome da coluna onde adicionar o cartão
  * @param card Cartão a ser adicionado
+ * @param position Índice do cartão na coluna (END_POSITION = fim)
  * @return true se adicionado com sucesso, false caso contrário
  */
-bool Board::addCard(const std::string& columnName, const Card& card) {
+bool Board::addCard(const std::string& columnName, const Card& card, size_t position) {
     Column* column = findColumn(columnName);
     if (!column) {
         return false; // Coluna não encontrada
     }
     
-    bool result = column->addCard(card);
+    bool result = column->insertCard(card, position);
+    if (result) {
+        ++m_version;
+    }
+    if (result && m_flowMetrics) {
+        size_t slot = m_columnIndex[columnName];
+        m_flowMetrics->cardAdded(m_name, card.getId(), columnName, card.getCreatedAt(), slot > 0,
+                                 slot + 1 == m_columns.size(), std::chrono::system_clock::now());
+    }
     if (result && m_activityLog) {
-        m_activityLog->record("Card '" + card.getId() + "' added to column '" + columnName + "' in board '" + m_name + "'");
+        size_t slot = std::min(position, column->getCardCount() - 1);
+        ActivityDetail detail = positionDetail(slot);
+        detail.card = std::make_shared<const Card>(card);
+        m_activityLog->record(ActivityType::CardAdded, m_name, columnName, card.getId(), "", std::move(detail));
     }
     
     return result;
 }
 
+/**
+ * @brief Adiciona um cartão na posição da sua chave de ordenação.
+ * @param columnName Nome da coluna onde adicionar o cartão
+ * @param card Cartão (chave e versão preservadas)
+ * @return true se adicionado com sucesso, false caso contrário
+ */
+bool Board::addCardByRank(const std::string& columnName, const Card& card) {
+    Column* column = findColumn(columnName);
+    if (!column || !column->insertCardByRank(card)) {
+        return false;
+    }
+    ++m_version;
+    
+    if (m_flowMetrics) {
+        size_t slot = m_columnIndex[columnName];
+        m_flowMetrics->cardAdded(m_name, card.getId(), columnName, card.getCreatedAt(), slot > 0,
+                                 slot + 1 == m_columns.size(), std::chrono::system_clock::now());
+    }
+    if (m_activityLog) {
+        int position = column->indexOfCard(card.getId());
+        const Card& stored = column->getCards()[static_cast<size_t>(position)]; // Chave repetida é trocada
+        ActivityDetail detail = positionDetail(static_cast<size_t>(position));
+        detail.card = std::make_shared<const Card>(stored);
+        m_activityLog->record(ActivityType::CardAdded, m_name, columnName, card.getId(), "", std::move(detail));
+    }
+    return true;
+}
+
+/**
+ * @brief Remove um cartão de uma coluna específica do quadro.
+ * @param columnName Nome da coluna que contém o cartão
+ * @param cardId ID do cartão a ser removido
+ * @return true se removido com sucesso, false caso contrário
+ */
+bool Board::removeCard(const std::string& columnName, const std::string& cardId) {
+    Column* column = findColumn(columnName);
+    if (!column || !column->removeCard(cardId)) {
+        return false;
+    }
+    ++m_version;
+    
+    if (m_activityLog) {
+        m_activityLog->record(ActivityType::CardRemoved, m_name, columnName, cardId);
+    }
+    if (m_flowMetrics) {
+        m_flowMetrics->cardRemoved(m_name, cardId, std::chrono::system_clock::now());
+    }
+    return true;
+}
+
+/**
+ * @brief Retira um conjunto de cartões de uma coluna (arquivamento).
+ * @param columnName Nome da coluna
+ * @param ids IDs dos cartões
+ * @param extracted Recebe os cartões retirados
+ * @return Quantidade retirada
+ */
+size_t Board::extractCards(const std::string& columnName, const std::unordered_set<std::string>& ids,
+                           std::vector<Card>& extracted) {
+    Column* column = findColumn(columnName);
+    if (!column) {
+        return 0;
+    }
+    size_t first = extracted.size();
+    size_t count = column->extractCards(ids, extracted);
+    if (count == 0) {
+        return 0;
+    }
+    ++m_version;
+    
+    auto now = std::chrono::system_clock::now();
+    for (size_t i = first; i < extracted.size(); ++i) {
+        if (m_activityLog) {
+            m_activityLog->record(ActivityType::CardRemoved, m_name, columnName, extracted[i].getId());
+        }
+        if (m_flowMetrics) {
+            m_flowMetrics->cardRemoved(m_name, extracted[i].getId(), now);
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Busca um cartão pelo ID em todas as colunas.
+ * @param cardId ID do cartão
+ * @return Ponteiro para o cartão ou nullptr se não encontrado
+ */
+Card* Board::findCard(const std::string& cardId) {
+    for (auto& column : m_columns) {
+        if (Card* card = column.findCard(cardId)) {
+            return card;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Altera campos de um cartão e registra apenas o que mudou.
+ * @param cardId ID do cartão
+ * @param title Novo título (nullopt = mantém)
+ * @param description Nova descrição (nullopt = mantém)
+ * @param priority Nova prioridade (nullopt = mantém)
+ * @return true se o cartão existe
+ */
+bool Board::updateCard(const std::string& cardId, const std::optional<std::string>& title,
+                       const std::optional<std::string>& description,
+                       const std::optional<int>& priority) {
+    Card* card = findCard(cardId);
+    if (!card) {
+        return false;
+    }
+    
+    ActivityCardChange change;
+    if (title && *title != card->getTitle()) {
+        card->setTitle(*title);
+        change.title = *title;
+    }
+    if (description && *description != card->getDescription()) {
+        card->setDescription(*description);
+        change.description = *description;
+    }
+    if (priority && *priority != card->getPriority()) {
+        card->setPriority(*priority);
+        change.priority = *priority;
+    }
+    
+    if (!change.title && !change.description && !change.priority) {
+        return true;
+    }
+    ++m_version;
+    if (m_activityLog) {
+        ActivityDetail detail;
+        detail.change = std::make_shared<const ActivityCardChange>(std::move(change));
+        m_activityLog->record(ActivityType::CardUpdated, m_name, "", cardId, "", std::move(detail));
+    }
+    return true;
+}
+
+/**
+ * @brief updateCard() condicionado à versão do cartão.
+ * @param cardId ID do cartão
+ * @param expectedVersion Versão lida antes da edição
+ * @param title Novo título (nullopt = mantém)
+ * @param description Nova descrição (nullopt = mantém)
+ * @param priority Nova prioridade (nullopt = mantém)
+ * @return true se aplicado
+ */
+bool Board::updateCardIf(const std::string& cardId, std::uint64_t expectedVersion,
+                         const std::optional<std::string>& title,
+                         const std::optional<std::string>& description,
+                         const std::optional<int>& priority) {
+    Card* card = findCard(cardId);
+    if (!card || card->getVersion() != expectedVersion) {
+        return false;
+    }
+    return updateCard(cardId, title, description, priority);
+}
+
+/**
+ * @brief Adiciona ou remove uma tag de um cartão.
+ * @param cardId ID do cartão
+ * @param tag Tag
+ * @param add true = adicionar, false = remover
+ * @return true se o cartão existe
+ */
+bool Board::tagCard(const std::string& cardId, const std::string& tag, bool add) {
+    Card* card = findCard(cardId);
+    if (!card) {
+        return false;
+    }
+    if (card->hasTag(tag) == add) {
+        return true; // Nada a alterar
+    }
+    
+    if (add) {
+        card->addTag(tag);
+    } else {
+        card->removeTag(tag);
+    }
+    ++m_version;
+    if (m_activityLog) {
+        ActivityCardChange change;
+        change.tag = tag;
+        change.tagAdded = add;
+        ActivityDetail detail;
+        detail.change = std::make_shared<const ActivityCardChange>(std::move(change));
+        m_activityLog->record(ActivityType::CardUpdated, m_name, "", cardId, "", std::move(detail));
+    }
+    return true;
+}
+
+/**
+ * @brief Registra o estado completo do quadro no log (ponto de partida do replay).
+ */
+void Board::checkpoint() const {
+    if (m_activityLog) {
+        ActivityDetail detail;
+        detail.board = std::make_shared<const BoardSnapshot>(*this);
+        m_activityLog->record(ActivityType::BoardCheckpoint, m_name, "", "", "", std::move(detail));
+    }
+}
+
 /**
  * @brief Move um cartão entre colunas respeitando limites WIP.
  * @param cardId ID do cartão a ser movido
  * @param fromCol Nome da coluna origem
  * @param toCol Nome da coluna destino
+ * @param position Índice final na coluna destino (END_POSITION = fim)
  * @return true se movido com sucesso, false caso contrário
  */
-bool Board::moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol) {
+bool Board::moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol,
+                     size_t position) {
     Column* fromColumn = findColumn(fromCol);
     Column* toColumn = findColumn(toCol);
     
@@ -133,6 +457,29 @@ bool Board::moveCard(const std::string& cardId, const std::string& fromCol, cons
         return false; // Card não encontrado na coluna origem
     }
     
+    // Mesma coluna: apenas reordena (WIP não muda)
+    if (fromColumn == toColumn) {
+        const auto& cards = fromColumn->getCards();
+        size_t from = static_cast<size_t>(fromColumn->indexOfCard(cardId));
+        size_t last = cards.size() - 1;
+        if (std::min(position, last) == from) {
+            return true; // Já está na posição pedida
+        }
+        
+        // Âncora = card que ficará logo após o movido ("" = fim da coluna)
+        std::string anchorId;
+        if (position < last) {
+            anchorId = cards[position >= from ? position + 1 : position].getId();
+        }
+        fromColumn->moveCardBefore(cardId, anchorId);
+        ++m_version;
+        if (m_activityLog) {
+            m_activityLog->record(ActivityType::CardReordered, m_name, fromCol, cardId, "",
+                                  positionDetail(std::min(position, last)));
+        }
+        return true;
+    }
+    
     // Verifica se a coluna destino pode receber o card (WIP limit)
     if (toColumn->isFull()) {
         return false; // Coluna destino cheia
@@ -141,10 +488,18 @@ bool Board::moveCard(const std::string& cardId, const std::string& fromCol, cons
     // Faz uma cópia do card antes de remover
     Card cardCopy = *card;
     
-    // Remove da origem e adiciona ao destino
-    if (fromColumn->removeCard(cardId) && toColumn->addCard(cardCopy)) {
+    // Remove da origem e adiciona ao destino (chave gerada na posição destino)
+    if (fromColumn->removeCard(cardId) && toColumn->insertCard(cardCopy, position)) {
+        ++m_version;
+        if (m_flowMetrics) {
+            size_t slot = m_columnIndex[toCol];
+            m_flowMetrics->cardMoved(m_name, cardId, toCol, slot > 0, slot + 1 == m_columns.size(),
+                                     std::chrono::system_clock::now());
+        }
         if (m_activityLog) {
-            m_activityLog->record("Card '" + cardId + "' moved from '" + fromCol + "' to '" + toCol + "' in board '" + m_name + "'");
+            size_t slot = std::min(position, toColumn->getCardCount() - 1);
+            m_activityLog->record(ActivityType::CardMoved, m_name, fromCol, cardId, toCol,
+                                  positionDetail(slot));
         }
         return true;
     }
@@ -152,6 +507,201 @@ bool Board::moveCard(const std::string& cardId, const std::string& fromCol, cons
     return false;
 }
 
+/**
+ * @brief moveCard() condicionado à versão do cartão.
+ * @param cardId ID do cartão
+ * @param expectedVersion Versão lida antes da movimentação
+ * @param fromCol Coluna origem
+ * @param toCol Coluna destino
+ * @param position Índice final na coluna destino
+ * @return true se movido
+ */
+bool Board::moveCardIf(const std::string& cardId, std::uint64_t expectedVersion, const std::string& fromCol,
+                       const std::string& toCol, size_t position) {
+    Column* column = findColumn(fromCol);
+    const Card* card = column ? column->findCard(cardId) : nullptr;
+    if (!card || card->getVersion() != expectedVersion) {
+        return false;
+    }
+    return moveCard(cardId, fromCol, toCol, position);
+}
+
+/**
+ * @brief Aplica um lote de operações com validação e log únicos.
+ * @param batch Operações a aplicar
+ * @return true se aplicado, false se inválido (board inalterado)
+ */
+bool Board::applyBatch(const BoardBatch& batch) {
+    using Type = BoardBatch::OperationType;
+    
+    if (batch.empty()) {
+        return true;
+    }
+    
+    // 1. Localização atual de todos os cards (uma varredura)
+    std::unordered_map<std::string, size_t> location;
+    for (size_t slot = 0; slot < m_columns.size(); ++slot) {
+        for (const auto& card : m_columns[slot].getCards()) {
+            location.emplace(card.getId(), slot);
+        }
+    }
+    location.reserve(location.size() + batch.size());
+    
+    // 2. Validação simulando o lote sobre o mapa de localização
+    std::vector<long long> delta(m_columns.size(), 0);
+    std::unordered_map<std::string, size_t> origin; // card movido → coluna original
+    std::unordered_set<std::string> newCards;       // cards criados pelo próprio lote
+    size_t added = 0;
+    size_t tagChanges = 0;
+    
+    for (const auto& op : batch.operations()) {
+        switch (op.type) {
+        case Type::AddCard: {
+            auto column = m_columnIndex.find(op.column);
+            if (column == m_columnIndex.end() || !op.card ||
+                !location.emplace(op.cardId, column->second).second) {
+                return false; // Coluna inexistente ou ID duplicado
+            }
+            newCards.insert(op.cardId);
+            ++delta[column->second];
+            ++added;
+            break;
+        }
+        case Type::MoveCard: {
+            auto from = m_columnIndex.find(op.column);
+            auto to = m_columnIndex.find(op.targetColumn);
+            auto card = location.find(op.cardId);
+            if (from == m_columnIndex.end() || to == m_columnIndex.end() ||
+                card == location.end() || card->second != from->second) {
+                return false;
+            }
+            if (from->second != to->second) {
+                if (!newCards.count(op.cardId)) {
+                    origin.emplace(op.cardId, from->second); // Mantém a primeira origem
+                }
+                card->second = to->second;
+                --delta[from->second];
+                ++delta[to->second];
+            }
+            break;
+        }
+        case Type::AddTag:
+        case Type::RemoveTag:
+            if (!location.count(op.cardId)) {
+                return false;
+            }
+            ++tagChanges;
+            break;
+        }
+    }
+    
+    // Limites WIP verificados uma única vez, sobre o estado final
+    for (size_t slot = 0; slot < m_columns.size(); ++slot) {
+        int wipLimit = m_columns[slot].getWipLimit();
+        long long finalCount = static_cast<long long>(m_columns[slot].getCardCount()) + delta[slot];
+        if (wipLimit != -1 && delta[slot] > 0 && finalCount > wipLimit) {
+            return false;
+        }
+    }
+    
+    // 3. Aplicação agrupada por coluna: primeiro saídas, depois entradas
+    std::vector<std::unordered_set<std::string>> leaving(m_columns.size());
+    size_t moved = 0;
+    for (const auto& entry : origin) {
+        if (location[entry.first] != entry.second) {
+            leaving[entry.second].insert(entry.first);
+            ++moved;
+        }
+    }
+    
+    std::vector<std::vector<Card>> arriving(m_columns.size());
+    std::vector<Card> extracted;
+    for (size_t slot = 0; slot < m_columns.size(); ++slot) {
+        if (leaving[slot].empty()) {
+            continue;
+        }
+        extracted.clear();
+        m_columns[slot].extractCards(leaving[slot], extracted);
+        for (auto& card : extracted) {
+            arriving[location[card.getId()]].push_back(std::move(card));
+        }
+    }
+    
+    for (const auto& op : batch.operations()) {
+        if (op.type == Type::AddCard) {
+            arriving[location[op.cardId]].push_back(*op.card);
+        }
+    }
+    
+    for (size_t slot = 0; slot < m_columns.size(); ++slot) {
+        if (!arriving[slot].empty()) {
+            m_columns[slot].appendCards(std::move(arriving[slot]));
+        }
+    }
+    
+    // Tags: índice id → card montado uma vez, após a estrutura estabilizar
+    if (tagChanges > 0) {
+        std::unordered_map<std::string, Card*> cardsById;
+        cardsById.reserve(location.size());
+        for (auto& column : m_columns) {
+            for (auto& card : column.getCards()) {
+                cardsById.emplace(card.getId(), &card);
+            }
+        }
+        for (const auto& op : batch.operations()) {
+            if (op.type == Type::AddTag) {
+                cardsById[op.cardId]->addTag(op.tag);
+            } else if (op.type == Type::RemoveTag) {
+                cardsById[op.cardId]->removeTag(op.tag);
+            }
+        }
+    }
+    
+    if (m_flowMetrics) {
+        auto now = std::chrono::system_clock::now();
+        size_t last = m_columns.size() - 1;
+        for (const auto& op : batch.operations()) {
+            if (op.type == Type::AddCard) {
+                size_t slot = location[op.cardId];
+                m_flowMetrics->cardAdded(m_name, op.cardId, m_columns[slot].getName(),
+                                         op.card->getCreatedAt(), slot > 0, slot == last, now);
+            }
+        }
+        for (const auto& entry : origin) {
+            size_t slot = location[entry.first];
+            if (slot != entry.second) {
+                m_flowMetrics->cardMoved(m_name, entry.first, m_columns[slot].getName(), slot > 0,
+                                         slot == last, now);
+            }
+        }
+    }
+    
+    ++m_version;
+    if (m_activityLog) {
+        json payload;
+        payload["operations"] = batch.toJson(); // Sem initializer_list: evita copiar o array
+        m_activityLog->recordBatch(m_name, static_cast<std::uint32_t>(added),
+                                   static_cast<std::uint32_t>(moved),
+                                   static_cast<std::uint32_t>(tagChanges), std::move(payload));
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Reconstrói o índice de colunas a partir do vetor.
+ *
+ * Em nomes duplicados (arquivos editados manualmente) prevalece a
+ * primeira ocorrência, mesmo comportamento da busca linear anterior.
+ */
+void Board::rebuildColumnIndex() {
+    m_columnIndex.clear();
+    m_columnIndex.reserve(m_columns.size());
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+        m_columnIndex.emplace(m_columns[i].getName(), i);
+    }
+}
+
 /**
  * @brief Anexa um ActivityLog ao quadro para registro de eventos.
  * @param log Ponteiro para o ActivityLog (dependency injection)
@@ -160,6 +710,25 @@ void Board::attachActivityLog(ActivityLog* log) {
     m_activityLog = log;
 }
 
+/**
+ * @brief Anexa métricas de fluxo ao quadro.
+ * @param metrics Ponteiro para FlowMetrics (dependency injection)
+ */
+void Board::attachFlowMetrics(FlowMetrics* metrics) {
+    m_flowMetrics = metrics;
+    if (m_flowMetrics) {
+        m_flowMetrics->track(*this);
+    }
+}
+
+/**
+ * @brief Retorna a versão do quadro.
+ * @return Contador de alterações
+ */
+std::uint64_t Board::getVersion() const {
+    return m_version;
+}
+
 /**
  * @brief Retorna o ID único do quadro.
  * @return Referência constante ao ID do quadro
@@ -290,7 +859,8 @@ json Board::toJson() const {
     return json{
         {"id", m_id},
         {"name", m_name},
-        {"columns", columnsArray}
+        {"columns", columnsArray},
+        {"version", m_version}
     };
 }
 
@@ -336,5 +906,7 @@ Board Board::fromJson(const json& j) {
         }
     }
     
+    board.rebuildColumnIndex();
+    board.m_version = j.value("version", std::uint64_t(0));
     return board;
 }
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "BoardBatch.h"
+#include <stdexcept>
+
+using json = nlohmann::json;
+
+/**
+ * @file BoardBatch.cpp
+ * @brief Implementação do builder de operações em lote.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @brief Agenda inclusão de card novo.
+ * @param column Coluna destino
+ * @param card Card a incluir
+ * @return Referência ao lote
+ */
+BoardBatch& BoardBatch::addCard(std::string column, Card card) {
+    std::string cardId = card.getId();
+    m_operations.push_back(Operation{OperationType::AddCard, std::move(cardId), std::move(column),
+                                     std::string(), std::string(), std::move(card)});
+    return *this;
+}
+
+/**
+ * @brief Agenda movimentação de card.
+ * @param cardId Card a mover
+ * @param fromCol Coluna origem
+ * @param toCol Coluna destino
+ * @return Referência ao lote
+ */
+BoardBatch& BoardBatch::moveCard(std::string cardId, std::string fromCol, std::string toCol) {
+    m_operations.push_back(Operation{OperationType::MoveCard, std::move(cardId), std::move(fromCol),
+                                     std::move(toCol), std::string(), std::nullopt});
+    return *this;
+}
+
+/**
+ * @brief Agenda inclusão de tag.
+ * @param cardId Card alvo
+ * @param tag Tag a adicionar
+ * @return Referência ao lote
+ */
+BoardBatch& BoardBatch::addTag(std::string cardId, std::string tag) {
+    m_operations.push_back(Operation{OperationType::AddTag, std::move(cardId), std::string(),
+                                     std::string(), std::move(tag), std::nullopt});
+    return *this;
+}
+
+/**
+ * @brief Agenda remoção de tag.
+ * @param cardId Card alvo
+ * @param tag Tag a remover
+ * @return Referência ao lote
+ */
+BoardBatch& BoardBatch::removeTag(std::string cardId, std::string tag) {
+    m_operations.push_back(Operation{OperationType::RemoveTag, std::move(cardId), std::string(),
+                                     std::string(), std::move(tag), std::nullopt});
+    return *this;
+}
+
+/**
+ * @brief Pré-aloca espaço para operações.
+ * @param n Quantidade esperada
+ */
+void BoardBatch::reserve(size_t n) {
+    m_operations.reserve(n);
+}
+
+/**
+ * @brief Retorna as operações agendadas.
+ * @return Vetor de operações
+ */
+const std::vector<BoardBatch::Operation>& BoardBatch::operations() const {
+    return m_operations;
+}
+
+/**
+ * @brief Quantidade de operações.
+ * @return Tamanho do lote
+ */
+size_t BoardBatch::size() const {
+    return m_operations.size();
+}
+
+/**
+ * @brief Verifica se o lote está vazio.
+ * @return true se vazio
+ */
+bool BoardBatch::empty() const {
+    return m_operations.empty();
+}
+
+/**
+ * @brief Serializa as operações.
+ * @return Array JSON ({"op", "card", ...} por operação)
+ */
+json BoardBatch::toJson() const {
+    json operations = json::array();
+    operations.get_ref<json::array_t&>().reserve(m_operations.size());
+    for (const auto& op : m_operations) {
+        switch (op.type) {
+        case OperationType::AddCard: {
+            // Atribuição em vez de initializer_list: o JSON do card é movido, não copiado
+            json entry;
+            entry["op"] = "add";
+            entry["column"] = op.column;
+            entry["card"] = op.card->toJson();
+            operations.push_back(std::move(entry));
+            break;
+        }
+        case OperationType::MoveCard:
+            operations.push_back({{"op", "move"}, {"card", op.cardId}, {"from", op.column},
+                                  {"to", op.targetColumn}});
+            break;
+        case OperationType::AddTag:
+        case OperationType::RemoveTag:
+            operations.push_back({{"op", op.type == OperationType::AddTag ? "tag" : "untag"},
+                                  {"card", op.cardId}, {"tag", op.tag}});
+            break;
+        }
+    }
+    return operations;
+}
+
+/**
+ * @brief Reconstrói lote a partir de JSON.
+ * @param j Array de operações
+ * @return Lote
+ * @throws std::invalid_argument se operação desconhecida
+ */
+BoardBatch BoardBatch::fromJson(const json& j) {
+    BoardBatch batch;
+    batch.reserve(j.size());
+    for (const auto& op : j) {
+        std::string type = op.at("op").get<std::string>();
+        if (type == "add") {
+            batch.addCard(op.at("column").get<std::string>(), Card::fromJson(op.at("card")));
+        } else if (type == "move") {
+            batch.moveCard(op.at("card").get<std::string>(), op.at("from").get<std::string>(),
+                           op.at("to").get<std::string>());
+        } else if (type == "tag") {
+            batch.addTag(op.at("card").get<std::string>(), op.at("tag").get<std::string>());
+        } else if (type == "untag") {
+            batch.removeTag(op.at("card").get<std::string>(), op.at("tag").get<std::string>());
+        } else {
+            throw std::invalid_argument("Unknown batch operation: " + type);
+        }
+    }
+    return batch;
+}
@@ -0,0 +1,144 @@
+#include "BoardReplay.h"
+#include "ActivityLog.h"
+#include "Board.h"
+#include "BoardBatch.h"
+#include "Card.h"
+#include "Column.h"
+#include <algorithm>
+#include <optional>
+
+using json = nlohmann::json;
+
+/**
+ * @file BoardReplay.cpp
+ * @brief Implementação da reconstrução de boards por replay de eventos.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @brief Aplica um evento ao board.
+ * @param board Board alvo
+ * @param event Evento em JSON
+ * @return true se aplicado (ou sem efeito em estado)
+ */
+bool BoardReplay::apply(Board& board, const json& event) {
+    static const json none;
+    const std::string type = event.value("type", std::string());
+    const json& payload = event.contains("payload") ? event["payload"] : none;
+    const std::string column = event.value("column", std::string());
+    const std::string card = event.value("card", std::string());
+
+    try {
+        if (type == "column_added") {
+            return board.addColumn(Column::fromJson(payload.at("column")),
+                                   payload.value("position", Board::END_POSITION));
+        }
+        if (type == "column_removed") {
+            return board.removeColumn(column);
+        }
+        if (type == "column_moved") {
+            return board.moveColumn(column, payload.at("position").get<size_t>());
+        }
+        if (type == "column_wip_changed") {
+            return board.setColumnWipLimit(column, payload.at("wipLimit").get<int>());
+        }
+        if (type == "card_added") {
+            return board.addCard(column, Card::fromJson(payload.at("card")),
+                                 payload.value("position", Board::END_POSITION));
+        }
+        if (type == "card_removed") {
+            return board.removeCard(column, card);
+        }
+        if (type == "card_moved" || type == "card_reordered") {
+            std::string target = type == "card_moved" ? event.value("target", std::string()) : column;
+            return board.moveCard(card, column, target, payload.at("position").get<size_t>());
+        }
+        if (type == "card_updated") {
+            auto field = [&](const char* name) {
+                return payload.contains(name) ? std::optional<std::string>(payload[name].get<std::string>())
+                                              : std::nullopt;
+            };
+            std::optional<int> priority;
+            if (payload.contains("priority")) {
+                priority = payload["priority"].get<int>();
+            }
+            bool ok = board.updateCard(card, field("title"), field("description"), priority);
+            for (const auto& tag : payload.value("addTags", json::array())) {
+                ok = ok && board.tagCard(card, tag.get<std::string>(), true);
+            }
+            for (const auto& tag : payload.value("removeTags", json::array())) {
+                ok = ok && board.tagCard(card, tag.get<std::string>(), false);
+            }
+            return ok;
+        }
+        if (type == "batch_applied") {
+            return board.applyBatch(BoardBatch::fromJson(payload.at("operations")));
+        }
+        if (type == "board_checkpoint") {
+            if (!payload.is_null()) { // Sem payload: checkpoint superado por um mais recente
+                board = Board::fromJson(payload);
+            }
+            return true;
+        }
+    } catch (const std::exception&) {
+        return false; // Payload ausente (log antigo) ou malformado
+    }
+    return true; // Texto livre e tipos sem efeito em estado
+}
+
+/**
+ * @brief Aplica eventos em ordem.
+ * @param board Board alvo
+ * @param events Eventos
+ * @return true se todos aplicados
+ */
+bool BoardReplay::replay(Board& board, const std::vector<json>& events) {
+    for (const auto& event : events) {
+        if (!apply(board, event)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reconstrói o board no instante t.
+ * @param log Log com a trilha
+ * @param boardName Nome do board
+ * @param t Instante (inclusivo)
+ * @return Board ou nullptr
+ */
+std::unique_ptr<Board> BoardReplay::at(const ActivityLog& log, const std::string& boardName,
+                                       std::chrono::system_clock::time_point t) {
+    using TimePoint = std::chrono::system_clock::time_point;
+    const size_t chunk = 256;
+
+    size_t position = t == TimePoint::max() ? log.totalSize()
+                                            : log.lowerBound(t + TimePoint::duration(1));
+    std::vector<json> tail; // Eventos do board, do mais novo para o mais antigo
+
+    while (position > 0) {
+        size_t count = std::min(chunk, position);
+        position -= count;
+        std::vector<json> records = log.records(position, count);
+
+        for (auto it = records.rbegin(); it != records.rend(); ++it) {
+            if (it->value("board", std::string()) != boardName) {
+                continue;
+            }
+            if (it->value("type", std::string()) != "board_checkpoint") {
+                tail.push_back(std::move(*it));
+                continue;
+            }
+            if (!it->contains("payload")) {
+                continue; // Marcador de checkpoint salvo sem o board: procura o anterior
+            }
+
+            auto board = std::make_unique<Board>(Board::fromJson(it->at("payload")));
+            std::reverse(tail.begin(), tail.end());
+            return replay(*board, tail) ? std::move(board) : nullptr;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,238 @@
+#include "BoardSnapshot.h"
+#include "Board.h"
+#include "Column.h"
+#include <unordered_map>
+
+using json = nlohmann::json;
+
+/**
+ * @file BoardSnapshot.cpp
+ * @brief Implementação dos snapshots imutáveis com compartilhamento estrutural.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+// ============================================================================
+// ColumnSnapshot
+// ============================================================================
+
+ColumnSnapshot::ColumnSnapshot(const Column& column)
+    : m_name(column.getName()), m_wipLimit(column.getWipLimit()), m_version(column.getVersion()),
+      m_rankGeneration(column.getRankGeneration())
+{
+    m_cards.reserve(column.getCardCount());
+    for (const auto& card : column.getCards()) {
+        m_cards.push_back(std::make_shared<const Card>(card));
+    }
+}
+
+/**
+ * @brief Path-copy da coluna.
+ * @param column Coluna atual
+ * @param previous Versão anterior
+ * @param changedCards Cards a copiar de novo
+ */
+ColumnSnapshot::ColumnSnapshot(const Column& column, const ColumnSnapshot& previous,
+                               const std::unordered_set<std::string>& changedCards)
+    : m_name(column.getName()), m_wipLimit(column.getWipLimit()), m_version(column.getVersion()),
+      m_rankGeneration(column.getRankGeneration())
+{
+    // Coluna renumerada: chave e versão de todos os cards mudaram
+    std::unordered_map<std::string, const CardPtr*> unchanged;
+    if (m_rankGeneration == previous.m_rankGeneration) {
+        unchanged.reserve(previous.m_cards.size());
+        for (const auto& card : previous.m_cards) {
+            if (!changedCards.count(card->getId())) {
+                unchanged.emplace(card->getId(), &card);
+            }
+        }
+    }
+
+    m_cards.reserve(column.getCardCount());
+    for (const auto& card : column.getCards()) {
+        auto it = unchanged.find(card.getId());
+        m_cards.push_back(it != unchanged.end() ? *it->second : std::make_shared<const Card>(card));
+    }
+}
+
+const std::string& ColumnSnapshot::getName() const {
+    return m_name;
+}
+
+int ColumnSnapshot::getWipLimit() const {
+    return m_wipLimit;
+}
+
+std::uint64_t ColumnSnapshot::getVersion() const {
+    return m_version;
+}
+
+const std::vector<ColumnSnapshot::CardPtr>& ColumnSnapshot::getCards() const {
+    return m_cards;
+}
+
+size_t ColumnSnapshot::getCardCount() const {
+    return m_cards.size();
+}
+
+const Card* ColumnSnapshot::findCard(const std::string& cardId) const {
+    for (const auto& card : m_cards) {
+        if (card->getId() == cardId) {
+            return card.get();
+        }
+    }
+    return nullptr;
+}
+
+json ColumnSnapshot::toJson() const {
+    json cardsArray = json::array();
+    for (const auto& card : m_cards) {
+        cardsArray.push_back(card->toJson());
+    }
+    return json{
+        {"name", m_name},
+        {"wipLimit", m_wipLimit},
+        {"cards", cardsArray},
+        {"version", m_version}
+    };
+}
+
+// ============================================================================
+// BoardSnapshot
+// ============================================================================
+
+BoardSnapshot::BoardSnapshot()
+    : m_data(std::make_shared<const Data>())
+{
+}
+
+BoardSnapshot::BoardSnapshot(const Board& board) {
+    auto data = std::make_shared<Data>();
+    data->id = board.getId();
+    data->name = board.getName();
+    data->version = board.getVersion();
+    data->columns.reserve(board.getColumns().size());
+    for (const auto& column : board.getColumns()) {
+        data->columns.push_back(std::make_shared<const ColumnSnapshot>(column));
+    }
+    m_data = std::move(data);
+}
+
+/**
+ * @brief Gera a próxima versão compartilhando o que não mudou.
+ * @param board Board já alterado
+ * @param changedColumns Colunas alteradas
+ * @param changedCards Cards alterados
+ * @return Nova versão
+ */
+BoardSnapshot BoardSnapshot::update(const Board& board, const std::unordered_set<std::string>& changedColumns,
+                                    const std::unordered_set<std::string>& changedCards) const {
+    std::unordered_map<std::string, const ColumnPtr*> previous;
+    previous.reserve(m_data->columns.size());
+    for (const auto& column : m_data->columns) {
+        previous.emplace(column->getName(), &column);
+    }
+
+    auto data = std::make_shared<Data>();
+    data->id = board.getId();
+    data->name = board.getName();
+    data->version = board.getVersion();
+    data->columns.reserve(board.getColumns().size());
+    for (const auto& column : board.getColumns()) {
+        auto it = previous.find(column.getName());
+        if (it == previous.end()) {
+            data->columns.push_back(std::make_shared<const ColumnSnapshot>(column));
+        } else if (!changedColumns.count(column.getName())) {
+            data->columns.push_back(*it->second);
+        } else {
+            data->columns.push_back(std::make_shared<const ColumnSnapshot>(column, **it->second, changedCards));
+        }
+    }
+
+    BoardSnapshot next;
+    next.m_data = std::move(data);
+    return next;
+}
+
+const std::string& BoardSnapshot::getId() const {
+    return m_data->id;
+}
+
+const std::string& BoardSnapshot::getName() const {
+    return m_data->name;
+}
+
+std::uint64_t BoardSnapshot::getVersion() const {
+    return m_data->version;
+}
+
+const std::vector<BoardSnapshot::ColumnPtr>& BoardSnapshot::getColumns() const {
+    return m_data->columns;
+}
+
+const ColumnSnapshot* BoardSnapshot::findColumn(const std::string& name) const {
+    for (const auto& column : m_data->columns) {
+        if (column->getName() == name) {
+            return column.get();
+        }
+    }
+    return nullptr;
+}
+
+const Card* BoardSnapshot::findCard(const std::string& cardId) const {
+    for (const auto& column : m_data->columns) {
+        if (const Card* card = column->findCard(cardId)) {
+            return card;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<const Card*> BoardSnapshot::findCardsByTag(const std::string& tag) const {
+    std::vector<const Card*> result;
+    for (const auto& column : m_data->columns) {
+        for (const auto& card : column->getCards()) {
+            if (card->hasTag(tag)) {
+                result.push_back(card.get());
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<const Card*> BoardSnapshot::filterByPriority(int minPriority) const {
+    std::vector<const Card*> result;
+    for (const auto& column : m_data->columns) {
+        for (const auto& card : column->getCards()) {
+            if (card->getPriority() >= minPriority) {
+                result.push_back(card.get());
+            }
+        }
+    }
+    return result;
+}
+
+size_t BoardSnapshot::getCardCount() const {
+    size_t count = 0;
+    for (const auto& column : m_data->columns) {
+        count += column->getCardCount();
+    }
+    return count;
+}
+
+json BoardSnapshot::toJson() const {
+    json columnsArray = json::array();
+    for (const auto& column : m_data->columns) {
+        columnsArray.push_back(column->toJson());
+    }
+    return json{
+        {"id", m_data->id},
+        {"name", m_data->name},
+        {"columns", columnsArray},
+        {"version", m_data->version}
+    };
+}
+
+Board BoardSnapshot::toBoard() const {
+    return Board::fromJson(toJson());
+}
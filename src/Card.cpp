@@ -34,6 +34,21 @@ Card::Card(std::string id, std::string title)
 void Card::setTitle(const std::string& t) {
     m_title = t;
     m_updatedAt = std::chrono::system_clock::now();
+    ++m_version;
+}
+
+/**
+ * @brief Define o título se a versão não mudou (compare-and-set).
+ * @param expectedVersion Versão esperada
+ * @param t Novo título
+ * @return true se aplicado
+ */
+bool Card::setTitleIf(std::uint64_t expectedVersion, const std::string& t) {
+    if (m_version != expectedVersion) {
+        return false;
+    }
+    setTitle(t);
+    return true;
 }
 
 /**
@@ -41,8 +56,9 @@ void Card::setTitle(const std::string& t) {
  * @param d Nova descrição do cartão
  */
 void Card::setDescription(const std::string& d) {
-    m_description = d;
+    m_description = DescriptionStore::instance().intern(d);
     m_updatedAt = std::chrono::system_clock::now();
+    ++m_version;
 }
 
 /**
@@ -52,6 +68,7 @@ void Card::setDescription(const std::string& d) {
 void Card::setAssignee(User* u) {
     m_assignee = u;
     m_updatedAt = std::chrono::system_clock::now();
+    ++m_version;
 }
 
 /**
@@ -61,6 +78,7 @@ void Card::setAssignee(User* u) {
 void Card::setPriority(int p) {
     m_priority = p;
     m_updatedAt = std::chrono::system_clock::now();
+    ++m_version;
 }
 
 /**
@@ -93,7 +111,8 @@ const std::string& Card::getTitle() const {
  * @return Referência constante à descrição do cartão
  */
 const std::string& Card::getDescription() const {
-    return m_description;
+    static const std::string empty;
+    return m_description ? *m_description : empty;
 }
 
 /**
@@ -137,6 +156,7 @@ void Card::addTag(const std::string& tag) {
     if (std::find(m_tags.begin(), m_tags.end(), tag) == m_tags.end()) {
         m_tags.push_back(tag);
         m_updatedAt = std::chrono::system_clock::now();
+        ++m_version;
     }
 }
 
@@ -149,6 +169,7 @@ void Card::removeTag(const std::string& tag) {
     if (it != m_tags.end()) {
         m_tags.erase(it);
         m_updatedAt = std::chrono::system_clock::now();
+        ++m_version;
     }
 }
 
@@ -169,6 +190,34 @@ const std::vector<std::string>& Card::getTags() const {
     return m_tags;
 }
 
+/**
+ * @brief Retorna a chave de ordenação do card.
+ * @return Referência constante à chave
+ */
+const std::string& Card::getRank() const {
+    return m_rank;
+}
+
+/**
+ * @brief Define a chave de ordenação do card.
+ * @param rank Nova chave
+ * @param moved true se reposicionado pelo usuário (incrementa a versão)
+ */
+void Card::setRank(std::string rank, bool moved) {
+    m_rank = std::move(rank);
+    if (moved) {
+        ++m_version;
+    }
+}
+
+/**
+ * @brief Retorna a versão do card.
+ * @return Contador de alterações
+ */
+std::uint64_t Card::getVersion() const {
+    return m_version;
+}
+
 /**
  * @brief Serializa o card para JSON.
  * @return Objeto JSON com todos os dados do card
@@ -186,13 +235,19 @@ json Card::toJson() const {
     json j = {
         {"id", m_id},
         {"title", m_title},
-        {"description", m_description},
+        {"description", getDescription()},
         {"priority", m_priority},
         {"createdAt", createdMs},
         {"updatedAt", updatedMs},
-        {"tags", m_tags}  // Serializa tags como array JSON
+        {"tags", m_tags},  // Serializa tags como array JSON
+        {"version", m_version}
     };
 
+    // Chave de ordenação (omitida enquanto o card não pertence a uma coluna)
+    if (!m_rank.empty()) {
+        j["rank"] = m_rank;
+    }
+
     // Adiciona assignee ID se existir
     if (m_assignee != nullptr) {
         j["assigneeId"] = m_assignee->getId();
@@ -256,6 +311,13 @@ Card Card::fromJson(const json& j) {
         }
     }
 
+    if (j.contains("rank") && j["rank"].is_string()) {
+        card.m_rank = j["rank"].get<std::string>();
+    }
+
+    // Por último: os setters acima incrementam a versão
+    card.m_version = j.value("version", std::uint64_t(0));
+
     // Nota: assignee deve ser resolvido pela aplicação após carregamento
     // pois precisamos do mapa de users completo
 
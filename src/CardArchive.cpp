@@ -0,0 +1,219 @@
+#include "CardArchive.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+/**
+ * @file CardArchive.cpp
+ * @brief Implementação do arquivo frio de cards.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+namespace {
+
+const char* const kDataFile = "cards.jsonl";
+const char* const kIndexFile = "index.jsonl";
+
+long long toMillis(CardArchive::TimePoint t) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+}
+
+CardArchive::TimePoint fromMillis(long long ms) {
+    return CardArchive::TimePoint(std::chrono::milliseconds(ms));
+}
+
+std::string lowercase(std::string_view text) {
+    std::string result(text);
+    std::transform(result.begin(), result.end(), result.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return result;
+}
+
+bool containsLower(std::string_view haystack, const std::string& needle) {
+    return lowercase(haystack).find(needle) != std::string::npos;
+}
+
+/**
+ * @brief Linha de cards.jsonl → registro (nullopt se ilegível).
+ */
+std::optional<CardArchive::Record> parseRecord(const std::string& line) {
+    json j = json::parse(line, nullptr, false);
+    if (j.is_discarded() || !j.contains("card")) {
+        return std::nullopt;
+    }
+    try {
+        return CardArchive::Record{
+            j.value("board", std::string()),
+            j.value("column", std::string()),
+            fromMillis(j.value("archivedAt", 0LL)),
+            Card::fromJson(j["card"])
+        };
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+} // namespace
+
+CardArchive::CardArchive(std::string directory)
+    : m_directory(std::move(directory)),
+      m_codec(Compression::isAvailable(Compression::Codec::Gzip) ? Compression::Codec::Gzip
+                                                                 : Compression::Codec::None)
+{
+}
+
+/**
+ * Dados antes do índice: se a escrita do membro falha, o arquivo volta ao
+ * tamanho anterior e nada é indexado; o chamador mantém os cards no board.
+ */
+void CardArchive::append(const std::string& board, const std::string& column, const std::vector<Card>& cards) {
+    if (cards.empty()) {
+        return;
+    }
+    std::error_code error;
+    fs::create_directories(m_directory, error);
+    if (error) {
+        throw std::runtime_error("Could not create archive directory '" + m_directory + "': " + error.message());
+    }
+    loadIndex();
+
+    const std::string data = dataFile();
+    std::uint64_t offset = fs::exists(data) ? fs::file_size(data) : 0;
+    TimePoint now = std::chrono::system_clock::now();
+    long long nowMs = toMillis(now);
+    {
+        CompressedOFStream out(data, m_codec, true);
+        if (!out.is_open()) {
+            throw std::runtime_error("Could not open archive for writing: " + data);
+        }
+        for (const auto& card : cards) {
+            out << json{
+                {"board", board},
+                {"column", column},
+                {"archivedAt", nowMs},
+                {"card", card.toJson()}
+            }.dump() << '\n';
+        }
+        out.close();
+        if (!out) {
+            fs::resize_file(data, offset, error);
+            throw std::runtime_error("Could not write archive: " + data);
+        }
+    }
+
+    std::ofstream index(indexFile(), std::ios::app);
+    for (const auto& card : cards) {
+        index << json{{"id", card.getId()}, {"offset", offset}, {"archivedAt", nowMs}}.dump() << '\n';
+        m_index[card.getId()] = Entry{offset, now};
+    }
+    index.flush();
+    if (!index) {
+        throw std::runtime_error("Could not write archive index: " + indexFile());
+    }
+}
+
+/**
+ * O índice aponta o membro; a leitura começa ali e para no card.
+ */
+std::optional<CardArchive::Record> CardArchive::find(const std::string& cardId) const {
+    loadIndex();
+    auto it = m_index.find(cardId);
+    if (it == m_index.end()) {
+        return std::nullopt;
+    }
+
+    CompressedIFStream in(dataFile(), static_cast<std::streamoff>(it->second.offset));
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open archive: " + dataFile());
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find(cardId) == std::string::npos) {
+            continue; // Evita o parse de linhas de outros cards
+        }
+        auto record = parseRecord(line);
+        if (record && record->card.getId() == cardId) {
+            return record;
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * Varredura em streaming; o texto cru da linha é filtrado antes do parse
+ * quando o termo não tem caracteres que o JSON escapa.
+ */
+std::vector<CardArchive::Record> CardArchive::search(std::string_view text, size_t limit) const {
+    std::vector<Record> results;
+    if (!fs::exists(dataFile()) || limit == 0) {
+        return results;
+    }
+    const std::string needle = lowercase(text);
+    bool prefilter = std::none_of(needle.begin(), needle.end(), [](unsigned char c) {
+        return c == '"' || c == '\\' || c < 0x20;
+    });
+
+    CompressedIFStream in(dataFile());
+    std::string line;
+    while (results.size() < limit && std::getline(in, line)) {
+        if (prefilter && !containsLower(line, needle)) {
+            continue;
+        }
+        auto record = parseRecord(line);
+        if (!record) {
+            continue;
+        }
+        const Card& card = record->card;
+        bool matches = containsLower(card.getId(), needle) || containsLower(card.getTitle(), needle) ||
+                       containsLower(card.getDescription(), needle) ||
+                       std::any_of(card.getTags().begin(), card.getTags().end(),
+                                   [&needle](const std::string& tag) { return containsLower(tag, needle); });
+        if (matches) {
+            results.push_back(std::move(*record));
+        }
+    }
+    return results;
+}
+
+size_t CardArchive::size() const {
+    loadIndex();
+    return m_index.size();
+}
+
+const std::string& CardArchive::directory() const {
+    return m_directory;
+}
+
+void CardArchive::loadIndex() const {
+    if (m_indexLoaded) {
+        return;
+    }
+    m_indexLoaded = true;
+
+    std::ifstream index(indexFile());
+    std::string line;
+    while (std::getline(index, line)) {
+        json j = json::parse(line, nullptr, false);
+        if (j.is_discarded() || !j.contains("id") || !j.contains("offset")) {
+            continue; // Linha truncada (queda durante escrita): ignora
+        }
+        m_index[j["id"].get<std::string>()] = Entry{
+            j["offset"].get<std::uint64_t>(),
+            fromMillis(j.value("archivedAt", 0LL))
+        };
+    }
+}
+
+std::string CardArchive::dataFile() const {
+    return (fs::path(m_directory) / kDataFile).string();
+}
+
+std::string CardArchive::indexFile() const {
+    return (fs::path(m_directory) / kIndexFile).string();
+}
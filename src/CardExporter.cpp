@@ -0,0 +1,187 @@
+#include "CardExporter.h"
+#include "Board.h"
+#include "Card.h"
+#include "Column.h"
+#include "CsvWriter.h"
+#include "JsonLinesWriter.h"
+#include "User.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file CardExporter.cpp
+ * @brief Implementação da exportação de cards em CSV / JSON Lines.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+struct FieldName {
+    CardExporter::Field field;
+    const char* name;
+};
+
+const FieldName FIELD_NAMES[] = {
+    {CardExporter::Field::Board, "board"},
+    {CardExporter::Field::Column, "column"},
+    {CardExporter::Field::Id, "id"},
+    {CardExporter::Field::Title, "title"},
+    {CardExporter::Field::Description, "description"},
+    {CardExporter::Field::Priority, "priority"},
+    {CardExporter::Field::Tags, "tags"},
+    {CardExporter::Field::Assignee, "assignee"},
+    {CardExporter::Field::CreatedAt, "createdAt"},
+    {CardExporter::Field::UpdatedAt, "updatedAt"},
+    {CardExporter::Field::Rank, "rank"},
+    {CardExporter::Field::Version, "version"},
+};
+
+const char* nameOf(CardExporter::Field field) {
+    for (const auto& entry : FIELD_NAMES) {
+        if (entry.field == field) {
+            return entry.name;
+        }
+    }
+    return "";
+}
+
+} // namespace
+
+bool CardExporter::Filter::matches(const std::string& columnName, const Card& card) const {
+    return (column.empty() || column == columnName) &&
+           (tag.empty() || card.hasTag(tag)) &&
+           card.getPriority() >= minPriority;
+}
+
+std::vector<CardExporter::Field> CardExporter::parseFields(std::string_view list) {
+    std::vector<Field> fields;
+    while (!list.empty()) {
+        size_t end = std::min(list.find(','), list.size());
+        std::string_view name = list.substr(0, end);
+        list.remove_prefix(std::min(end + 1, list.size()));
+        if (name.empty()) {
+            continue;
+        }
+
+        bool known = false;
+        for (const auto& entry : FIELD_NAMES) {
+            if (name == entry.name) {
+                fields.push_back(entry.field);
+                known = true;
+                break;
+            }
+        }
+        if (!known) {
+            throw std::invalid_argument("Unknown field '" + std::string(name) + "'");
+        }
+    }
+    if (fields.empty()) {
+        throw std::invalid_argument("No fields given");
+    }
+    return fields;
+}
+
+const std::vector<CardExporter::Field>& CardExporter::defaultFields() {
+    static const std::vector<Field> fields = {
+        Field::Board, Field::Column, Field::Id, Field::Title, Field::Description,
+        Field::Priority, Field::Tags, Field::CreatedAt, Field::UpdatedAt
+    };
+    return fields;
+}
+
+CardExporter::CardExporter(std::ostream& out, Format format, std::vector<Field> fields)
+    : m_fields(std::move(fields))
+{
+    if (format == Format::Csv) {
+        m_csv = std::make_unique<CsvWriter>(out);
+        for (Field field : m_fields) {
+            m_csv->field(nameOf(field));
+        }
+        m_csv->endRow();
+    } else {
+        m_json = std::make_unique<JsonLinesWriter>(out);
+    }
+}
+
+CardExporter::~CardExporter() = default;
+
+template <typename T>
+void CardExporter::put(const char* key, const T& value) {
+    if (m_csv) {
+        m_csv->field(value);
+    } else {
+        m_json->field(key, value);
+    }
+}
+
+/**
+ * Um switch por campo; o card é lido por referência direto da coluna.
+ */
+void CardExporter::write(std::string_view board, std::string_view column, const Card& card) {
+    if (m_json) {
+        m_json->beginObject();
+    }
+    for (Field field : m_fields) {
+        const char* key = nameOf(field);
+        switch (field) {
+            case Field::Board:       put(key, board); break;
+            case Field::Column:      put(key, column); break;
+            case Field::Id:          put(key, card.getId()); break;
+            case Field::Title:       put(key, card.getTitle()); break;
+            case Field::Description: put(key, card.getDescription()); break;
+            case Field::Priority:    put(key, card.getPriority()); break;
+            case Field::Tags:        put(key, card.getTags()); break;
+            case Field::CreatedAt:   put(key, card.getCreatedAt()); break;
+            case Field::UpdatedAt:   put(key, card.getUpdatedAt()); break;
+            case Field::Rank:        put(key, card.getRank()); break;
+            case Field::Version:     put(key, card.getVersion()); break;
+            case Field::Assignee:
+                if (card.getAssignee()) {
+                    put(key, card.getAssignee()->getId());
+                } else if (m_csv) {
+                    m_csv->field("");
+                } else {
+                    m_json->null(key); // Mesmo formato de Card::toJson()
+                }
+                break;
+        }
+    }
+    if (m_csv) {
+        m_csv->endRow();
+    } else {
+        m_json->endObject();
+    }
+    ++m_rows;
+}
+
+size_t CardExporter::writeBoard(const Board& board, const Filter& filter) {
+    size_t before = m_rows;
+    for (const auto& column : board.getColumns()) {
+        if (!filter.column.empty() && column.getName() != filter.column) {
+            continue;
+        }
+        for (const auto& card : column.getCards()) {
+            if (filter.matches(column.getName(), card)) {
+                write(board.getName(), column.getName(), card);
+            }
+        }
+    }
+    return m_rows - before;
+}
+
+size_t CardExporter::writeBoard(const Board& board) {
+    return writeBoard(board, Filter());
+}
+
+size_t CardExporter::rows() const {
+    return m_rows;
+}
+
+void CardExporter::flush() {
+    if (m_csv) {
+        m_csv->flush();
+    } else {
+        m_json->flush();
+    }
+}
@@ -0,0 +1,255 @@
+#include "CardIdAllocator.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+/**
+ * @file CardIdAllocator.cpp
+ * @brief Implementação do gerador de IDs de cards com leases em arquivo.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+// constexpr evita dependência da ordem de inicialização estática
+constexpr char kCardIdPrefix[] = "card_";
+constexpr size_t kCardIdPrefixSize = sizeof(kCardIdPrefix) - 1;
+
+#ifndef _WIN32
+/**
+ * @brief Fecha o descritor (liberando o flock) ao sair de escopo.
+ */
+struct FdGuard {
+    int fd;
+    ~FdGuard() { if (fd >= 0) ::close(fd); }
+};
+#endif
+
+} // namespace
+
+/**
+ * @brief Construtor do alocador.
+ * @param blockSize Quantidade de IDs reservados por lease
+ */
+CardIdAllocator::CardIdAllocator(std::uint64_t blockSize)
+    : m_blockSize(std::max<std::uint64_t>(blockSize, 1))
+{
+}
+
+/**
+ * @brief Retorna a instância global do processo.
+ * @return Alocador compartilhado
+ */
+CardIdAllocator& CardIdAllocator::instance() {
+    static CardIdAllocator allocator;
+    return allocator;
+}
+
+/**
+ * @brief Emite o próximo ID livre usando CAS no bloco atual.
+ *
+ * A geração é relida depois do CAS (ordem sequencial): se uma troca de
+ * bloco começou no meio, o ID pode ser do bloco antigo e é descartado.
+ * IDs não precisam ser contíguos, só únicos.
+ *
+ * @return ID único
+ */
+std::uint64_t CardIdAllocator::next() {
+    for (;;) {
+        std::uint64_t generation = m_generation.load();
+        if (generation % 2 == 0) {
+            std::uint64_t current = m_next.load();
+            std::uint64_t end = m_end.load();
+
+            if (current < end) {
+                if (m_next.compare_exchange_weak(current, current + 1) &&
+                    m_generation.load() == generation) {
+                    return current;
+                }
+                continue; // Outra thread consumiu o ID ou o bloco mudou; tenta de novo
+            }
+        }
+
+        // Bloco esgotado (ou em troca): apenas uma thread reabastece
+        std::lock_guard<std::mutex> lock(m_refillMutex);
+        if (m_next.load() >= m_end.load()) {
+            refillLocked();
+        }
+    }
+}
+
+/**
+ * @brief Emite o próximo ID no formato textual usado pelos cards.
+ * @return "card_<n>"
+ */
+std::string CardIdAllocator::nextCardId() {
+    return std::string(kCardIdPrefix) + std::to_string(next());
+}
+
+/**
+ * @brief Anexa arquivo de lease e invalida o bloco local.
+ * @param path Caminho do arquivo de lease
+ */
+void CardIdAllocator::attachLeaseFile(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_refillMutex);
+    if (path == m_leasePath) {
+        return;
+    }
+
+    // IDs já emitidos localmente nunca podem reaparecer
+    std::uint64_t issued = m_next.load(std::memory_order_acquire) - 1;
+    if (issued > m_floor.load(std::memory_order_relaxed)) {
+        m_floor.store(issued, std::memory_order_relaxed);
+    }
+
+    m_leasePath = path;
+    beginUpdate();
+    m_end.store(0); // Força novo lease no próximo next()
+    endUpdate();
+}
+
+/**
+ * @brief Eleva o piso de IDs para nunca reemitir highest ou menores.
+ * @param highest Maior ID já utilizado
+ */
+void CardIdAllocator::reserveThrough(std::uint64_t highest) {
+    std::lock_guard<std::mutex> lock(m_refillMutex);
+    if (highest > m_floor.load(std::memory_order_relaxed)) {
+        m_floor.store(highest, std::memory_order_relaxed);
+    }
+    if (m_next.load() <= highest) {
+        beginUpdate();
+        m_end.store(0);
+        endUpdate();
+    }
+}
+
+/**
+ * @brief Retorna o maior ID emitido (ou reservado) até o momento.
+ * @return Último ID emitido
+ */
+std::uint64_t CardIdAllocator::highestIssued() const {
+    std::uint64_t issued = m_next.load(std::memory_order_acquire) - 1;
+    return std::max(issued, m_floor.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Converte "card_<n>" em n.
+ * @param cardId Identificador textual
+ * @return Valor numérico ou 0
+ */
+std::uint64_t CardIdAllocator::parseCardId(const std::string& cardId) {
+    if (cardId.size() <= kCardIdPrefixSize ||
+        cardId.compare(0, kCardIdPrefixSize, kCardIdPrefix) != 0) {
+        return 0;
+    }
+
+    std::uint64_t value = 0;
+    for (size_t i = kCardIdPrefixSize; i < cardId.size(); ++i) {
+        char c = cardId[i];
+        if (c < '0' || c > '9') {
+            return 0;
+        }
+        std::uint64_t digit = static_cast<std::uint64_t>(c - '0');
+        if (value > (std::numeric_limits<std::uint64_t>::max() - digit) / 10) {
+            return 0; // Não cabe em 64 bits: não é um ID emitido aqui
+        }
+        value = value * 10 + digit;
+    }
+    return value;
+}
+
+/**
+ * @brief Reserva um novo bloco (chamado com m_refillMutex travado).
+ *
+ * O par (m_next, m_end) muda dentro de uma geração ímpar; m_end é zerado
+ * antes de mover m_next para que nenhuma thread enxergue o bloco novo com
+ * o fim antigo.
+ */
+void CardIdAllocator::refillLocked() {
+    std::uint64_t floor = std::max(m_floor.load(std::memory_order_relaxed),
+                                   m_next.load() - 1);
+
+    std::uint64_t base = m_leasePath.empty() ? floor + 1 : leaseFromFile(floor);
+
+    beginUpdate();
+    m_end.store(0);
+    m_next.store(base);
+    m_end.store(base + m_blockSize);
+    endUpdate();
+}
+
+/**
+ * @brief Abre a troca do par (m_next, m_end) (com m_refillMutex travado).
+ */
+void CardIdAllocator::beginUpdate() {
+    m_generation.fetch_add(1);
+}
+
+/**
+ * @brief Fecha a troca aberta por beginUpdate().
+ */
+void CardIdAllocator::endUpdate() {
+    m_generation.fetch_add(1);
+}
+
+/**
+ * @brief Reserva [base, base + blockSize) no arquivo de lease.
+ * @param floor Maior ID que não pode ser reemitido
+ * @return Primeiro ID do bloco reservado
+ * @throws std::runtime_error em falha de I/O
+ */
+std::uint64_t CardIdAllocator::leaseFromFile(std::uint64_t floor) {
+    std::uint64_t stored = 0;
+
+#ifndef _WIN32
+    FdGuard guard { ::open(m_leasePath.c_str(), O_RDWR | O_CREAT, 0644) };
+    if (guard.fd < 0) {
+        throw std::runtime_error("Could not open id lease file '" + m_leasePath +
+                                 "': " + std::strerror(errno));
+    }
+    if (::flock(guard.fd, LOCK_EX) != 0) {
+        throw std::runtime_error("Could not lock id lease file '" + m_leasePath + "'");
+    }
+
+    char buffer[32] = {};
+    ssize_t bytes = ::pread(guard.fd, buffer, sizeof(buffer) - 1, 0);
+    for (ssize_t i = 0; i < bytes && buffer[i] >= '0' && buffer[i] <= '9'; ++i) {
+        stored = stored * 10 + static_cast<std::uint64_t>(buffer[i] - '0');
+    }
+
+    std::uint64_t base = std::max(stored, floor + 1);
+    std::string content = std::to_string(base + m_blockSize) + "\n";
+
+    if (::ftruncate(guard.fd, 0) != 0 ||
+        ::pwrite(guard.fd, content.data(), content.size(), 0) !=
+            static_cast<ssize_t>(content.size())) {
+        throw std::runtime_error("Could not update id lease file '" + m_leasePath + "'");
+    }
+    return base; // flock liberado ao fechar o descritor
+#else
+    // Sem flock no Windows: lease melhor-esforço (apenas um processo por workspace)
+    {
+        std::ifstream in(m_leasePath);
+        in >> stored;
+    }
+    std::uint64_t base = std::max(stored, floor + 1);
+    std::ofstream out(m_leasePath, std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Could not update id lease file '" + m_leasePath + "'");
+    }
+    out << (base + m_blockSize) << "\n";
+    return base;
+#endif
+}
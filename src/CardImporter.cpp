@@ -0,0 +1,413 @@
+#include "CardImporter.h"
+#include "external/json.hpp"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @file CardImporter.cpp
+ * @brief Implementação da leitura paralela de CSV e JSON Lines.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+using json = nlohmann::json;
+
+namespace {
+
+enum class Field { Ignore, Id, Title, Description, Column, Priority, Tags, Assignee };
+
+// Resultado de um bloco; a linha do erro é relativa ao início do bloco
+struct Chunk {
+    std::string_view data;
+    std::vector<CardImporter::Row> rows;
+    std::string error;
+    size_t errorLine { 0 };
+};
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+        text.remove_suffix(1);
+    }
+    return text;
+}
+
+std::string lower(std::string_view text) {
+    std::string result(text);
+    for (auto& c : result) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return result;
+}
+
+Field fieldFor(std::string_view header) {
+    std::string name = lower(trim(header));
+    if (name == "id" || name == "key" || name == "issue key") return Field::Id;
+    if (name == "title" || name == "summary" || name == "name") return Field::Title;
+    if (name == "description") return Field::Description;
+    if (name == "column" || name == "status" || name == "state") return Field::Column;
+    if (name == "priority") return Field::Priority;
+    if (name == "tags" || name == "labels") return Field::Tags;
+    if (name == "assignee" || name == "owner") return Field::Assignee;
+    return Field::Ignore;
+}
+
+int parsePriority(std::string_view text) {
+    text = trim(text);
+    if (text.empty()) {
+        return 0;
+    }
+    int value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (result.ec == std::errc() && result.ptr == text.data() + text.size()) {
+        return value;
+    }
+    static const char* const names[] = {"lowest", "low", "medium", "high", "highest"};
+    std::string name = lower(text);
+    for (int i = 0; i < 5; ++i) {
+        if (name == names[i]) {
+            return i;
+        }
+    }
+    throw std::runtime_error("invalid priority '" + std::string(text) + "'");
+}
+
+void splitTags(std::string_view text, std::vector<std::string>& tags) {
+    while (!text.empty()) {
+        size_t end = std::min(text.find(';'), text.size());
+        std::string_view tag = trim(text.substr(0, end));
+        if (!tag.empty()) {
+            tags.emplace_back(tag);
+        }
+        text.remove_prefix(std::min(end + 1, text.size()));
+    }
+}
+
+/**
+ * Lê um registro CSV a partir de pos. Reaproveita as strings de fields
+ * (count = campos lidos) e soma em line as quebras de linha consumidas.
+ */
+void readCsvRecord(std::string_view data, size_t& pos, size_t& line,
+                   std::vector<std::string>& fields, size_t& count) {
+    count = 0;
+    while (true) {
+        if (count == fields.size()) {
+            fields.emplace_back();
+        }
+        std::string& field = fields[count++];
+        field.clear();
+
+        if (pos < data.size() && data[pos] == '"') {
+            ++pos;
+            while (true) {
+                if (pos >= data.size()) {
+                    throw std::runtime_error("unterminated quoted field");
+                }
+                char c = data[pos++];
+                if (c == '"') {
+                    if (pos < data.size() && data[pos] == '"') {
+                        field.push_back('"');
+                        ++pos;
+                        continue;
+                    }
+                    break;
+                }
+                if (c == '\n') {
+                    ++line;
+                }
+                field.push_back(c);
+            }
+            if (pos < data.size() && data[pos] != ',' && data[pos] != '\r' && data[pos] != '\n') {
+                throw std::runtime_error("unexpected character after quoted field");
+            }
+        } else {
+            size_t start = pos;
+            while (pos < data.size() && data[pos] != ',' && data[pos] != '\r' && data[pos] != '\n') {
+                ++pos;
+            }
+            field.assign(data.data() + start, pos - start);
+        }
+
+        if (pos < data.size() && data[pos] == ',') {
+            ++pos;
+            continue;
+        }
+        break;
+    }
+
+    if (pos < data.size() && data[pos] == '\r') {
+        ++pos;
+    }
+    if (pos < data.size() && data[pos] == '\n') {
+        ++pos;
+        ++line;
+    }
+}
+
+void parseCsvChunk(Chunk& chunk, const std::vector<Field>& mapping) {
+    std::vector<std::string> fields;
+    size_t count = 0;
+    size_t pos = 0;
+    size_t line = 1;
+    size_t recordLine = 1;
+    try {
+        while (pos < chunk.data.size()) {
+            recordLine = line;
+            readCsvRecord(chunk.data, pos, line, fields, count);
+            if (count == 1 && trim(fields[0]).empty()) {
+                continue; // Linha em branco
+            }
+
+            CardImporter::Row row;
+            for (size_t i = 0; i < count && i < mapping.size(); ++i) {
+                std::string& value = fields[i];
+                switch (mapping[i]) {
+                    case Field::Id:          row.id = trim(value); break;
+                    case Field::Title:       row.title = std::move(value); break;
+                    case Field::Description: row.description = std::move(value); break;
+                    case Field::Column:      row.column = trim(value); break;
+                    case Field::Assignee:    row.assignee = trim(value); break;
+                    case Field::Priority:    row.priority = parsePriority(value); break;
+                    case Field::Tags:        splitTags(value, row.tags); break;
+                    case Field::Ignore:      break;
+                }
+            }
+            if (trim(row.title).empty()) {
+                throw std::runtime_error("missing title");
+            }
+            chunk.rows.push_back(std::move(row));
+        }
+    } catch (const std::exception& e) {
+        chunk.error = e.what();
+        chunk.errorLine = recordLine;
+    }
+}
+
+std::string stringField(const json& object, const char* key) {
+    auto it = object.find(key);
+    if (it == object.end() || it->is_null()) {
+        return std::string();
+    }
+    if (!it->is_string()) {
+        throw std::runtime_error(std::string("field '") + key + "' must be a string");
+    }
+    return it->get<std::string>();
+}
+
+void parseJsonLinesChunk(Chunk& chunk) {
+    size_t pos = 0;
+    size_t line = 0;
+    try {
+        while (pos < chunk.data.size()) {
+            ++line;
+            size_t end = std::min(chunk.data.find('\n', pos), chunk.data.size());
+            std::string_view text = trim(chunk.data.substr(pos, end - pos));
+            pos = end + 1;
+            if (text.empty()) {
+                continue;
+            }
+
+            json object = json::parse(text.data(), text.data() + text.size());
+            if (!object.is_object()) {
+                throw std::runtime_error("expected a JSON object");
+            }
+
+            CardImporter::Row row;
+            row.id = stringField(object, "id");
+            row.title = stringField(object, "title");
+            row.description = stringField(object, "description");
+            row.column = stringField(object, "column");
+            if (row.column.empty()) {
+                row.column = stringField(object, "status");
+            }
+            row.assignee = stringField(object, "assignee");
+            if (row.assignee.empty()) {
+                row.assignee = stringField(object, "assigneeId");
+            }
+
+            auto priority = object.find("priority");
+            if (priority != object.end() && priority->is_number_integer()) {
+                row.priority = priority->get<int>();
+            } else if (priority != object.end() && priority->is_string()) {
+                row.priority = parsePriority(priority->get_ref<const std::string&>());
+            }
+
+            auto tags = object.find("tags");
+            if (tags != object.end() && tags->is_array()) {
+                for (const auto& tag : *tags) {
+                    if (tag.is_string()) {
+                        row.tags.push_back(tag.get<std::string>());
+                    }
+                }
+            } else if (tags != object.end() && tags->is_string()) {
+                splitTags(tags->get_ref<const std::string&>(), row.tags);
+            }
+
+            if (trim(row.title).empty()) {
+                throw std::runtime_error("missing title");
+            }
+            chunk.rows.push_back(std::move(row));
+        }
+    } catch (const std::exception& e) {
+        chunk.error = e.what();
+        chunk.errorLine = line;
+    }
+}
+
+/**
+ * Divide data em até count blocos terminados em fim de registro. Em CSV,
+ * uma quebra de linha só encerra registro fora de aspas: a paridade das
+ * aspas antes de cada corte é obtida contando aspas por faixa em paralelo.
+ */
+std::vector<size_t> chunkBoundaries(std::string_view data, size_t count, bool quoted) {
+    std::vector<size_t> raw(count + 1);
+    for (size_t i = 0; i <= count; ++i) {
+        raw[i] = data.size() * i / count;
+    }
+
+    std::vector<size_t> quotes(count, 0);
+    if (quoted) {
+        std::vector<std::thread> counters;
+        for (size_t i = 0; i < count; ++i) {
+            counters.emplace_back([&, i]() {
+                quotes[i] = static_cast<size_t>(std::count(data.begin() + static_cast<std::ptrdiff_t>(raw[i]),
+                                                           data.begin() + static_cast<std::ptrdiff_t>(raw[i + 1]), '"'));
+            });
+        }
+        for (auto& counter : counters) {
+            counter.join();
+        }
+    }
+
+    std::vector<size_t> cuts(count + 1, data.size());
+    cuts[0] = 0;
+    bool inQuotes = false;
+    for (size_t i = 1; i < count; ++i) {
+        inQuotes ^= (quotes[i - 1] % 2) != 0;
+        size_t pos = std::max(raw[i], cuts[i - 1]);
+        bool open = inQuotes;
+        if (pos != raw[i]) {
+            // O corte anterior passou deste ponto: a paridade vale a partir dele
+            open = false;
+        }
+        while (pos < data.size()) {
+            char c = data[pos++];
+            if (c == '"' && quoted) {
+                open = !open;
+            } else if (c == '\n' && !open) {
+                break;
+            }
+        }
+        cuts[i] = pos;
+    }
+    return cuts;
+}
+
+} // namespace
+
+CardImporter::Format CardImporter::detectFormat(const std::string& filename) {
+    std::string name = lower(filename);
+    auto endsWith = [&name](const char* suffix) {
+        std::string_view s(suffix);
+        return name.size() >= s.size() && name.compare(name.size() - s.size(), s.size(), s) == 0;
+    };
+    if (endsWith(".csv")) {
+        return Format::Csv;
+    }
+    if (endsWith(".jsonl") || endsWith(".ndjson")) {
+        return Format::JsonLines;
+    }
+    return Format::JsonArray;
+}
+
+std::vector<CardImporter::Row> CardImporter::parseFile(const std::string& filename, unsigned threads) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+    file.seekg(0, std::ios::end);
+    std::string data(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(&data[0], static_cast<std::streamsize>(data.size()));
+    if (!file) {
+        throw std::runtime_error("Could not read file: " + filename);
+    }
+    return parse(data, detectFormat(filename), threads);
+}
+
+std::vector<CardImporter::Row> CardImporter::parse(std::string_view data, Format format, unsigned threads) {
+    if (format == Format::JsonArray) {
+        throw std::invalid_argument("CardImporter parses CSV and JSON Lines only");
+    }
+    if (data.size() >= 3 && data.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+        data.remove_prefix(3); // BOM UTF-8 (exportações de planilhas)
+    }
+
+    // Cabeçalho CSV: mapeia a posição de cada coluna para um campo do card
+    std::vector<Field> mapping;
+    size_t headerLines = 0;
+    if (format == Format::Csv) {
+        std::vector<std::string> fields;
+        size_t count = 0;
+        size_t pos = 0;
+        try {
+            readCsvRecord(data, pos, headerLines, fields, count);
+        } catch (const std::exception& e) {
+            throw std::runtime_error("line 1: " + std::string(e.what()));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            mapping.push_back(fieldFor(fields[i]));
+        }
+        if (std::find(mapping.begin(), mapping.end(), Field::Title) == mapping.end()) {
+            throw std::runtime_error("line 1: CSV header has no title column");
+        }
+        data.remove_prefix(pos);
+    }
+
+    size_t count = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+    count = std::max<size_t>(1, std::min(count, data.size() / MIN_CHUNK_SIZE));
+    std::vector<size_t> cuts = chunkBoundaries(data, count, format == Format::Csv);
+
+    std::vector<Chunk> chunks(count);
+    for (size_t i = 0; i < count; ++i) {
+        chunks[i].data = data.substr(cuts[i], cuts[i + 1] - cuts[i]);
+    }
+    auto work = [&](size_t i) {
+        if (format == Format::Csv) {
+            parseCsvChunk(chunks[i], mapping);
+        } else {
+            parseJsonLinesChunk(chunks[i]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < count; ++i) {
+        workers.emplace_back(work, i);
+    }
+    work(0);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    size_t total = 0;
+    size_t lineOffset = headerLines;
+    for (const auto& chunk : chunks) {
+        if (!chunk.error.empty()) {
+            throw std::runtime_error("line " + std::to_string(lineOffset + chunk.errorLine) + ": " + chunk.error);
+        }
+        lineOffset += static_cast<size_t>(std::count(chunk.data.begin(), chunk.data.end(), '\n'));
+        total += chunk.rows.size();
+    }
+
+    std::vector<Row> rows;
+    rows.reserve(total);
+    for (auto& chunk : chunks) {
+        std::move(chunk.rows.begin(), chunk.rows.end(), std::back_inserter(rows));
+    }
+    return rows;
+}
@@ -1,5 +1,6 @@
 #include "Column.h"
 #include "Card.h"
+#include "RankKey.h"
 #include <algorithm>
 #include <stdexcept>
 
@@ -28,15 +29,194 @@ Column::Column(std::string name, int wipLimit)
  * @return true se adicionado com sucesso, false se limite WIP atingido
  */
 bool Column::addCard(const Card& card) {
+    return insertCard(card, m_cards.size());
+}
+
+/**
+ * @brief Insere cartão na posição indicada gerando chave entre os vizinhos.
+ * @param card Cartão a ser inserido
+ * @param position Índice de destino (limitado ao fim da coluna)
+ * @return true se inserido, false se limite WIP atingido
+ */
+bool Column::insertCard(const Card& card, size_t position) {
     // Verifica limite WIP se ativo (-1 significa sem limite)
-    if (m_wipLimit != -1 && static_cast<int>(m_cards.size()) >= m_wipLimit) {
+    if (isFull()) {
         return false; // Limite atingido
     }
     
-    m_cards.push_back(card);
+    position = std::min(position, m_cards.size());
+    auto it = m_cards.insert(m_cards.begin() + static_cast<std::ptrdiff_t>(position), card);
+    it->setRank(rankForPosition(position));
+    ++m_version;
+    return true;
+}
+
+/**
+ * @brief Insere cartão na posição definida pela sua chave.
+ * @param card Cartão com chave de ordenação
+ * @return true se inserido, false se limite WIP atingido
+ */
+bool Column::insertCardByRank(const Card& card) {
+    if (!RankKey::isValid(card.getRank())) {
+        return addCard(card);
+    }
+    if (isFull()) {
+        return false;
+    }
+    
+    auto it = std::upper_bound(m_cards.begin(), m_cards.end(), card.getRank(),
+        [](const std::string& rank, const Card& existing) { return rank < existing.getRank(); });
+    size_t position = static_cast<size_t>(it - m_cards.begin());
+    
+    it = m_cards.insert(it, card);
+    
+    // Chave repetida (ex.: arquivo editado à mão): gera nova entre os vizinhos
+    if (position > 0 && m_cards[position - 1].getRank() == it->getRank()) {
+        it->setRank(rankForPosition(position));
+    }
+    ++m_version;
+    return true;
+}
+
+/**
+ * @brief Anexa vários cartões ao fim da coluna.
+ * @param cards Cartões a anexar
+ * @return true se anexados, false se excedem o limite WIP
+ */
+bool Column::appendCards(std::vector<Card> cards) {
+    if (m_wipLimit != -1 && m_cards.size() + cards.size() > static_cast<size_t>(std::max(m_wipLimit, 0))) {
+        return false;
+    }
+    
+    if (!m_cards.empty() && !RankKey::isValid(m_cards.back().getRank())) {
+        renumberRanks();
+    }
+    
+    std::string previous = m_cards.empty() ? std::string() : m_cards.back().getRank();
+    m_cards.reserve(m_cards.size() + cards.size());
+    for (auto& card : cards) {
+        previous = RankKey::between(previous, std::string());
+        card.setRank(previous);
+        m_cards.push_back(std::move(card));
+    }
+    ++m_version;
+    return true;
+}
+
+/**
+ * @brief Retira os cartões indicados em uma única passada.
+ * @param ids IDs a retirar
+ * @param extracted Destino dos cartões retirados
+ * @return Quantidade retirada
+ */
+size_t Column::extractCards(const std::unordered_set<std::string>& ids, std::vector<Card>& extracted) {
+    size_t before = extracted.size();
+    auto keep = m_cards.begin();
+    for (auto it = m_cards.begin(); it != m_cards.end(); ++it) {
+        if (ids.count(it->getId())) {
+            extracted.push_back(std::move(*it));
+        } else {
+            if (keep != it) {
+                *keep = std::move(*it);
+            }
+            ++keep;
+        }
+    }
+    m_cards.erase(keep, m_cards.end());
+    if (extracted.size() != before) {
+        ++m_version;
+    }
+    return extracted.size() - before;
+}
+
+/**
+ * @brief Reposiciona um cartão antes de outro na mesma coluna.
+ * @param cardId ID do cartão a mover
+ * @param anchorId ID do cartão que ficará depois ("" = fim)
+ * @return true se reposicionado
+ */
+bool Column::moveCardBefore(const std::string& cardId, const std::string& anchorId) {
+    if (cardId == anchorId) {
+        return false;
+    }
+    
+    // Uma única varredura localiza o card e a âncora
+    int from = -1;
+    int anchor = anchorId.empty() ? static_cast<int>(m_cards.size()) : -1;
+    for (size_t i = 0; i < m_cards.size() && (from < 0 || anchor < 0); ++i) {
+        const std::string& id = m_cards[i].getId();
+        if (from < 0 && id == cardId) {
+            from = static_cast<int>(i);
+        } else if (anchor < 0 && id == anchorId) {
+            anchor = static_cast<int>(i);
+        }
+    }
+    if (from < 0 || anchor < 0) {
+        return false;
+    }
+    
+    // Posição final considerando a remoção do card da posição original
+    size_t target = static_cast<size_t>(anchor > from ? anchor - 1 : anchor);
+    auto begin = m_cards.begin();
+    auto source = begin + from;
+    auto destination = begin + static_cast<std::ptrdiff_t>(target);
+    
+    if (source < destination) {
+        std::rotate(source, source + 1, destination + 1);
+    } else if (destination < source) {
+        std::rotate(destination, source, source + 1);
+    }
+    
+    // Somente o card movido recebe chave nova
+    m_cards[target].setRank(rankForPosition(target), true);
+    ++m_version;
     return true;
 }
 
+/**
+ * @brief Retorna a posição do cartão na coluna.
+ * @param cardId ID do cartão
+ * @return Índice ou -1 se não encontrado
+ */
+int Column::indexOfCard(const std::string& cardId) const {
+    auto it = std::find_if(m_cards.begin(), m_cards.end(),
+        [&cardId](const Card& card) { return card.getId() == cardId; });
+    
+    return (it != m_cards.end()) ? static_cast<int>(it - m_cards.begin()) : -1;
+}
+
+/**
+ * @brief Gera chave para o card em position, entre os vizinhos imediatos.
+ * @param position Índice do card já posicionado no vetor
+ * @return Nova chave de ordenação
+ */
+std::string Column::rankForPosition(size_t position) {
+    const std::string empty;
+    const std::string& lo = position > 0 ? m_cards[position - 1].getRank() : empty;
+    const std::string& hi = position + 1 < m_cards.size() ? m_cards[position + 1].getRank() : empty;
+    
+    try {
+        return RankKey::between(lo, hi);
+    } catch (const std::invalid_argument&) {
+        // Vizinhos sem chave/fora de ordem (vetor alterado via getCards()):
+        // renumera a coluna uma vez e tenta de novo
+        renumberRanks();
+        return m_cards[position].getRank();
+    }
+}
+
+/**
+ * @brief Atribui chaves sequenciais a todos os cards na ordem atual do vetor.
+ */
+void Column::renumberRanks() {
+    ++m_rankGeneration;
+    std::string previous;
+    for (auto& card : m_cards) {
+        previous = RankKey::between(previous, std::string());
+        card.setRank(previous);
+    }
+}
+
 /**
  * @brief Remove um cartão da coluna pelo ID.
  * @param cardId ID do cartão a ser removido
@@ -48,6 +228,7 @@ bool Column::removeCard(const std::string& cardId) {
     
     if (it != m_cards.end()) {
         m_cards.erase(it);
+        ++m_version;
         return true;
     }
     return false;
@@ -120,6 +301,33 @@ int Column::getWipLimit() const {
     return m_wipLimit;
 }
 
+/**
+ * @brief Retorna a versão da coluna.
+ * @return Contador de alterações
+ */
+std::uint64_t Column::getVersion() const {
+    return m_version;
+}
+
+/**
+ * @brief Retorna a geração das chaves de ordenação.
+ * @return Renumerações completas desde a construção
+ */
+std::uint64_t Column::getRankGeneration() const {
+    return m_rankGeneration;
+}
+
+/**
+ * @brief Altera o limite WIP da coluna.
+ * @param wipLimit Novo limite (-1 = sem limite)
+ */
+void Column::setWipLimit(int wipLimit) {
+    if (m_wipLimit != wipLimit) {
+        m_wipLimit = wipLimit;
+        ++m_version;
+    }
+}
+
 size_t Column::getCardCount() const {
     return m_cards.size();
 }
@@ -141,7 +349,8 @@ json Column::toJson() const {
     return json{
         {"name", m_name},
         {"wipLimit", m_wipLimit},
-        {"cards", cardsArray}
+        {"cards", cardsArray},
+        {"version", m_version}
     };
 }
 
@@ -177,7 +386,7 @@ Column Column::fromJson(const json& j) {
         for (const auto& cardJson : j["cards"]) {
             try {
                 Card card = Card::fromJson(cardJson);
-                column.addCard(std::move(card));
+                column.insertCardByRank(card); // Sem chave: vai para o fim
             } catch (const std::exception& e) {
                 // Log erro mas continua carregando outros cards
                 // (robustez: não falha toda a coluna por um card inválido)
@@ -185,5 +394,6 @@ Column Column::fromJson(const json& j) {
         }
     }
 
+    column.m_version = j.value("version", std::uint64_t(0));
     return column;
 }
\ No newline at end of file
@@ -0,0 +1,352 @@
+#include "Command.h"
+#include <utility>
+
+/**
+ * @file Command.cpp
+ * @brief Implementação dos comandos reversíveis sobre Board.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+// ---------------------------------------------------------------- AddCard
+
+/**
+ * @brief Construtor.
+ * @param column Coluna destino
+ * @param card Card a incluir
+ */
+AddCardCommand::AddCardCommand(std::string column, Card card)
+    : m_column(std::move(column)), m_card(std::move(card))
+{
+}
+
+/**
+ * @brief Inclui o card no fim da coluna.
+ * @param board Board alvo
+ * @return true se incluído
+ */
+bool AddCardCommand::execute(Board& board) {
+    return board.addCard(m_column, m_card);
+}
+
+/**
+ * @brief Remove o card incluído.
+ * @param board Board alvo
+ * @return true se removido
+ */
+bool AddCardCommand::undo(Board& board) {
+    return board.removeCard(m_column, m_card.getId());
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string AddCardCommand::describe() const {
+    return "add card '" + m_card.getId() + "' to '" + m_column + "'";
+}
+
+// ------------------------------------------------------------- RemoveCard
+
+/**
+ * @brief Construtor.
+ * @param column Coluna que contém o card
+ * @param cardId Card a remover
+ */
+RemoveCardCommand::RemoveCardCommand(std::string column, std::string cardId)
+    : m_column(std::move(column)), m_cardId(std::move(cardId))
+{
+}
+
+/**
+ * @brief Captura card e índice e remove da coluna.
+ * @param board Board alvo
+ * @return true se removido
+ */
+bool RemoveCardCommand::execute(Board& board) {
+    const Column* column = board.findColumn(m_column);
+    const Card* card = column ? column->findCard(m_cardId) : nullptr;
+    if (!card) {
+        return false;
+    }
+
+    Card removed = *card;
+    size_t index = static_cast<size_t>(column->indexOfCard(m_cardId));
+    if (!board.removeCard(m_column, m_cardId)) {
+        return false;
+    }
+    m_removed = std::move(removed);
+    m_previousIndex = index;
+    return true;
+}
+
+/**
+ * @brief Reinsere o card no índice original.
+ * @param board Board alvo
+ * @return true se reinserido
+ */
+bool RemoveCardCommand::undo(Board& board) {
+    return m_removed && board.addCard(m_column, *m_removed, m_previousIndex);
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string RemoveCardCommand::describe() const {
+    return "remove card '" + m_cardId + "' from '" + m_column + "'";
+}
+
+// --------------------------------------------------------------- MoveCard
+
+/**
+ * @brief Construtor.
+ * @param cardId Card a mover
+ * @param fromCol Coluna origem
+ * @param toCol Coluna destino (igual à origem = reordenar)
+ * @param position Índice final no destino
+ */
+MoveCardCommand::MoveCardCommand(std::string cardId, std::string fromCol, std::string toCol,
+                                 size_t position)
+    : m_cardId(std::move(cardId)), m_fromCol(std::move(fromCol)), m_toCol(std::move(toCol)),
+      m_position(position)
+{
+}
+
+/**
+ * @brief Guarda o índice atual e move o card.
+ * @param board Board alvo
+ * @return true se movido
+ */
+bool MoveCardCommand::execute(Board& board) {
+    const Column* from = board.findColumn(m_fromCol);
+    int index = from ? from->indexOfCard(m_cardId) : -1;
+    if (index < 0 || !board.moveCard(m_cardId, m_fromCol, m_toCol, m_position)) {
+        return false;
+    }
+    m_previousIndex = static_cast<size_t>(index);
+    return true;
+}
+
+/**
+ * @brief Devolve o card à coluna e índice de origem.
+ * @param board Board alvo
+ * @return true se devolvido
+ */
+bool MoveCardCommand::undo(Board& board) {
+    return board.moveCard(m_cardId, m_toCol, m_fromCol, m_previousIndex);
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string MoveCardCommand::describe() const {
+    if (m_fromCol == m_toCol) {
+        return "reorder card '" + m_cardId + "' in '" + m_fromCol + "'";
+    }
+    return "move card '" + m_cardId + "' from '" + m_fromCol + "' to '" + m_toCol + "'";
+}
+
+// --------------------------------------------------------------- EditCard
+
+/**
+ * @brief Construtor.
+ * @param cardId Card a editar
+ * @param title Novo título (nullopt = não altera)
+ * @param description Nova descrição (nullopt = não altera)
+ * @param priority Nova prioridade (nullopt = não altera)
+ */
+EditCardCommand::EditCardCommand(std::string cardId, std::optional<std::string> title,
+                                 std::optional<std::string> description, std::optional<int> priority)
+    : m_cardId(std::move(cardId)), m_title(std::move(title)),
+      m_description(std::move(description)), m_priority(priority)
+{
+}
+
+/**
+ * @brief Aplica os campos novos (os antigos ficam guardados).
+ * @param board Board alvo
+ * @return true se o card existe
+ */
+bool EditCardCommand::execute(Board& board) {
+    return swapFields(board);
+}
+
+/**
+ * @brief Restaura os campos antigos (os novos ficam guardados para refazer).
+ * @param board Board alvo
+ * @return true se o card existe
+ */
+bool EditCardCommand::undo(Board& board) {
+    return swapFields(board);
+}
+
+/**
+ * @brief Troca valor do card ↔ valor guardado para cada campo editado.
+ * @param board Board alvo
+ * @return true se o card existe
+ */
+bool EditCardCommand::swapFields(Board& board) {
+    const Card* card = board.findCard(m_cardId);
+    if (!card) {
+        return false;
+    }
+
+    // Valores atuais viram os guardados; Board aplica e registra o diff
+    std::optional<std::string> title =
+        m_title ? std::optional<std::string>(card->getTitle()) : std::nullopt;
+    std::optional<std::string> description =
+        m_description ? std::optional<std::string>(card->getDescription()) : std::nullopt;
+    std::optional<int> priority = m_priority ? std::optional<int>(card->getPriority()) : std::nullopt;
+
+    if (!board.updateCard(m_cardId, m_title, m_description, m_priority)) {
+        return false;
+    }
+    m_title = std::move(title);
+    m_description = std::move(description);
+    m_priority = priority;
+    return true;
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string EditCardCommand::describe() const {
+    return "edit card '" + m_cardId + "'";
+}
+
+// ---------------------------------------------------------------- TagCard
+
+/**
+ * @brief Construtor.
+ * @param cardId Card alvo
+ * @param tag Tag a adicionar/remover
+ * @param add true = adicionar, false = remover
+ */
+TagCardCommand::TagCardCommand(std::string cardId, std::string tag, bool add)
+    : m_cardId(std::move(cardId)), m_tag(std::move(tag)), m_add(add)
+{
+}
+
+/**
+ * @brief Aplica a alteração de tag e registra se houve mudança.
+ * @param board Board alvo
+ * @return true se o card existe
+ */
+bool TagCardCommand::execute(Board& board) {
+    const Card* card = board.findCard(m_cardId);
+    if (!card) {
+        return false;
+    }
+
+    m_changed = card->hasTag(m_tag) != m_add;
+    return board.tagCard(m_cardId, m_tag, m_add);
+}
+
+/**
+ * @brief Reverte a alteração de tag (se houve).
+ * @param board Board alvo
+ * @return true se o card existe
+ */
+bool TagCardCommand::undo(Board& board) {
+    if (!m_changed) {
+        return board.findCard(m_cardId) != nullptr;
+    }
+    return board.tagCard(m_cardId, m_tag, !m_add);
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string TagCardCommand::describe() const {
+    return (m_add ? "tag card '" : "untag card '") + m_cardId + "' with '" + m_tag + "'";
+}
+
+// -------------------------------------------------------------- AddColumn
+
+/**
+ * @brief Construtor.
+ * @param column Coluna a incluir
+ */
+AddColumnCommand::AddColumnCommand(Column column)
+    : m_column(std::move(column))
+{
+}
+
+/**
+ * @brief Inclui a coluna no fim do board.
+ * @param board Board alvo
+ * @return true se incluída
+ */
+bool AddColumnCommand::execute(Board& board) {
+    return board.addColumn(m_column);
+}
+
+/**
+ * @brief Remove a coluna incluída.
+ * @param board Board alvo
+ * @return true se removida
+ */
+bool AddColumnCommand::undo(Board& board) {
+    return board.removeColumn(m_column.getName());
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string AddColumnCommand::describe() const {
+    return "add column '" + m_column.getName() + "'";
+}
+
+// ----------------------------------------------------------- RemoveColumn
+
+/**
+ * @brief Construtor.
+ * @param name Coluna a remover
+ */
+RemoveColumnCommand::RemoveColumnCommand(std::string name)
+    : m_name(std::move(name))
+{
+}
+
+/**
+ * @brief Captura coluna e posição e remove do board.
+ * @param board Board alvo
+ * @return true se removida
+ */
+bool RemoveColumnCommand::execute(Board& board) {
+    const Column* column = board.findColumn(m_name);
+    if (!column) {
+        return false;
+    }
+
+    Column removed = *column;
+    size_t index = static_cast<size_t>(column - board.getColumns().data());
+    if (!board.removeColumn(m_name)) {
+        return false;
+    }
+    m_removed = std::move(removed);
+    m_previousIndex = index;
+    return true;
+}
+
+/**
+ * @brief Reinsere a coluna (com seus cards) na posição original.
+ * @param board Board alvo
+ * @return true se reinserida
+ */
+bool RemoveColumnCommand::undo(Board& board) {
+    return m_removed && board.addColumn(*m_removed, m_previousIndex);
+}
+
+/**
+ * @brief Descrição do comando.
+ * @return Texto descritivo
+ */
+std::string RemoveColumnCommand::describe() const {
+    return "remove column '" + m_name + "'";
+}
@@ -0,0 +1,117 @@
+#include "CommandDispatcher.h"
+#include <charconv>
+
+/**
+ * @file CommandDispatcher.cpp
+ * @brief Implementação do despacho de comandos por tabela.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+// ============================================================================
+// CommandArgs
+// ============================================================================
+
+CommandArgs::CommandArgs(const std::vector<std::string_view>& args, size_t first)
+    : m_args(args), m_first(first)
+{
+}
+
+size_t CommandArgs::size() const {
+    return m_args.size() > m_first ? m_args.size() - m_first : 0;
+}
+
+std::string_view CommandArgs::operator[](size_t index) const {
+    return m_args.at(m_first + index);
+}
+
+std::string_view CommandArgs::get(size_t index, std::string_view fallback) const {
+    return index < size() ? (*this)[index] : fallback;
+}
+
+int CommandArgs::integer(size_t index, const char* what) const {
+    return toInteger((*this)[index], what);
+}
+
+// from_chars lê direto do string_view (sem terminador '\0' nem cópia)
+int CommandArgs::toInteger(std::string_view text, const char* what) {
+    int value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        throw Error(std::string("Invalid ") + what + " '" + std::string(text) + "'.");
+    }
+    return value;
+}
+
+size_t CommandArgs::count(size_t index, const char* what) const {
+    std::string_view text = (*this)[index];
+    size_t value = 0;
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || result.ec != std::errc() || result.ptr != text.data() + text.size()) {
+        throw Error(std::string("Invalid ") + what + " '" + std::string(text) + "'.");
+    }
+    return value;
+}
+
+// ============================================================================
+// CommandDispatcher
+// ============================================================================
+
+void CommandDispatcher::add(const std::string& verb, size_t minArgs, size_t maxArgs,
+                            const std::string& usage, Handler handler) {
+    Verb& entry = m_verbs[verb];
+    if (entry.direct) {
+        throw std::invalid_argument("Command '" + verb + "' registered twice");
+    }
+    entry.direct.reset(new Spec{minArgs, maxArgs, usage, std::move(handler)});
+}
+
+void CommandDispatcher::add(const std::string& verb, const std::string& subverb, size_t minArgs,
+                            size_t maxArgs, const std::string& usage, Handler handler) {
+    if (!m_verbs[verb].subverbs.emplace(subverb, Spec{minArgs, maxArgs, usage, std::move(handler)}).second) {
+        throw std::invalid_argument("Command '" + verb + " " + subverb + "' registered twice");
+    }
+}
+
+/**
+ * @param args Verbo, subverbo e operandos
+ * @param message Sintaxe ou erro de operando para o usuário
+ * @return Resultado
+ */
+CommandDispatcher::Result CommandDispatcher::dispatch(const std::vector<std::string_view>& args,
+                                                      std::string& message) const {
+    if (args.empty()) {
+        return Result::UnknownVerb;
+    }
+    auto verb = m_verbs.find(args[0]);
+    if (verb == m_verbs.end()) {
+        return Result::UnknownVerb;
+    }
+
+    if (args.size() > 1) {
+        auto sub = verb->second.subverbs.find(args[1]);
+        if (sub != verb->second.subverbs.end()) {
+            return run(sub->second, args, 2, message);
+        }
+    }
+    if (verb->second.direct) {
+        return run(*verb->second.direct, args, 1, message);
+    }
+    return Result::UnknownSubverb;
+}
+
+CommandDispatcher::Result CommandDispatcher::run(const Spec& spec, const std::vector<std::string_view>& args,
+                                                 size_t first, std::string& message) {
+    size_t operands = args.size() - first;
+    if (operands < spec.minArgs || operands > spec.maxArgs) {
+        message = spec.usage;
+        return Result::BadArity;
+    }
+    try {
+        spec.handler(CommandArgs(args, first));
+    } catch (const CommandArgs::Error& e) {
+        message = e.what();
+        return Result::BadArgument;
+    }
+    return Result::Handled;
+}
@@ -0,0 +1,146 @@
+#include "CommandHistory.h"
+#include <algorithm>
+
+/**
+ * @file CommandHistory.cpp
+ * @brief Implementação do histórico de desfazer/refazer.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @brief Construtor.
+ * @param capacity Quantidade máxima de comandos
+ */
+CommandHistory::CommandHistory(size_t capacity)
+    : m_ring(std::max<size_t>(capacity, 1))
+{
+}
+
+/**
+ * @brief Executa e registra o comando.
+ * @param board Board alvo
+ * @param command Comando a executar
+ * @return true se executado
+ */
+bool CommandHistory::execute(Board& board, std::unique_ptr<Command> command) {
+    if (!command || !command->execute(board)) {
+        return false;
+    }
+
+    // Comando novo invalida o que poderia ser refeito
+    for (size_t i = 0; i < m_redoCount; ++i) {
+        at(m_undoCount + i) = Entry();
+    }
+    m_redoCount = 0;
+
+    if (m_undoCount == m_ring.size()) {
+        // Buffer cheio: sobrescreve a entrada mais antiga
+        m_ring[m_head] = Entry{&board, std::move(command)};
+        m_head = (m_head + 1) % m_ring.size();
+    } else {
+        at(m_undoCount) = Entry{&board, std::move(command)};
+        ++m_undoCount;
+    }
+    return true;
+}
+
+/**
+ * @brief Executa com ou sem histórico.
+ * @param history Histórico (nullptr = sem desfazer)
+ * @param board Board alvo
+ * @param command Comando a executar
+ * @return true se executado
+ */
+bool CommandHistory::apply(CommandHistory* history, Board& board, std::unique_ptr<Command> command) {
+    if (history) {
+        return history->execute(board, std::move(command));
+    }
+    return command && command->execute(board);
+}
+
+/**
+ * @brief Desfaz o último comando.
+ * @return true se desfeito
+ */
+bool CommandHistory::undo() {
+    if (m_undoCount == 0) {
+        return false;
+    }
+
+    Entry& entry = at(m_undoCount - 1);
+    if (!entry.command->undo(*entry.board)) {
+        clear();
+        return false;
+    }
+    --m_undoCount;
+    ++m_redoCount;
+    return true;
+}
+
+/**
+ * @brief Refaz o último comando desfeito.
+ * @return true se refeito
+ */
+bool CommandHistory::redo() {
+    if (m_redoCount == 0) {
+        return false;
+    }
+
+    Entry& entry = at(m_undoCount);
+    if (!entry.command->execute(*entry.board)) {
+        clear();
+        return false;
+    }
+    ++m_undoCount;
+    --m_redoCount;
+    return true;
+}
+
+/**
+ * @brief Descrição do próximo comando a desfazer.
+ * @return Texto ou "" se nenhum
+ */
+std::string CommandHistory::undoDescription() const {
+    return m_undoCount > 0 ? at(m_undoCount - 1).command->describe() : std::string();
+}
+
+/**
+ * @brief Descrição do próximo comando a refazer.
+ * @return Texto ou "" se nenhum
+ */
+std::string CommandHistory::redoDescription() const {
+    return m_redoCount > 0 ? at(m_undoCount).command->describe() : std::string();
+}
+
+bool CommandHistory::canUndo() const {
+    return m_undoCount > 0;
+}
+
+bool CommandHistory::canRedo() const {
+    return m_redoCount > 0;
+}
+
+size_t CommandHistory::capacity() const {
+    return m_ring.size();
+}
+
+/**
+ * @brief Descarta todos os comandos.
+ */
+void CommandHistory::clear() {
+    for (auto& entry : m_ring) {
+        entry = Entry();
+    }
+    m_head = 0;
+    m_undoCount = 0;
+    m_redoCount = 0;
+}
+
+CommandHistory::Entry& CommandHistory::at(size_t i) {
+    return m_ring[(m_head + i) % m_ring.size()];
+}
+
+const CommandHistory::Entry& CommandHistory::at(size_t i) const {
+    return m_ring[(m_head + i) % m_ring.size()];
+}
@@ -0,0 +1,66 @@
+#include "CommandLine.h"
+
+/**
+ * @file CommandLine.cpp
+ * @brief Implementação do tokenizador de linhas de comando.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+bool isSeparator(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+} // namespace
+
+/**
+ * A leitura (read) nunca fica atrás da escrita (write): cada argumento é
+ * compactado para a esquerda sem sobrescrever o que ainda não foi lido nem
+ * os argumentos anteriores.
+ */
+bool CommandLine::tokenize(std::string& line, std::vector<std::string_view>& tokens) {
+    tokens.clear();
+    const size_t size = line.size();
+    size_t read = 0;
+    size_t write = 0;
+
+    while (true) {
+        while (read < size && isSeparator(line[read])) {
+            ++read;
+        }
+        if (read == size) {
+            return true;
+        }
+
+        size_t start = write;
+        char quote = '\0';
+        while (read < size) {
+            char c = line[read];
+            if (quote == '\0' && isSeparator(c)) {
+                break;
+            }
+            if (c == quote) {
+                quote = '\0';
+                ++read;
+            } else if (quote == '\0' && (c == '"' || c == '\'')) {
+                quote = c;
+                ++read;
+            } else if (c == '\\' && quote != '\'') {
+                if (read + 1 == size) {
+                    return false; // Escape sem caractere
+                }
+                line[write++] = line[read + 1];
+                read += 2;
+            } else {
+                line[write++] = c;
+                ++read;
+            }
+        }
+        if (quote != '\0') {
+            return false; // Aspa aberta
+        }
+        tokens.emplace_back(line.data() + start, write - start);
+    }
+}
@@ -0,0 +1,318 @@
+#include "Compression.h"
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#ifdef KANBAN_LITE_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+/**
+ * @file Compression.cpp
+ * @brief Implementação dos streams comprimidos (gzip via zlib).
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+constexpr size_t kBufferSize = 64 * 1024;
+constexpr unsigned char kGzipMagic[2] = {0x1f, 0x8b};
+
+std::string unavailableMessage(Compression::Codec codec) {
+    return std::string(Compression::name(codec)) + " support was not compiled in (zlib not found)";
+}
+
+#ifdef KANBAN_LITE_HAVE_ZLIB
+
+/**
+ * @brief Descomprime um ou mais membros gzip concatenados.
+ */
+class GzipInputBuffer : public std::streambuf {
+public:
+    explicit GzipInputBuffer(std::unique_ptr<std::filebuf> file)
+        : m_file(std::move(file)), m_in(kBufferSize), m_out(4 * kBufferSize)
+    {
+        if (inflateInit2(&m_stream, 15 + 16) != Z_OK) { // 16: cabeçalho gzip
+            throw std::runtime_error("Could not initialize gzip decoder");
+        }
+        setg(m_out.data(), m_out.data(), m_out.data());
+    }
+
+    ~GzipInputBuffer() override {
+        inflateEnd(&m_stream);
+    }
+
+protected:
+    int_type underflow() override {
+        while (gptr() == egptr()) {
+            if (m_stream.avail_in == 0) {
+                std::streamsize read = m_file->sgetn(m_in.data(), static_cast<std::streamsize>(m_in.size()));
+                if (read <= 0) {
+                    if (m_inMember) {
+                        throw std::runtime_error("Truncated gzip data");
+                    }
+                    return traits_type::eof();
+                }
+                m_stream.next_in = reinterpret_cast<Bytef*>(m_in.data());
+                m_stream.avail_in = static_cast<uInt>(read);
+            }
+            if (!m_inMember) {
+                inflateReset(&m_stream); // Próximo membro (arquivos concatenados)
+                m_inMember = true;
+            }
+
+            m_stream.next_out = reinterpret_cast<Bytef*>(m_out.data());
+            m_stream.avail_out = static_cast<uInt>(m_out.size());
+            int result = inflate(&m_stream, Z_NO_FLUSH);
+            if (result == Z_STREAM_END) {
+                m_inMember = false;
+            } else if (result != Z_OK) {
+                throw std::runtime_error(std::string("Corrupt gzip data: ") +
+                                         (m_stream.msg ? m_stream.msg : "inflate failed"));
+            }
+            setg(m_out.data(), m_out.data(), m_out.data() + (m_out.size() - m_stream.avail_out));
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    std::unique_ptr<std::filebuf> m_file;
+    std::vector<char> m_in;
+    std::vector<char> m_out;
+    z_stream m_stream {};
+    bool m_inMember { false };
+};
+
+/**
+ * @brief Comprime o que é escrito; o trailer sai em finish().
+ */
+class GzipOutputBuffer : public std::streambuf {
+public:
+    explicit GzipOutputBuffer(std::unique_ptr<std::filebuf> file)
+        : m_file(std::move(file)), m_in(kBufferSize), m_out(kBufferSize)
+    {
+        if (deflateInit2(&m_stream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("Could not initialize gzip encoder");
+        }
+        setp(m_in.data(), m_in.data() + m_in.size());
+    }
+
+    ~GzipOutputBuffer() override {
+        deflateEnd(&m_stream);
+    }
+
+    /**
+     * @brief Grava o restante e o trailer, e fecha o arquivo.
+     */
+    bool finish() {
+        if (m_finished) {
+            return true;
+        }
+        m_finished = true;
+        bool ok = compressPending(Z_FINISH);
+        return m_file->close() != nullptr && ok;
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (m_finished || !compressPending(Z_NO_FLUSH)) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    // Sem Z_SYNC_FLUSH: flush() do ostream não deve piorar a compressão
+    int sync() override {
+        return !m_finished && compressPending(Z_NO_FLUSH) && m_file->pubsync() == 0 ? 0 : -1;
+    }
+
+private:
+    bool compressPending(int flush) {
+        m_stream.next_in = reinterpret_cast<Bytef*>(pbase());
+        m_stream.avail_in = static_cast<uInt>(pptr() - pbase());
+        int result = Z_OK;
+        do {
+            m_stream.next_out = reinterpret_cast<Bytef*>(m_out.data());
+            m_stream.avail_out = static_cast<uInt>(m_out.size());
+            result = deflate(&m_stream, flush);
+            if (result == Z_STREAM_ERROR) {
+                return false;
+            }
+            std::streamsize produced = static_cast<std::streamsize>(m_out.size() - m_stream.avail_out);
+            if (produced > 0 && m_file->sputn(m_out.data(), produced) != produced) {
+                return false;
+            }
+        } while (m_stream.avail_out == 0 || (flush == Z_FINISH && result != Z_STREAM_END));
+        setp(m_in.data(), m_in.data() + m_in.size());
+        return true;
+    }
+
+    std::unique_ptr<std::filebuf> m_file;
+    std::vector<char> m_in;
+    std::vector<char> m_out;
+    z_stream m_stream {};
+    bool m_finished { false };
+};
+
+#endif // KANBAN_LITE_HAVE_ZLIB
+
+} // namespace
+
+Compression::Codec Compression::forFilename(const std::string& filename) {
+    const std::string suffix = ".gz";
+    if (filename.size() > suffix.size() &&
+        filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        return Codec::Gzip;
+    }
+    return Codec::None;
+}
+
+Compression::Codec Compression::detect(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    unsigned char magic[2] = {0, 0};
+    file.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    if (file.gcount() == 2 && magic[0] == kGzipMagic[0] && magic[1] == kGzipMagic[1]) {
+        return Codec::Gzip;
+    }
+    return Codec::None;
+}
+
+bool Compression::isAvailable(Codec codec) {
+#ifdef KANBAN_LITE_HAVE_ZLIB
+    return codec == Codec::None || codec == Codec::Gzip;
+#else
+    return codec == Codec::None;
+#endif
+}
+
+const char* Compression::name(Codec codec) {
+    return codec == Codec::Gzip ? "gzip" : "none";
+}
+
+/**
+ * Usado para segmentos selados do activity log: a cópia é feita em blocos,
+ * sem carregar o arquivo inteiro.
+ */
+void Compression::compressFile(const std::string& filename, Codec codec) {
+    const std::string temporary = filename + ".tmp";
+    {
+        CompressedIFStream in(filename);
+        if (!in.is_open()) {
+            throw std::runtime_error("Could not open file for reading: " + filename);
+        }
+        CompressedOFStream out(temporary, codec);
+        if (!out.is_open()) {
+            throw std::runtime_error("Could not open file for writing: " + temporary);
+        }
+        if (in.peek() != std::char_traits<char>::eof()) {
+            out << in.rdbuf();
+        }
+        out.close();
+        if (!out) {
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Could not write file: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), filename.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Could not replace file: " + filename);
+    }
+}
+
+CompressedIFStream::CompressedIFStream(const std::string& filename, std::streamoff offset)
+    : std::istream(nullptr)
+{
+    auto file = std::make_unique<std::filebuf>();
+    if (!file->open(filename, std::ios::in | std::ios::binary) ||
+        file->pubseekpos(offset, std::ios::in) != std::streampos(offset)) {
+        setstate(std::ios::failbit);
+        return;
+    }
+
+    char magic[2] = {0, 0};
+    std::streamsize read = file->sgetn(magic, sizeof(magic));
+    file->pubseekpos(offset, std::ios::in);
+    if (read == 2 && static_cast<unsigned char>(magic[0]) == kGzipMagic[0] &&
+        static_cast<unsigned char>(magic[1]) == kGzipMagic[1]) {
+        m_codec = Compression::Codec::Gzip;
+    }
+
+    if (m_codec == Compression::Codec::None) {
+        m_buffer = std::move(file);
+    } else {
+#ifdef KANBAN_LITE_HAVE_ZLIB
+        m_buffer = std::make_unique<GzipInputBuffer>(std::move(file));
+#else
+        throw std::runtime_error(unavailableMessage(m_codec) + ": " + filename);
+#endif
+    }
+    rdbuf(m_buffer.get());
+}
+
+CompressedIFStream::~CompressedIFStream() = default;
+
+bool CompressedIFStream::is_open() const {
+    return m_buffer != nullptr;
+}
+
+Compression::Codec CompressedIFStream::codec() const {
+    return m_codec;
+}
+
+CompressedOFStream::CompressedOFStream(const std::string& filename, Compression::Codec codec, bool append)
+    : std::ostream(nullptr), m_codec(codec)
+{
+    if (!Compression::isAvailable(codec)) {
+        throw std::runtime_error(unavailableMessage(codec) + ": " + filename);
+    }
+
+    auto file = std::make_unique<std::filebuf>();
+    if (!file->open(filename, std::ios::out | std::ios::binary | (append ? std::ios::app : std::ios::trunc))) {
+        setstate(std::ios::failbit);
+        return;
+    }
+
+    if (codec == Compression::Codec::None) {
+        m_buffer = std::move(file);
+    } else {
+#ifdef KANBAN_LITE_HAVE_ZLIB
+        m_buffer = std::make_unique<GzipOutputBuffer>(std::move(file));
+#endif
+    }
+    rdbuf(m_buffer.get());
+    m_open = true;
+}
+
+CompressedOFStream::~CompressedOFStream() {
+    close();
+}
+
+bool CompressedOFStream::is_open() const {
+    return m_open;
+}
+
+void CompressedOFStream::close() {
+    if (!m_open) {
+        return;
+    }
+    m_open = false;
+
+    bool ok = m_buffer->pubsync() == 0;
+#ifdef KANBAN_LITE_HAVE_ZLIB
+    if (m_codec == Compression::Codec::Gzip) {
+        ok = static_cast<GzipOutputBuffer*>(m_buffer.get())->finish() && ok;
+    }
+#endif
+    if (m_codec == Compression::Codec::None) {
+        ok = static_cast<std::filebuf*>(m_buffer.get())->close() != nullptr && ok;
+    }
+    if (!ok) {
+        setstate(std::ios::badbit);
+    }
+}
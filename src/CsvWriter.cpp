@@ -0,0 +1,89 @@
+#include "CsvWriter.h"
+
+/**
+ * @file CsvWriter.cpp
+ * @brief Implementação da escrita de CSV.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+CsvWriter::CsvWriter(std::ostream& out, size_t bufferSize)
+    : m_out(out), m_capacity(bufferSize)
+{
+    m_buffer.reserve(bufferSize + 1024);
+}
+
+CsvWriter::~CsvWriter() {
+    flush();
+}
+
+CsvWriter& CsvWriter::field(std::string_view value) {
+    separate();
+    if (value.find_first_of(",\"\r\n") == std::string_view::npos) {
+        m_buffer.append(value.data(), value.size());
+    } else {
+        appendQuoted(value);
+    }
+    return *this;
+}
+
+CsvWriter& CsvWriter::field(const char* value) {
+    return field(std::string_view(value));
+}
+
+CsvWriter& CsvWriter::field(const std::vector<std::string>& values) {
+    m_joined.clear();
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            m_joined.push_back(';');
+        }
+        m_joined += values[i];
+    }
+    return field(std::string_view(m_joined));
+}
+
+CsvWriter& CsvWriter::field(std::chrono::system_clock::time_point value) {
+    return field(static_cast<long long>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(value.time_since_epoch()).count()));
+}
+
+CsvWriter& CsvWriter::endRow() {
+    m_buffer.push_back('\n');
+    m_firstField = true;
+    ++m_rows;
+    if (m_buffer.size() >= m_capacity) {
+        m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    return *this;
+}
+
+void CsvWriter::flush() {
+    if (!m_buffer.empty()) {
+        m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    m_out.flush();
+}
+
+size_t CsvWriter::rows() const {
+    return m_rows;
+}
+
+void CsvWriter::separate() {
+    if (!m_firstField) {
+        m_buffer.push_back(',');
+    }
+    m_firstField = false;
+}
+
+void CsvWriter::appendQuoted(std::string_view value) {
+    m_buffer.push_back('"');
+    for (char c : value) {
+        if (c == '"') {
+            m_buffer.push_back('"');
+        }
+        m_buffer.push_back(c);
+    }
+    m_buffer.push_back('"');
+}
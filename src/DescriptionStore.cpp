@@ -0,0 +1,180 @@
+#include "DescriptionStore.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @file DescriptionStore.cpp
+ * @brief Implementação do armazenamento deduplicado de descrições.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * @brief Visita cada objeto com formato de card (id, title) em qualquer nível:
+ * cards dos boards e cards dentro dos payloads do activity log.
+ */
+template <typename Visit>
+void forEachCard(json& node, Visit& visit) {
+    if (node.is_object()) {
+        if (node.contains("id") && node.contains("title")) {
+            visit(node);
+            return;
+        }
+        for (auto& [key, value] : node.items()) {
+            if (key != "descriptions" && value.is_structured()) {
+                forEachCard(value, visit);
+            }
+        }
+    } else if (node.is_array()) {
+        for (auto& value : node) {
+            if (value.is_structured()) {
+                forEachCard(value, visit);
+            }
+        }
+    }
+}
+
+} // namespace
+
+DescriptionStore& DescriptionStore::instance() {
+    static DescriptionStore* store = new DescriptionStore();
+    return *store;
+}
+
+/**
+ * Um corpo expirado ainda no índice está sendo destruído em outra thread:
+ * a entrada é trocada pela nova, e release() do antigo não a apaga
+ * (compara o endereço do corpo).
+ */
+DescriptionStore::Handle DescriptionStore::intern(std::string_view text) {
+    if (text.empty()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_bodies.find(text);
+    if (it != m_bodies.end()) {
+        if (Handle existing = it->second.lock()) {
+            return existing;
+        }
+        m_bytes -= it->first.size();
+        m_bodies.erase(it);
+    }
+
+    Handle body(new std::string(text), [this](const std::string* released) { release(released); });
+    m_bodies.emplace(std::string_view(*body), body);
+    m_bytes += body->size();
+    return body;
+}
+
+void DescriptionStore::release(const std::string* body) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_bodies.find(std::string_view(*body));
+        if (it != m_bodies.end() && it->first.data() == body->data()) {
+            m_bytes -= body->size();
+            m_bodies.erase(it);
+        }
+    }
+    delete body;
+}
+
+size_t DescriptionStore::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bodies.size();
+}
+
+size_t DescriptionStore::bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes;
+}
+
+std::string DescriptionStore::hashOf(std::string_view text) {
+    std::uint64_t hash = 14695981039346656037ULL; // FNV-1a 64
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return hex;
+}
+
+/**
+ * Vale para os cards dos boards e para os cards guardados nos payloads do
+ * activity log (lotes de import repetem a descrição de cada card).
+ * Três passadas: conta repetições (views nos textos do próprio JSON), monta a
+ * tabela com uma cópia por corpo e só então troca o texto pela referência,
+ * para que as views não fiquem inválidas durante a contagem.
+ */
+void DescriptionStore::pack(json& state) {
+    std::unordered_map<std::string_view, size_t> uses;
+    auto count = [&uses](json& card) {
+        auto it = card.find("description");
+        if (it != card.end() && it->is_string() &&
+            it->get_ref<const std::string&>().size() >= MIN_SHARED_SIZE) {
+            ++uses[it->get_ref<const std::string&>()];
+        }
+    };
+    forEachCard(state, count);
+
+    json table = json::object();
+    std::vector<std::pair<json*, std::string>> references;
+    auto collect = [&](json& card) {
+        auto it = card.find("description");
+        if (it == card.end() || !it->is_string()) {
+            return;
+        }
+        const std::string& text = it->get_ref<const std::string&>();
+        auto used = uses.find(text);
+        if (used == uses.end() || used->second < 2) {
+            return;
+        }
+        std::string key = hashOf(text);
+        auto existing = table.find(key);
+        if (existing == table.end()) {
+            table[key] = text;
+        } else if (existing->get_ref<const std::string&>() != text) {
+            return; // Colisão de hash: mantém inline
+        }
+        references.emplace_back(&card, std::move(key));
+    };
+    forEachCard(state, collect);
+
+    for (auto& [card, key] : references) {
+        card->erase("description");
+        (*card)["descriptionRef"] = std::move(key);
+    }
+    if (!table.empty()) {
+        state["descriptions"] = std::move(table);
+    }
+}
+
+void DescriptionStore::unpack(json& state) {
+    if (!state.contains("descriptions")) {
+        return;
+    }
+    const json& table = state["descriptions"];
+    auto resolve = [&table](json& card) {
+        auto ref = card.find("descriptionRef");
+        if (ref == card.end()) {
+            return;
+        }
+        auto body = ref->is_string() ? table.find(ref->get_ref<const std::string&>()) : table.end();
+        if (body == table.end() || !body->is_string()) {
+            throw std::invalid_argument("Unknown description reference in card '" +
+                                        card.value("id", std::string()) + "'");
+        }
+        card["description"] = *body;
+        card.erase("descriptionRef");
+    };
+    forEachCard(state, resolve);
+    state.erase("descriptions");
+}
@@ -0,0 +1,479 @@
+#include "FlowMetrics.h"
+#include "Board.h"
+#include "Column.h"
+#include "Card.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+using json = nlohmann::json;
+
+/**
+ * @file FlowMetrics.cpp
+ * @brief Implementação das métricas de fluxo incrementais.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+long long toMillis(FlowMetrics::TimePoint t) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+}
+
+FlowMetrics::TimePoint fromMillis(long long ms) {
+    return FlowMetrics::TimePoint(std::chrono::milliseconds(ms));
+}
+
+double hoursBetween(FlowMetrics::TimePoint from, FlowMetrics::TimePoint to) {
+    return std::chrono::duration<double, std::ratio<3600>>(to - from).count();
+}
+
+/**
+ * @brief Percentis p50/p85/p95 (nearest-rank) de uma amostra.
+ */
+std::array<double, 3> percentiles(std::vector<double> samples) {
+    std::array<double, 3> result {};
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end());
+    const double ranks[] = {0.50, 0.85, 0.95};
+    for (size_t i = 0; i < result.size(); ++i) {
+        auto rank = static_cast<size_t>(std::ceil(ranks[i] * static_cast<double>(samples.size())));
+        result[i] = samples[std::max<size_t>(rank, 1) - 1];
+    }
+    return result;
+}
+
+} // namespace
+
+/**
+ * @brief Dia UTC de um instante.
+ * @param t Instante
+ * @return Dias desde 1970-01-01
+ */
+long long FlowMetrics::dayOf(TimePoint t) {
+    using Days = std::chrono::duration<long long, std::ratio<86400>>;
+    return std::chrono::floor<Days>(t.time_since_epoch()).count();
+}
+
+/**
+ * @brief Executa fn sob o mutex do board.
+ *
+ * O mapa fica sob lock compartilhado durante fn (removeBoard() e load()
+ * esperam); só acompanhar um board novo exige o lock exclusivo.
+ */
+template <typename Fn>
+void FlowMetrics::withBoard(const std::string& board, bool create, Fn&& fn) {
+    std::shared_lock<std::shared_mutex> boards(m_mutex);
+    auto it = m_boards.find(board);
+    if (it == m_boards.end()) {
+        if (!create) {
+            return;
+        }
+        boards.unlock();
+        {
+            std::unique_lock<std::shared_mutex> exclusive(m_mutex);
+            m_boards.try_emplace(board, std::make_unique<BoardFlow>());
+        }
+        boards.lock();
+        it = m_boards.find(board);
+        if (it == m_boards.end()) {
+            return; // Removido entre os dois locks
+        }
+    }
+    BoardFlow& flow = *it->second;
+    std::lock_guard<std::mutex> lock(flow.mutex);
+    fn(flow);
+}
+
+/**
+ * @brief Registra board existente.
+ * @param board Board a acompanhar
+ */
+void FlowMetrics::track(const Board& board) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto inserted = m_boards.try_emplace(board.getName(), nullptr);
+    if (!inserted.second) {
+        return;
+    }
+    inserted.first->second = std::make_unique<BoardFlow>();
+
+    BoardFlow& flow = *inserted.first->second;
+    TimePoint now = std::chrono::system_clock::now();
+    const auto& columns = board.getColumns();
+    for (size_t slot = 0; slot < columns.size(); ++slot) {
+        for (const auto& card : columns[slot].getCards()) {
+            flow.cards[card.getId()] = CardFlow{card.getCreatedAt(), slot > 0 ? now : TimePoint(),
+                                                columns[slot].getName(), TimePoint()};
+        }
+        adjust(flow, columns[slot].getName(), static_cast<long long>(columns[slot].getCardCount()), now);
+    }
+}
+
+/**
+ * @brief Alinha os agregados ao board reconstruído.
+ * @param board Board resultante do merge
+ * @param saved Métricas gravadas pela outra sessão
+ */
+void FlowMetrics::reconcile(const Board& board, const json& saved) {
+    const json empty = json::object();
+    const json* theirs = &empty;
+    if (saved.contains("boards") && saved["boards"].contains(board.getName())) {
+        theirs = &saved["boards"][board.getName()];
+    }
+    const json cards = theirs->value("cards", json::object());
+    const json completed = theirs->value("completed", json::object());
+
+    // Entrada na coluna registrada pela outra sessão (época = desconhecida)
+    auto savedEntered = [&cards](const std::string& cardId, const std::string& column) {
+        if (!cards.contains(cardId) || cards[cardId].value("column", std::string()) != column) {
+            return TimePoint();
+        }
+        return fromMillis(cards[cardId].value("entered", 0LL));
+    };
+
+    withBoard(board.getName(), true, [&](BoardFlow& flow) {
+        TimePoint now = std::chrono::system_clock::now();
+        const auto& columns = board.getColumns();
+        std::unordered_set<std::string> present;
+        for (size_t slot = 0; slot < columns.size(); ++slot) {
+            const std::string& column = columns[slot].getName();
+            bool done = slot + 1 == columns.size();
+            for (const auto& card : columns[slot].getCards()) {
+                present.insert(card.getId());
+                auto it = flow.cards.find(card.getId());
+                if (it == flow.cards.end()) {
+                    // Card vindo da outra sessão: usa o fluxo que ela registrou
+                    CardFlow flowCard{card.getCreatedAt(), slot > 0 ? now : TimePoint(), column,
+                                      savedEntered(card.getId(), column)};
+                    if (cards.contains(card.getId())) {
+                        const json& known = cards[card.getId()];
+                        flowCard.created = fromMillis(known.value("created", toMillis(flowCard.created)));
+                        TimePoint started = fromMillis(known.value("started", 0LL));
+                        if (started != TimePoint()) {
+                            flowCard.started = started;
+                        }
+                    }
+                    adjust(flow, column, 1, now);
+                    if (done && completed.contains(card.getId()) && !flow.completed.count(card.getId())) {
+                        const json& known = completed[card.getId()];
+                        Completion completion{fromMillis(known.at("when").get<long long>()),
+                                              known.value("leadHours", 0.0), known.value("cycleHours", 0.0)};
+                        flow.completed.emplace(card.getId(), completion);
+                        ++flow.throughput[dayOf(completion.when)];
+                    } else if (done) {
+                        complete(flow, card.getId(), flowCard, now);
+                    } else {
+                        reopen(flow, card.getId());
+                    }
+                    flow.cards.emplace(card.getId(), std::move(flowCard));
+                    continue;
+                }
+
+                CardFlow& known = it->second;
+                if (known.column == column) {
+                    continue;
+                }
+                adjust(flow, known.column, -1, now);
+                adjust(flow, column, 1, now);
+                known.column = column;
+                known.entered = savedEntered(card.getId(), column);
+                if (slot > 0 && known.started == TimePoint()) {
+                    known.started = now;
+                }
+                if (done) {
+                    complete(flow, card.getId(), known, now);
+                } else {
+                    reopen(flow, card.getId());
+                }
+            }
+        }
+
+        for (auto it = flow.cards.begin(); it != flow.cards.end();) {
+            if (present.count(it->first)) {
+                ++it;
+                continue;
+            }
+            adjust(flow, it->second.column, -1, now);
+            it = flow.cards.erase(it);
+        }
+    });
+}
+
+/**
+ * @brief Card entrou no board.
+ */
+void FlowMetrics::cardAdded(const std::string& board, const std::string& cardId, const std::string& column,
+                            TimePoint created, bool started, bool done, TimePoint when) {
+    withBoard(board, true, [&](BoardFlow& flow) {
+        CardFlow card{created, started ? when : TimePoint(), column, when};
+        if (done) {
+            complete(flow, cardId, card, when); // Card devolvido ao board (undo) mantém a conclusão original
+        } else {
+            reopen(flow, cardId);
+        }
+        flow.cards[cardId] = std::move(card);
+        adjust(flow, column, 1, when);
+    });
+}
+
+/**
+ * @brief Card mudou de coluna.
+ */
+void FlowMetrics::cardMoved(const std::string& board, const std::string& cardId, const std::string& toColumn,
+                            bool started, bool done, TimePoint when) {
+    withBoard(board, true, [&](BoardFlow& flow) {
+        auto it = flow.cards.find(cardId);
+        if (it == flow.cards.end() || it->second.column == toColumn) {
+            return;
+        }
+
+        CardFlow& card = it->second;
+        adjust(flow, card.column, -1, when);
+        adjust(flow, toColumn, 1, when);
+        card.column = toColumn;
+        card.entered = when;
+        if (started && card.started == TimePoint()) {
+            card.started = when;
+        }
+        if (done) {
+            complete(flow, cardId, card, when);
+        } else {
+            reopen(flow, cardId);
+        }
+    });
+}
+
+/**
+ * @brief Card saiu do board.
+ */
+void FlowMetrics::cardRemoved(const std::string& board, const std::string& cardId, TimePoint when) {
+    withBoard(board, false, [&](BoardFlow& flow) {
+        auto it = flow.cards.find(cardId);
+        if (it == flow.cards.end()) {
+            return;
+        }
+        adjust(flow, it->second.column, -1, when);
+        flow.cards.erase(it);
+    });
+}
+
+void FlowMetrics::removeBoard(const std::string& board) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_boards.erase(board);
+}
+
+/**
+ * @brief Ajusta contagem da coluna e registra no dia.
+ */
+void FlowMetrics::adjust(BoardFlow& flow, const std::string& column, long long delta, TimePoint when) {
+    size_t& count = flow.counts[column];
+    count = static_cast<size_t>(std::max(0LL, static_cast<long long>(count) + delta));
+    flow.daily[dayOf(when)][column] = count;
+}
+
+/**
+ * @brief Registra conclusão (uma por card).
+ */
+void FlowMetrics::complete(BoardFlow& flow, const std::string& cardId, const CardFlow& card, TimePoint when) {
+    Completion completion{when, hoursBetween(card.created, when),
+                          card.started == TimePoint() ? 0.0 : hoursBetween(card.started, when)};
+    if (flow.completed.emplace(cardId, completion).second) {
+        ++flow.throughput[dayOf(when)];
+    }
+}
+
+/**
+ * @brief Desfaz a conclusão do card, se houver.
+ */
+void FlowMetrics::reopen(BoardFlow& flow, const std::string& cardId) {
+    auto it = flow.completed.find(cardId);
+    if (it == flow.completed.end()) {
+        return;
+    }
+    auto day = flow.throughput.find(dayOf(it->second.when));
+    if (day != flow.throughput.end() && --day->second == 0) {
+        flow.throughput.erase(day);
+    }
+    flow.completed.erase(it);
+}
+
+/**
+ * @brief Entrada do card na coluna atual.
+ * @param board Nome do board
+ * @param cardId ID do card
+ * @return Momento da entrada, se conhecido
+ */
+std::optional<FlowMetrics::TimePoint> FlowMetrics::enteredColumn(const std::string& board,
+                                                                 const std::string& cardId) const {
+    std::shared_lock<std::shared_mutex> boards(m_mutex);
+    auto it = m_boards.find(board);
+    if (it == m_boards.end()) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(it->second->mutex);
+    auto card = it->second->cards.find(cardId);
+    if (card == it->second->cards.end() || card->second.entered == TimePoint()) {
+        return std::nullopt;
+    }
+    return card->second.entered;
+}
+
+/**
+ * @brief Relatório do board.
+ * @param board Board
+ * @return Percentis, throughput diário e série do CFD
+ */
+FlowMetrics::Report FlowMetrics::report(const Board& board) const {
+    Report report;
+    std::shared_lock<std::shared_mutex> boards(m_mutex);
+    auto it = m_boards.find(board.getName());
+    if (it == m_boards.end()) {
+        return report;
+    }
+    const BoardFlow& flow = *it->second;
+    std::lock_guard<std::mutex> lock(it->second->mutex);
+
+    std::vector<double> leadHours = flow.leadHours;
+    std::vector<double> cycleHours = flow.cycleHours;
+    for (const auto& entry : flow.completed) {
+        leadHours.push_back(entry.second.leadHours);
+        cycleHours.push_back(entry.second.cycleHours);
+    }
+    report.completed = leadHours.size();
+    report.leadHours = percentiles(std::move(leadHours));
+    report.cycleHours = percentiles(std::move(cycleHours));
+
+    for (const auto& column : board.getColumns()) {
+        report.columns.push_back(column.getName());
+    }
+    if (flow.daily.empty()) {
+        return report;
+    }
+
+    report.firstDay = flow.daily.begin()->first;
+    long long lastDay = std::max(flow.daily.rbegin()->first, dayOf(std::chrono::system_clock::now()));
+    size_t days = static_cast<size_t>(lastDay - report.firstDay + 1);
+
+    report.throughput.assign(days, 0);
+    for (const auto& entry : flow.throughput) {
+        report.throughput[static_cast<size_t>(entry.first - report.firstDay)] = entry.second;
+    }
+
+    // CFD: contagens carregadas adiante nos dias sem alteração
+    std::vector<size_t> current(report.columns.size(), 0);
+    auto change = flow.daily.begin();
+    report.cfd.reserve(days);
+    for (long long day = report.firstDay; day <= lastDay; ++day) {
+        if (change != flow.daily.end() && change->first == day) {
+            for (size_t c = 0; c < report.columns.size(); ++c) {
+                auto count = change->second.find(report.columns[c]);
+                if (count != change->second.end()) {
+                    current[c] = count->second;
+                }
+            }
+            ++change;
+        }
+        report.cfd.push_back(current);
+    }
+    return report;
+}
+
+/**
+ * @brief Serializa os agregados.
+ * @return Objeto JSON {"boards": {...}}
+ */
+json FlowMetrics::toJson() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    json boards = json::object();
+    for (const auto& entry : m_boards) {
+        const BoardFlow& flow = *entry.second;
+        std::lock_guard<std::mutex> boardLock(entry.second->mutex);
+
+        json cards = json::object();
+        for (const auto& card : flow.cards) {
+            cards[card.first] = {
+                {"created", toMillis(card.second.created)},
+                {"started", toMillis(card.second.started)},
+                {"column", card.second.column},
+                {"entered", toMillis(card.second.entered)}
+            };
+        }
+        json daily = json::object();
+        for (const auto& day : flow.daily) {
+            daily[std::to_string(day.first)] = day.second;
+        }
+        json throughput = json::object();
+        for (const auto& day : flow.throughput) {
+            throughput[std::to_string(day.first)] = day.second;
+        }
+        json completed = json::object();
+        for (const auto& card : flow.completed) {
+            completed[card.first] = {
+                {"when", toMillis(card.second.when)},
+                {"leadHours", card.second.leadHours},
+                {"cycleHours", card.second.cycleHours}
+            };
+        }
+
+        boards[entry.first] = {
+            {"cards", cards},
+            {"counts", flow.counts},
+            {"daily", daily},
+            {"throughput", throughput},
+            {"completed", completed},
+            {"leadHours", flow.leadHours},
+            {"cycleHours", flow.cycleHours}
+        };
+    }
+    return json{{"boards", boards}};
+}
+
+/**
+ * @brief Carrega agregados de toJson().
+ * @param j Objeto JSON
+ * @throws json::exception se estrutura inválida
+ */
+void FlowMetrics::load(const json& j) {
+    // Monta fora do lock; estado atual intacto se o JSON for inválido
+    std::unordered_map<std::string, std::unique_ptr<BoardFlow>> boards;
+    const json empty = json::object();
+    for (const auto& entry : (j.contains("boards") ? j["boards"] : empty).items()) {
+        const json& data = entry.value();
+        auto owned = std::make_unique<BoardFlow>();
+        BoardFlow& flow = *owned;
+        // value() devolve cópia: mantida viva durante a iteração de items()
+        const json cards = data.value("cards", json::object());
+        const json daily = data.value("daily", json::object());
+        const json throughput = data.value("throughput", json::object());
+        const json completed = data.value("completed", json::object());
+        for (const auto& card : cards.items()) {
+            flow.cards[card.key()] = CardFlow{fromMillis(card.value().at("created").get<long long>()),
+                                              fromMillis(card.value().value("started", 0LL)),
+                                              card.value().at("column").get<std::string>(),
+                                              fromMillis(card.value().value("entered", 0LL))};
+        }
+        flow.counts = data.value("counts", std::unordered_map<std::string, size_t>());
+        for (const auto& day : daily.items()) {
+            flow.daily[std::stoll(day.key())] = day.value().get<std::unordered_map<std::string, size_t>>();
+        }
+        for (const auto& day : throughput.items()) {
+            flow.throughput[std::stoll(day.key())] = day.value().get<size_t>();
+        }
+        for (const auto& card : completed.items()) {
+            flow.completed[card.key()] = Completion{fromMillis(card.value().at("when").get<long long>()),
+                                                    card.value().value("leadHours", 0.0),
+                                                    card.value().value("cycleHours", 0.0)};
+        }
+        flow.leadHours = data.value("leadHours", std::vector<double>());
+        flow.cycleHours = data.value("cycleHours", std::vector<double>());
+        boards.emplace(entry.key(), std::move(owned));
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_boards.swap(boards);
+}
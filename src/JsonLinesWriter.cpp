@@ -0,0 +1,136 @@
+#include "JsonLinesWriter.h"
+
+/**
+ * @file JsonLinesWriter.cpp
+ * @brief Implementação da escrita de JSON Lines.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+JsonLinesWriter::JsonLinesWriter(std::ostream& out, size_t bufferSize)
+    : m_out(out), m_capacity(bufferSize)
+{
+    m_buffer.reserve(bufferSize + 1024);
+}
+
+JsonLinesWriter::~JsonLinesWriter() {
+    flush();
+}
+
+JsonLinesWriter& JsonLinesWriter::beginObject() {
+    m_buffer.push_back('{');
+    m_firstField = true;
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::endObject() {
+    m_buffer += "}\n";
+    ++m_lines;
+    flushIfFull();
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::field(const char* key, std::string_view value) {
+    appendKey(key);
+    appendString(value);
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::field(const char* key, const char* value) {
+    return field(key, std::string_view(value));
+}
+
+JsonLinesWriter& JsonLinesWriter::field(const char* key, bool value) {
+    appendKey(key);
+    m_buffer += value ? "true" : "false";
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::field(const char* key, const std::vector<std::string>& values) {
+    appendKey(key);
+    m_buffer.push_back('[');
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            m_buffer.push_back(',');
+        }
+        appendString(values[i]);
+    }
+    m_buffer.push_back(']');
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::field(const char* key, std::chrono::system_clock::time_point value) {
+    return field(key, static_cast<long long>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(value.time_since_epoch()).count()));
+}
+
+JsonLinesWriter& JsonLinesWriter::null(const char* key) {
+    appendKey(key);
+    m_buffer += "null";
+    return *this;
+}
+
+JsonLinesWriter& JsonLinesWriter::raw(const char* key, std::string_view serialized) {
+    appendKey(key);
+    m_buffer += serialized;
+    return *this;
+}
+
+void JsonLinesWriter::flush() {
+    if (!m_buffer.empty()) {
+        m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    m_out.flush();
+}
+
+size_t JsonLinesWriter::lines() const {
+    return m_lines;
+}
+
+void JsonLinesWriter::appendKey(const char* key) {
+    if (!m_firstField) {
+        m_buffer.push_back(',');
+    }
+    m_firstField = false;
+    m_buffer.push_back('"');
+    m_buffer += key;
+    m_buffer += "\":";
+}
+
+// Trechos sem caracteres especiais são copiados de uma vez
+void JsonLinesWriter::appendString(std::string_view value) {
+    static const char HEX[] = "0123456789abcdef";
+    m_buffer.push_back('"');
+    size_t start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        m_buffer.append(value.data() + start, i - start);
+        start = i + 1;
+        switch (c) {
+            case '"':  m_buffer += "\\\""; break;
+            case '\\': m_buffer += "\\\\"; break;
+            case '\n': m_buffer += "\\n"; break;
+            case '\r': m_buffer += "\\r"; break;
+            case '\t': m_buffer += "\\t"; break;
+            case '\b': m_buffer += "\\b"; break;
+            case '\f': m_buffer += "\\f"; break;
+            default:
+                m_buffer += "\\u00";
+                m_buffer.push_back(HEX[c >> 4]);
+                m_buffer.push_back(HEX[c & 0x0F]);
+        }
+    }
+    m_buffer.append(value.data() + start, value.size() - start);
+    m_buffer.push_back('"');
+}
+
+void JsonLinesWriter::flushIfFull() {
+    if (m_buffer.size() >= m_capacity) {
+        m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+}
@@ -0,0 +1,468 @@
+#include "LocalSocket.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file LocalSocket.cpp
+ * @brief Implementação do socket Unix com frames delimitados por tamanho.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+const size_t HEADER_SIZE = 4;
+const size_t READ_CHUNK = 64 * 1024;
+
+#ifndef _WIN32
+// Caminho no sockaddr_un (limitado a ~100 bytes pelo sistema)
+sockaddr_un addressOf(const std::string& path) {
+    sockaddr_un address {};
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("Invalid socket path '" + path + "'");
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+// Escrita em conexão fechada pelo outro lado não deve derrubar o processo (SIGPIPE)
+int openSocket() {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("Could not create socket: ") + std::strerror(errno));
+    }
+#ifdef SO_NOSIGPIPE
+    int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    return fd;
+}
+#endif
+
+void appendHeader(std::string& out, size_t size) {
+    std::uint32_t length = static_cast<std::uint32_t>(size);
+    out.push_back(static_cast<char>((length >> 24) & 0xFF));
+    out.push_back(static_cast<char>((length >> 16) & 0xFF));
+    out.push_back(static_cast<char>((length >> 8) & 0xFF));
+    out.push_back(static_cast<char>(length & 0xFF));
+}
+
+} // namespace
+
+LocalSocket::LocalSocket(int fd, std::string unlinkPath)
+    : m_fd(fd), m_unlinkPath(std::move(unlinkPath))
+{
+}
+
+LocalSocket::LocalSocket(LocalSocket&& other) noexcept
+    : m_fd(other.m_fd), m_unlinkPath(std::move(other.m_unlinkPath)),
+      m_buffer(std::move(other.m_buffer)), m_offset(other.m_offset),
+      m_outgoing(std::move(other.m_outgoing)), m_sent(other.m_sent), m_peerClosed(other.m_peerClosed)
+{
+    other.m_fd = -1;
+    other.m_unlinkPath.clear();
+}
+
+LocalSocket& LocalSocket::operator=(LocalSocket&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_fd = other.m_fd;
+        m_unlinkPath = std::move(other.m_unlinkPath);
+        m_buffer = std::move(other.m_buffer);
+        m_offset = other.m_offset;
+        m_outgoing = std::move(other.m_outgoing);
+        m_sent = other.m_sent;
+        m_peerClosed = other.m_peerClosed;
+        other.m_fd = -1;
+        other.m_unlinkPath.clear();
+    }
+    return *this;
+}
+
+LocalSocket::~LocalSocket() {
+    close();
+}
+
+void LocalSocket::close() {
+#ifndef _WIN32
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    if (!m_unlinkPath.empty()) {
+        ::unlink(m_unlinkPath.c_str());
+        m_unlinkPath.clear();
+    }
+#endif
+}
+
+/**
+ * @param path Caminho do socket
+ * @return Listener pronto para accept()
+ * @throws std::runtime_error se outro servidor já usa o caminho
+ */
+LocalSocket LocalSocket::listen(const std::string& path) {
+#ifndef _WIN32
+    sockaddr_un address = addressOf(path);
+
+    // Arquivo existente: em uso se alguém aceita conexão, senão é resto de um servidor morto
+    {
+        LocalSocket probe(openSocket());
+        if (::connect(probe.m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            throw std::runtime_error("Socket '" + path + "' is already in use");
+        }
+    }
+    ::unlink(path.c_str());
+
+    LocalSocket listener(openSocket());
+    if (::bind(listener.m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listener.m_fd, SOMAXCONN) != 0) {
+        throw std::runtime_error("Could not listen on '" + path + "': " + std::strerror(errno));
+    }
+    listener.m_unlinkPath = path;
+    return listener;
+#else
+    throw std::runtime_error("Unix sockets are not supported on this platform: " + path);
+#endif
+}
+
+/**
+ * @param path Caminho do socket
+ * @return Conexão com o servidor
+ * @throws std::runtime_error se não há servidor escutando
+ */
+LocalSocket LocalSocket::connect(const std::string& path) {
+#ifndef _WIN32
+    sockaddr_un address = addressOf(path);
+    LocalSocket connection(openSocket());
+    if (::connect(connection.m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        throw std::runtime_error("Could not connect to '" + path + "': " + std::strerror(errno));
+    }
+    return connection;
+#else
+    throw std::runtime_error("Unix sockets are not supported on this platform: " + path);
+#endif
+}
+
+LocalSocket LocalSocket::accept() const {
+#ifndef _WIN32
+    while (true) {
+        int fd = ::accept(m_fd, nullptr, nullptr);
+        if (fd >= 0) {
+#ifdef SO_NOSIGPIPE
+            int on = 1;
+            ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+            return LocalSocket(fd);
+        }
+        if (errno != EINTR && errno != ECONNABORTED) {
+            throw std::runtime_error(std::string("Could not accept connection: ") + std::strerror(errno));
+        }
+    }
+#else
+    throw std::runtime_error("Unix sockets are not supported on this platform");
+#endif
+}
+
+bool LocalSocket::writeAll(const char* data, size_t size) {
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    while (size > 0) {
+        ssize_t written = ::send(m_fd, data, size, flags);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+#else
+    (void)data;
+    (void)size;
+    return false;
+#endif
+}
+
+bool LocalSocket::sendFrame(const std::string& payload) {
+    return sendFrames({payload});
+}
+
+/**
+ * @param payloads Conteúdos, na ordem de envio
+ * @return false se a conexão foi fechada ou algum frame é grande demais
+ */
+bool LocalSocket::sendFrames(const std::vector<std::string>& payloads) {
+    size_t total = 0;
+    for (const auto& payload : payloads) {
+        if (payload.size() > MAX_FRAME_SIZE) {
+            return false;
+        }
+        total += HEADER_SIZE + payload.size();
+    }
+    std::string message;
+    message.reserve(total);
+    for (const auto& payload : payloads) {
+        appendHeader(message, payload.size());
+        message += payload;
+    }
+    return m_fd >= 0 && writeAll(message.data(), message.size());
+}
+
+// Garante ao menos needed bytes não consumidos no buffer
+bool LocalSocket::fill(size_t needed) {
+#ifndef _WIN32
+    if (m_offset > 0 && (m_offset == m_buffer.size() || m_offset >= READ_CHUNK)) {
+        m_buffer.erase(0, m_offset);
+        m_offset = 0;
+    }
+    while (m_buffer.size() - m_offset < needed) {
+        size_t before = m_buffer.size();
+        m_buffer.resize(before + std::max(READ_CHUNK, needed));
+        ssize_t received = ::recv(m_fd, &m_buffer[before], m_buffer.size() - before, 0);
+        m_buffer.resize(before + (received > 0 ? static_cast<size_t>(received) : 0));
+        if (received == 0) {
+            return false;
+        }
+        if (received < 0 && errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+#else
+    (void)needed;
+    return false;
+#endif
+}
+
+namespace {
+
+std::uint32_t readHeader(const char* data) {
+    const unsigned char* header = reinterpret_cast<const unsigned char*>(data);
+    return (std::uint32_t(header[0]) << 24) | (std::uint32_t(header[1]) << 16) |
+           (std::uint32_t(header[2]) << 8) | std::uint32_t(header[3]);
+}
+
+} // namespace
+
+// Frame completo já lido junto com o anterior: poll não o anunciaria
+bool LocalSocket::hasBufferedFrame() const {
+    size_t available = m_buffer.size() - m_offset;
+    return available >= HEADER_SIZE && available >= HEADER_SIZE + readHeader(m_buffer.data() + m_offset);
+}
+
+bool LocalSocket::receiveFrame(std::string& payload) {
+    if (m_fd < 0 || !fill(HEADER_SIZE)) {
+        return false;
+    }
+    std::uint32_t length = readHeader(m_buffer.data() + m_offset);
+    if (length > MAX_FRAME_SIZE || !fill(HEADER_SIZE + length)) {
+        return false;
+    }
+    payload.assign(m_buffer, m_offset + HEADER_SIZE, length);
+    m_offset += HEADER_SIZE + length;
+    return true;
+}
+
+bool LocalSocket::isOpen() const {
+    return m_fd >= 0;
+}
+
+bool LocalSocket::setBlocking(bool blocking) {
+#ifndef _WIN32
+    int flags = ::fcntl(m_fd, F_GETFL, 0);
+    if (flags < 0) {
+        return false;
+    }
+    flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+    return ::fcntl(m_fd, F_SETFL, flags) == 0;
+#else
+    (void)blocking;
+    return false;
+#endif
+}
+
+/**
+ * @brief Lê o que já chegou (uma chamada, sem esperar).
+ * @return false em erro ou cabeçalho com tamanho acima de MAX_FRAME_SIZE
+ */
+bool LocalSocket::readAvailable() {
+#ifndef _WIN32
+    if (m_offset > 0 && (m_offset == m_buffer.size() || m_offset >= READ_CHUNK)) {
+        m_buffer.erase(0, m_offset);
+        m_offset = 0;
+    }
+    size_t before = m_buffer.size();
+    m_buffer.resize(before + READ_CHUNK);
+    ssize_t received = ::recv(m_fd, &m_buffer[before], READ_CHUNK, 0);
+    m_buffer.resize(before + (received > 0 ? static_cast<size_t>(received) : 0));
+    if (received == 0) {
+        m_peerClosed = true;
+    } else if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        return false;
+    }
+    size_t available = m_buffer.size() - m_offset;
+    return available < HEADER_SIZE || readHeader(m_buffer.data() + m_offset) <= MAX_FRAME_SIZE;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Retira do buffer o próximo frame, se já chegou inteiro.
+ */
+bool LocalSocket::takeFrame(std::string& payload) {
+    if (!hasBufferedFrame()) {
+        return false;
+    }
+    std::uint32_t length = readHeader(m_buffer.data() + m_offset);
+    payload.assign(m_buffer, m_offset + HEADER_SIZE, length);
+    m_offset += HEADER_SIZE + length;
+    return true;
+}
+
+void LocalSocket::queueFrames(const std::vector<std::string>& payloads) {
+    for (const auto& payload : payloads) {
+        appendHeader(m_outgoing, payload.size());
+        m_outgoing += payload;
+    }
+}
+
+/**
+ * @brief Envia o que o socket aceitar agora da saída pendente.
+ * @return false se a conexão foi fechada
+ */
+bool LocalSocket::flushPending() {
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    while (m_sent < m_outgoing.size()) {
+        ssize_t written = ::send(m_fd, m_outgoing.data() + m_sent, m_outgoing.size() - m_sent, flags);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        m_sent += static_cast<size_t>(written);
+    }
+    m_outgoing.clear();
+    m_sent = 0;
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool LocalSocket::hasPending() const {
+    return m_sent < m_outgoing.size();
+}
+
+// ============================================================================
+// LocalServer
+// ============================================================================
+
+LocalServer::LocalServer(const std::string& path)
+    : m_listener(LocalSocket::listen(path))
+{
+}
+
+/**
+ * @param handler Chamado uma vez por requisição completa, sempre na thread de run()
+ */
+void LocalServer::run(const Handler& handler) {
+#ifndef _WIN32
+    std::vector<LocalSocket> clients;
+    std::vector<pollfd> fds;
+    std::string request;
+    std::vector<std::string> reply;
+
+    while (true) {
+        fds.assign(1, pollfd{m_listener.m_fd, POLLIN, 0});
+        bool buffered = false;
+        for (const auto& client : clients) {
+            // Resposta pendente: espera o cliente ler antes de aceitar outra requisição
+            bool sending = client.hasPending();
+            fds.push_back(pollfd{client.m_fd, static_cast<short>(sending ? POLLOUT : POLLIN), 0});
+            buffered = buffered || (!sending && client.hasBufferedFrame());
+        }
+        if (::poll(fds.data(), fds.size(), buffered ? 0 : -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("poll failed: ") + std::strerror(errno));
+        }
+
+        // Um frame por cliente a cada volta: nenhum cliente monopoliza o servidor
+        size_t polled = clients.size();
+        for (size_t i = 0; i < polled; ++i) {
+            LocalSocket& client = clients[i];
+            short events = fds[i + 1].revents;
+            if (client.hasPending()) {
+                if ((events & (POLLOUT | POLLHUP | POLLERR)) && !client.flushPending()) {
+                    client.close();
+                }
+                continue;
+            }
+            if ((events & (POLLIN | POLLHUP | POLLERR)) && !client.readAvailable()) {
+                client.close();
+                continue;
+            }
+            if (!client.takeFrame(request)) {
+                if (client.m_peerClosed) {
+                    client.close(); // Encerrou sem completar outra requisição
+                }
+                continue;
+            }
+            reply.clear();
+            bool keepRunning = handler(request, reply);
+            client.queueFrames(reply);
+            if (!keepRunning) {
+                // Última resposta vai inteira antes de encerrar
+                if (client.setBlocking(true)) {
+                    client.writeAll(client.m_outgoing.data() + client.m_sent,
+                                    client.m_outgoing.size() - client.m_sent);
+                }
+                return;
+            }
+            if (!client.flushPending()) {
+                client.close();
+            }
+        }
+        clients.erase(std::remove_if(clients.begin(), clients.end(),
+                                     [](const LocalSocket& client) { return !client.isOpen(); }),
+                      clients.end());
+
+        if (fds[0].revents & POLLIN) {
+            LocalSocket client = m_listener.accept();
+            if (client.setBlocking(false)) {
+                clients.push_back(std::move(client));
+            }
+        }
+    }
+#else
+    (void)handler;
+    throw std::runtime_error("Unix sockets are not supported on this platform");
+#endif
+}
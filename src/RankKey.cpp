@@ -0,0 +1,242 @@
+#include "RankKey.h"
+#include <stdexcept>
+
+/**
+ * @file RankKey.cpp
+ * @brief Implementação das chaves de ordenação fracionárias.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ *
+ * Formato da chave: parte inteira + fração opcional. O primeiro caractere
+ * da parte inteira codifica seu comprimento ('a'..'z' = 2..27 caracteres
+ * para inteiros "positivos", 'Z'..'A' = 2..27 para "negativos"). Assim,
+ * inserções repetidas no fim/início incrementam o inteiro e o tamanho da
+ * chave cresce apenas logaritmicamente; a fração só é usada para inserir
+ * entre chaves vizinhas.
+ */
+
+namespace {
+
+constexpr char kDigits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+constexpr int kBase = 62;
+constexpr char kZero = '0';
+constexpr char kMaxDigit = 'z';
+constexpr char kSmallestInteger[] = "A00000000000000000000000000"; // 'A' + 26 zeros
+
+/**
+ * @brief Converte caractere em dígito base 62 (-1 se inválido).
+ */
+int digitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'Z') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'z') return c - 'a' + 36;
+    return -1;
+}
+
+/**
+ * @brief Comprimento da parte inteira a partir do caractere inicial.
+ * @return Comprimento ou 0 se o caractere não é um cabeçalho válido
+ */
+size_t integerLength(char head) {
+    if (head >= 'a' && head <= 'z') return static_cast<size_t>(head - 'a') + 2;
+    if (head >= 'A' && head <= 'Z') return static_cast<size_t>('Z' - head) + 2;
+    return 0;
+}
+
+/**
+ * @brief Extrai a parte inteira de uma chave válida.
+ */
+std::string integerPart(const std::string& key) {
+    size_t length = integerLength(key[0]);
+    if (length == 0 || length > key.size()) {
+        throw std::invalid_argument("Invalid rank key: " + key);
+    }
+    return key.substr(0, length);
+}
+
+/**
+ * @brief Ponto médio entre frações a e b (b vazio = 1.0).
+ */
+std::string midpoint(const std::string& a, const std::string& b) {
+    if (!b.empty()) {
+        // Prefixo comum (a é completado com '0' à direita)
+        size_t n = 0;
+        while (n < b.size() && (n < a.size() ? a[n] : kZero) == b[n]) {
+            ++n;
+        }
+        if (n > 0) {
+            std::string restA = n < a.size() ? a.substr(n) : std::string();
+            return b.substr(0, n) + midpoint(restA, b.substr(n));
+        }
+    }
+
+    int da = a.empty() ? 0 : digitValue(a[0]);
+    int db = b.empty() ? kBase : digitValue(b[0]);
+
+    if (db - da > 1) {
+        return std::string(1, kDigits[(da + db) / 2]);
+    }
+
+    // Dígitos consecutivos: b truncado no primeiro dígito já fica entre a e b
+    if (b.size() > 1) {
+        return b.substr(0, 1);
+    }
+
+    // Caso contrário mantém o dígito de a e desce um nível
+    std::string restA = a.size() > 1 ? a.substr(1) : std::string();
+    return std::string(1, kDigits[da]) + midpoint(restA, std::string());
+}
+
+/**
+ * @brief Próximo inteiro (vazio em overflow).
+ */
+std::string incrementInteger(const std::string& value) {
+    char head = value[0];
+    std::string digits = value.substr(1);
+
+    bool carry = true;
+    for (size_t i = digits.size(); carry && i-- > 0;) {
+        int d = digitValue(digits[i]) + 1;
+        if (d == kBase) {
+            digits[i] = kZero;
+        } else {
+            digits[i] = kDigits[d];
+            carry = false;
+        }
+    }
+
+    if (!carry) {
+        return std::string(1, head) + digits;
+    }
+    if (head == 'Z') {
+        return std::string("a") + kZero;
+    }
+    if (head == 'z') {
+        return std::string();
+    }
+
+    char nextHead = static_cast<char>(head + 1);
+    if (nextHead > 'a') {
+        digits.push_back(kZero);
+    } else {
+        digits.pop_back();
+    }
+    return std::string(1, nextHead) + digits;
+}
+
+/**
+ * @brief Inteiro anterior (vazio em underflow).
+ */
+std::string decrementInteger(const std::string& value) {
+    char head = value[0];
+    std::string digits = value.substr(1);
+
+    bool borrow = true;
+    for (size_t i = digits.size(); borrow && i-- > 0;) {
+        int d = digitValue(digits[i]) - 1;
+        if (d == -1) {
+            digits[i] = kMaxDigit;
+        } else {
+            digits[i] = kDigits[d];
+            borrow = false;
+        }
+    }
+
+    if (!borrow) {
+        return std::string(1, head) + digits;
+    }
+    if (head == 'a') {
+        return std::string("Z") + kMaxDigit;
+    }
+    if (head == 'A') {
+        return std::string();
+    }
+
+    char nextHead = static_cast<char>(head - 1);
+    if (nextHead < 'Z') {
+        digits.push_back(kMaxDigit);
+    } else {
+        digits.pop_back();
+    }
+    return std::string(1, nextHead) + digits;
+}
+
+} // namespace
+
+/**
+ * @brief Gera chave entre lo e hi.
+ * @param lo Chave anterior ("" = início)
+ * @param hi Chave posterior ("" = fim)
+ * @return Nova chave intermediária
+ */
+std::string RankKey::between(const std::string& lo, const std::string& hi) {
+    if (!lo.empty() && !isValid(lo)) {
+        throw std::invalid_argument("Invalid rank key: " + lo);
+    }
+    if (!hi.empty() && !isValid(hi)) {
+        throw std::invalid_argument("Invalid rank key: " + hi);
+    }
+    if (!lo.empty() && !hi.empty() && lo >= hi) {
+        throw std::invalid_argument("RankKey::between requires lo < hi");
+    }
+
+    if (lo.empty() && hi.empty()) {
+        return std::string("a") + kZero;
+    }
+
+    if (lo.empty()) {
+        std::string intHi = integerPart(hi);
+        std::string fracHi = hi.substr(intHi.size());
+        if (intHi == kSmallestInteger) {
+            return intHi + midpoint(std::string(), fracHi);
+        }
+        if (intHi < hi) {
+            return intHi; // hi tem fração: o inteiro sozinho já é menor
+        }
+        return decrementInteger(intHi);
+    }
+
+    std::string intLo = integerPart(lo);
+    std::string fracLo = lo.substr(intLo.size());
+
+    if (hi.empty()) {
+        std::string next = incrementInteger(intLo);
+        return next.empty() ? intLo + midpoint(fracLo, std::string()) : next;
+    }
+
+    std::string intHi = integerPart(hi);
+    std::string fracHi = hi.substr(intHi.size());
+    if (intLo == intHi) {
+        return intLo + midpoint(fracLo, fracHi);
+    }
+
+    std::string next = incrementInteger(intLo);
+    if (!next.empty() && next < hi) {
+        return next;
+    }
+    return intLo + midpoint(fracLo, std::string());
+}
+
+/**
+ * @brief Valida cabeçalho, alfabeto e terminação da chave.
+ * @param key Chave a validar
+ * @return true se válida
+ */
+bool RankKey::isValid(const std::string& key) {
+    if (key.empty()) {
+        return false;
+    }
+
+    size_t length = integerLength(key[0]);
+    if (length == 0 || length > key.size() || key == kSmallestInteger) {
+        return false;
+    }
+    for (size_t i = 1; i < key.size(); ++i) {
+        if (digitValue(key[i]) < 0) {
+            return false;
+        }
+    }
+
+    // Fração não pode terminar no menor dígito (sempre haveria chave igual mais curta)
+    return key.size() == length || key.back() != kZero;
+}
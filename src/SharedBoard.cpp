@@ -0,0 +1,218 @@
+#include "SharedBoard.h"
+#include "BoardBatch.h"
+#include "Column.h"
+#include <algorithm>
+
+using json = nlohmann::json;
+
+/**
+ * @file SharedBoard.cpp
+ * @brief Implementação da fachada thread-safe de Board.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+/**
+ * @brief Construtor (publica o primeiro snapshot).
+ * @param board Board a proteger
+ */
+SharedBoard::SharedBoard(Board board)
+    : m_board(std::move(board)), m_name(m_board.getName()),
+      m_snapshot(std::make_shared<const BoardSnapshot>(m_board))
+{
+}
+
+const std::string& SharedBoard::getName() const {
+    return m_name;
+}
+
+BoardSnapshot SharedBoard::snapshot() const {
+    return *std::atomic_load(&m_snapshot);
+}
+
+void SharedBoard::publish(BoardSnapshot next) {
+    std::atomic_store(&m_snapshot, std::make_shared<const BoardSnapshot>(std::move(next)));
+}
+
+void SharedBoard::publishChanges(const std::unordered_set<std::string>& columns,
+                                 const std::unordered_set<std::string>& cards) {
+    // Só escritores trocam m_snapshot, e o lock exclusivo está obtido
+    publish(m_snapshot->update(m_board, columns, cards));
+}
+
+std::string SharedBoard::columnOf(const std::string& cardId) const {
+    for (const auto& column : m_board.getColumns()) {
+        if (column.indexOfCard(cardId) >= 0) {
+            return column.getName();
+        }
+    }
+    return std::string();
+}
+
+bool SharedBoard::addCard(const std::string& columnName, const Card& card, size_t position) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.addCard(columnName, card, position)) {
+        return false;
+    }
+    publishChanges({columnName}, {card.getId()});
+    return true;
+}
+
+bool SharedBoard::removeCard(const std::string& columnName, const std::string& cardId) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.removeCard(columnName, cardId)) {
+        return false;
+    }
+    publishChanges({columnName}, {});
+    return true;
+}
+
+bool SharedBoard::moveCard(const std::string& cardId, const std::string& fromCol, const std::string& toCol,
+                           size_t position) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.moveCard(cardId, fromCol, toCol, position)) {
+        return false;
+    }
+    publishChanges({fromCol, toCol}, {cardId}); // Chave de ordenação do card muda
+    return true;
+}
+
+bool SharedBoard::updateCard(const std::string& cardId, const std::optional<std::string>& title,
+                             const std::optional<std::string>& description,
+                             const std::optional<int>& priority) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.updateCard(cardId, title, description, priority)) {
+        return false;
+    }
+    publishChanges({columnOf(cardId)}, {cardId});
+    return true;
+}
+
+bool SharedBoard::tagCard(const std::string& cardId, const std::string& tag, bool add) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.tagCard(cardId, tag, add)) {
+        return false;
+    }
+    publishChanges({columnOf(cardId)}, {cardId});
+    return true;
+}
+
+bool SharedBoard::applyBatch(const BoardBatch& batch) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_board.applyBatch(batch)) {
+        return false;
+    }
+
+    std::unordered_set<std::string> columns;
+    std::unordered_set<std::string> cards;
+    for (const auto& op : batch.operations()) {
+        cards.insert(op.cardId);
+        if (op.type == BoardBatch::OperationType::AddCard || op.type == BoardBatch::OperationType::MoveCard) {
+            columns.insert(op.column);
+            columns.insert(op.targetColumn);
+        } else {
+            columns.insert(columnOf(op.cardId));
+        }
+    }
+    publishChanges(columns, cards);
+    return true;
+}
+
+/**
+ * @brief Cópia do card com o ID informado.
+ * @param cardId Identificador do card
+ * @return Card ou nullopt se não existir
+ */
+std::optional<Card> SharedBoard::findCard(const std::string& cardId) const {
+    BoardSnapshot current = snapshot();
+    const Card* card = current.findCard(cardId);
+    return card ? std::optional<Card>(*card) : std::nullopt;
+}
+
+/**
+ * @brief Cópias dos cards com a etiqueta.
+ * @param tag Etiqueta
+ * @return Cards na ordem do board
+ */
+std::vector<Card> SharedBoard::findCardsByTag(const std::string& tag) const {
+    BoardSnapshot current = snapshot();
+    std::vector<Card> result;
+    for (const Card* card : current.findCardsByTag(tag)) {
+        result.push_back(*card);
+    }
+    return result;
+}
+
+/**
+ * @brief Cópias dos cards com prioridade mínima.
+ * @param minPriority Prioridade mínima (inclusive)
+ * @return Cards na ordem do board
+ */
+std::vector<Card> SharedBoard::filterByPriority(int minPriority) const {
+    BoardSnapshot current = snapshot();
+    std::vector<Card> result;
+    for (const Card* card : current.filterByPriority(minPriority)) {
+        result.push_back(*card);
+    }
+    return result;
+}
+
+size_t SharedBoard::cardCount() const {
+    return snapshot().getCardCount();
+}
+
+/**
+ * @brief Cópia consistente do board vivo (inclui log/métricas anexados).
+ * @return Board copiado sob lock compartilhado
+ */
+Board SharedBoard::copy() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_board;
+}
+
+json SharedBoard::toJson() const {
+    return snapshot().toJson();
+}
+
+/**
+ * @brief Inclui board no workspace.
+ * @param board Board a incluir
+ * @return Board compartilhado ou nullptr se o nome já existe
+ */
+std::shared_ptr<SharedBoard> SharedWorkspace::add(Board board) {
+    auto shared = std::make_shared<SharedBoard>(std::move(board));
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (!m_boards.emplace(shared->getName(), shared).second) {
+        return nullptr;
+    }
+    return shared;
+}
+
+bool SharedWorkspace::remove(const std::string& name) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    return m_boards.erase(name) > 0;
+}
+
+std::shared_ptr<SharedBoard> SharedWorkspace::find(const std::string& name) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_boards.find(name);
+    return it != m_boards.end() ? it->second : nullptr;
+}
+
+std::vector<std::string> SharedWorkspace::names() const {
+    std::vector<std::string> result;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        result.reserve(m_boards.size());
+        for (const auto& entry : m_boards) {
+            result.push_back(entry.first);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+size_t SharedWorkspace::size() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_boards.size();
+}
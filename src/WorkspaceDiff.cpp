@@ -0,0 +1,708 @@
+#include "WorkspaceDiff.h"
+#include "Card.h"
+#include "Column.h"
+#include "Compression.h"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+/**
+ * @file WorkspaceDiff.cpp
+ * @brief Implementação do diff/patch de workspaces.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+using json = nlohmann::json;
+
+namespace {
+
+/**
+ * @brief Estrutura de um workspace (sem cards): boards e colunas na ordem do arquivo.
+ */
+struct Structure {
+    struct ColumnInfo {
+        std::string name;
+        int wipLimit { -1 };
+    };
+    struct BoardInfo {
+        std::string id;
+        std::string name;
+        std::vector<ColumnInfo> columns;
+    };
+    std::vector<BoardInfo> boards;
+    json descriptions = json::object();              /**< @brief Tabela de DescriptionStore::pack() */
+};
+
+using CardVisitor = std::function<void(size_t board, size_t column, json& card)>;
+
+/**
+ * @brief Leitor SAX do formato de saveState().
+ *
+ * Só materializa o que pede: campos de board/coluna e a tabela de
+ * descrições (estrutura) ou um card por vez (cards). Activity log,
+ * métricas e usuários são percorridos sem alocar nada. Board e coluna são
+ * identificados pelo índice, pois as chaves vêm em ordem alfabética
+ * ("columns" antes de "id", "cards" antes de "name").
+ */
+class WorkspaceReader : public json::json_sax_t {
+public:
+    WorkspaceReader(Structure* structure, const CardVisitor* visitCard)
+        : m_structure(structure), m_visitCard(visitCard) {}
+
+    bool null() override { return value(json()); }
+    bool boolean(bool v) override { return value(json(v)); }
+    bool number_integer(number_integer_t v) override { return value(json(v)); }
+    bool number_unsigned(number_unsigned_t v) override { return value(json(v)); }
+    bool number_float(number_float_t v, const string_t&) override { return value(json(v)); }
+    bool string(string_t& v) override { return value(json(std::move(v))); }
+    bool binary(binary_t&) override { return value(json()); }
+
+    bool start_object(std::size_t) override { return open(true); }
+    bool start_array(std::size_t) override { return open(false); }
+    bool end_object() override { return close(); }
+    bool end_array() override { return close(); }
+
+    bool key(string_t& k) override {
+        if (!m_capture.empty()) {
+            m_captureKeys.back() = std::move(k);
+        } else {
+            m_frames.back().key = std::move(k);
+        }
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const json::exception& e) override {
+        throw std::runtime_error("invalid JSON at byte " + std::to_string(position) + ": " + e.what());
+    }
+
+private:
+    enum class Context { Root, Boards, Board, Columns, Column, Cards, Card, Descriptions, Other };
+
+    struct Frame {
+        Context context;
+        std::string key;
+    };
+
+    Context childContext(bool object) const {
+        if (m_frames.empty()) {
+            return object ? Context::Root : Context::Other;
+        }
+        const Frame& parent = m_frames.back();
+        switch (parent.context) {
+            case Context::Root:
+                if (parent.key == "boards" && !object) return Context::Boards;
+                if (parent.key == "descriptions" && object && m_structure) return Context::Descriptions;
+                return Context::Other;
+            case Context::Boards:  return object ? Context::Board : Context::Other;
+            case Context::Board:   return parent.key == "columns" && !object ? Context::Columns : Context::Other;
+            case Context::Columns: return object ? Context::Column : Context::Other;
+            case Context::Column:  return parent.key == "cards" && !object ? Context::Cards : Context::Other;
+            case Context::Cards:   return object && m_visitCard ? Context::Card : Context::Other;
+            default:               return Context::Other;
+        }
+    }
+
+    bool open(bool object) {
+        if (!m_capture.empty()) {
+            json* child = insert(object ? json::object() : json::array());
+            m_capture.push_back(child);
+            m_captureKeys.emplace_back();
+            return true;
+        }
+
+        Context context = childContext(object);
+        if (context == Context::Board) {
+            m_board = m_boardCount++;
+            m_columnCount = 0;
+            m_boardInfo = Structure::BoardInfo();
+        } else if (context == Context::Column) {
+            m_column = m_columnCount++;
+            m_columnInfo = Structure::ColumnInfo();
+        } else if (context == Context::Card) {
+            m_card = json::object();
+            m_capture.push_back(&m_card);
+            m_captureKeys.emplace_back();
+        }
+        m_frames.push_back(Frame{context, std::string()});
+        return true;
+    }
+
+    bool close() {
+        if (m_capture.size() > 1) {
+            m_capture.pop_back();
+            m_captureKeys.pop_back();
+            return true;
+        }
+        if (m_capture.size() == 1) {
+            m_capture.clear();
+            m_captureKeys.clear();
+            (*m_visitCard)(m_board, m_column, m_card);
+        }
+
+        Context context = m_frames.back().context;
+        m_frames.pop_back();
+        if (!m_structure) {
+            return true;
+        }
+        if (context == Context::Column) {
+            auto& boards = m_structure->boards;
+            if (boards.size() <= m_board) {
+                boards.resize(m_board + 1);
+            }
+            auto& columns = boards[m_board].columns;
+            if (columns.size() <= m_column) {
+                columns.resize(m_column + 1);
+            }
+            columns[m_column] = std::move(m_columnInfo);
+        } else if (context == Context::Board) {
+            auto& boards = m_structure->boards;
+            if (boards.size() <= m_board) {
+                boards.resize(m_board + 1);
+            }
+            boards[m_board].id = std::move(m_boardInfo.id);
+            boards[m_board].name = std::move(m_boardInfo.name);
+        }
+        return true;
+    }
+
+    bool value(json&& v) {
+        if (!m_capture.empty()) {
+            insert(std::move(v));
+            return true;
+        }
+        if (!m_structure || m_frames.empty()) {
+            return true;
+        }
+        const Frame& frame = m_frames.back();
+        if (frame.context == Context::Board && v.is_string()) {
+            if (frame.key == "id") {
+                m_boardInfo.id = v.get<std::string>();
+            } else if (frame.key == "name") {
+                m_boardInfo.name = v.get<std::string>();
+            }
+        } else if (frame.context == Context::Column) {
+            if (frame.key == "name" && v.is_string()) {
+                m_columnInfo.name = v.get<std::string>();
+            } else if (frame.key == "wipLimit" && v.is_number_integer()) {
+                m_columnInfo.wipLimit = v.get<int>();
+            }
+        } else if (frame.context == Context::Descriptions) {
+            m_structure->descriptions[frame.key] = std::move(v);
+        }
+        return true;
+    }
+
+    json* insert(json&& v) {
+        json& parent = *m_capture.back();
+        if (parent.is_object()) {
+            json& slot = parent[m_captureKeys.back()];
+            slot = std::move(v);
+            return &slot;
+        }
+        parent.push_back(std::move(v));
+        return &parent.back();
+    }
+
+    Structure* m_structure;                           /**< @brief Destino da estrutura (nullptr = não colhe) */
+    const CardVisitor* m_visitCard;                   /**< @brief Destino dos cards (nullptr = não monta) */
+    std::vector<Frame> m_frames;                      /**< @brief Caminho até o valor atual */
+    size_t m_boardCount { 0 };
+    size_t m_columnCount { 0 };
+    size_t m_board { 0 };                             /**< @brief Índice do board atual */
+    size_t m_column { 0 };                            /**< @brief Índice da coluna atual no board */
+    Structure::BoardInfo m_boardInfo;
+    Structure::ColumnInfo m_columnInfo;
+    json m_card;                                      /**< @brief Card em montagem */
+    std::vector<json*> m_capture;                     /**< @brief Containers abertos dentro do card */
+    std::vector<std::string> m_captureKeys;           /**< @brief Chave pendente de cada container */
+};
+
+void readWorkspace(const std::string& filename, Structure* structure, const CardVisitor* visitCard) {
+    CompressedIFStream in(filename);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + filename);
+    }
+    WorkspaceReader reader(structure, visitCard);
+    try {
+        json::sax_parse(in, &reader);
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Invalid workspace '" + filename + "': " + e.what());
+    }
+}
+
+Structure readStructure(const std::string& filename) {
+    Structure structure;
+    readWorkspace(filename, &structure, nullptr);
+    return structure;
+}
+
+void readCards(const std::string& filename, const CardVisitor& visit) {
+    readWorkspace(filename, nullptr, &visit);
+}
+
+std::uint64_t fnv1a(const std::string& text) {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Hash do conteúdo com a descrição resolvida: o mesmo card inline ou
+ * por referência (DescriptionStore::pack) tem o mesmo hash.
+ */
+std::uint64_t contentHash(const json& card, const json& descriptions) {
+    auto ref = card.find("descriptionRef");
+    if (ref == card.end()) {
+        return fnv1a(card.dump());
+    }
+    json resolved = card;
+    auto body = ref->is_string() ? descriptions.find(ref->get_ref<const std::string&>()) : descriptions.end();
+    resolved["description"] = body != descriptions.end() ? *body : *ref;
+    resolved.erase("descriptionRef");
+    return fnv1a(resolved.dump());
+}
+
+const std::string* columnName(const Structure& structure, size_t board, size_t column) {
+    if (board >= structure.boards.size() || column >= structure.boards[board].columns.size()) {
+        return nullptr;
+    }
+    const std::string& name = structure.boards[board].columns[column].name;
+    return name.empty() || structure.boards[board].id.empty() ? nullptr : &name;
+}
+
+/**
+ * @brief Operações de estrutura, removidos antes; colunas simuladas na ordem
+ * final para que cada posição emitida valha no momento da aplicação.
+ */
+void diffStructure(const Structure& from, const Structure& to, const WorkspaceDiff::Sink& sink,
+                   WorkspaceDiff::Summary& summary, std::unordered_set<std::string>& removedBoards,
+                   std::unordered_set<std::string>& removedColumns) {
+    std::unordered_map<std::string, const Structure::BoardInfo*> fromBoards;
+    for (const auto& board : from.boards) {
+        fromBoards.emplace(board.id, &board);
+    }
+    std::unordered_set<std::string> toBoards;
+    for (const auto& board : to.boards) {
+        toBoards.insert(board.id);
+    }
+
+    for (const auto& board : from.boards) {
+        if (!board.id.empty() && !toBoards.count(board.id)) {
+            sink(json{{"op", "removeBoard"}, {"board", board.id}});
+            removedBoards.insert(board.id);
+            ++summary.boardsRemoved;
+        }
+    }
+    for (const auto& board : to.boards) {
+        if (board.id.empty()) {
+            continue;
+        }
+        auto existing = fromBoards.find(board.id);
+        std::vector<Structure::ColumnInfo> current;
+        if (existing == fromBoards.end()) {
+            sink(json{{"op", "addBoard"}, {"board", board.id}, {"name", board.name}});
+            ++summary.boardsAdded;
+        } else {
+            std::unordered_set<std::string> wanted;
+            for (const auto& column : board.columns) {
+                wanted.insert(column.name);
+            }
+            for (const auto& column : existing->second->columns) {
+                if (wanted.count(column.name)) {
+                    current.push_back(column);
+                } else {
+                    sink(json{{"op", "removeColumn"}, {"board", board.id}, {"column", column.name}});
+                    removedColumns.insert(board.id + '\n' + column.name);
+                    ++summary.columnsRemoved;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < board.columns.size(); ++i) {
+            const auto& column = board.columns[i];
+            auto it = std::find_if(current.begin(), current.end(),
+                [&column](const Structure::ColumnInfo& c) { return c.name == column.name; });
+            json op = {{"board", board.id}, {"column", column.name}, {"wipLimit", column.wipLimit}, {"position", i}};
+            if (it == current.end()) {
+                op["op"] = "addColumn";
+                ++summary.columnsAdded;
+            } else if (static_cast<size_t>(it - current.begin()) != i || it->wipLimit != column.wipLimit) {
+                op["op"] = "updateColumn";
+                current.erase(it);
+                ++summary.columnsChanged;
+            } else {
+                continue;
+            }
+            current.insert(current.begin() + static_cast<std::ptrdiff_t>(std::min(i, current.size())), column);
+            sink(op);
+        }
+    }
+}
+
+/**
+ * @brief Lê um arquivo de delta linha a linha.
+ */
+template <typename Visit>
+void forEachOp(const std::string& deltaFile, Visit visit) {
+    CompressedIFStream in(deltaFile);
+    if (!in.is_open()) {
+        throw std::runtime_error("Could not open file for reading: " + deltaFile);
+    }
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        if (line.empty()) {
+            continue;
+        }
+        json op = json::parse(line, nullptr, false);
+        if (op.is_discarded() || !op.is_object() || !op.contains("op") || !op["op"].is_string()) {
+            throw std::runtime_error("Invalid delta '" + deltaFile + "': line " + std::to_string(lineNumber));
+        }
+        visit(op, lineNumber);
+    }
+}
+
+bool hasStrings(const json& op, const std::vector<const char*>& keys) {
+    return std::all_of(keys.begin(), keys.end(), [&op](const char* key) {
+        auto it = op.find(key);
+        return it != op.end() && it->is_string();
+    });
+}
+
+/**
+ * @brief Confere cabeçalho, rodapé e campos de cada operação.
+ */
+void validateDelta(const std::string& deltaFile) {
+    static const std::unordered_map<std::string, std::vector<const char*>> required = {
+        {"removeBoard", {"board"}},
+        {"removeColumn", {"board", "column"}},
+        {"addBoard", {"board", "name"}},
+        {"addColumn", {"board", "column"}},
+        {"updateColumn", {"board", "column"}},
+        {"description", {"ref", "text"}},
+        {"putCard", {"board", "column"}},
+        {"removeCard", {"board", "column", "card"}}
+    };
+
+    bool header = false;
+    bool footer = false;
+    size_t operations = 0;
+    forEachOp(deltaFile, [&](const json& op, size_t lineNumber) {
+        const std::string& name = op["op"].get_ref<const std::string&>();
+        auto fail = [&](const std::string& reason) {
+            throw std::runtime_error("Invalid delta '" + deltaFile + "': line " +
+                                     std::to_string(lineNumber) + " (" + reason + ")");
+        };
+        if (footer) {
+            fail("data after end");
+        }
+        if (!header) {
+            if (name != "delta" || op.value("format", 0) != WorkspaceDiff::FORMAT_VERSION) {
+                fail("not a delta file or unsupported format");
+            }
+            header = true;
+            return;
+        }
+        if (name == "end") {
+            if (!op.contains("operations") || !op["operations"].is_number_unsigned() ||
+                op["operations"].get<size_t>() != operations) {
+                fail("operation count mismatch");
+            }
+            footer = true;
+            return;
+        }
+        auto fields = required.find(name);
+        if (fields == required.end() || !hasStrings(op, fields->second)) {
+            fail("unknown operation or missing fields");
+        }
+        if (name == "putCard") {
+            try {
+                Card::fromJson(op.at("card"));
+            } catch (const std::exception& e) {
+                fail(std::string("invalid card: ") + e.what());
+            }
+        }
+        if (name != "description") {
+            ++operations;
+        }
+    });
+    if (!footer) {
+        throw std::runtime_error("Invalid delta '" + deltaFile + "': truncated (no end marker)");
+    }
+}
+
+Board* findBoard(std::vector<std::unique_ptr<Board>>& boards, const std::string& id) {
+    auto it = std::find_if(boards.begin(), boards.end(),
+        [&id](const std::unique_ptr<Board>& board) { return board->getId() == id; });
+    return it != boards.end() ? it->get() : nullptr;
+}
+
+/**
+ * @brief Card retirado pelo patch e onde estava.
+ */
+struct Detached {
+    std::string board;
+    std::string column;
+    Card card;
+};
+
+/**
+ * @brief Retira o card do workspace: primeiro onde o delta diz que está,
+ * depois em qualquer coluna (workspace diferente da origem do delta).
+ */
+std::optional<Detached> detachCard(std::vector<std::unique_ptr<Board>>& boards, const std::string& cardId,
+                                   const std::string& boardId, const std::string& column) {
+    auto take = [&cardId](Board& board, const Column& from) -> std::optional<Detached> {
+        Detached detached{board.getId(), from.getName(), *from.findCard(cardId)};
+        board.removeCard(from.getName(), cardId);
+        return detached;
+    };
+    if (Board* hinted = findBoard(boards, boardId)) {
+        const Column* from = hinted->findColumn(column);
+        if (from && from->findCard(cardId)) {
+            return take(*hinted, *from);
+        }
+    }
+    for (auto& board : boards) {
+        for (const auto& candidate : board->getColumns()) {
+            if (candidate.findCard(cardId)) {
+                return take(*board, candidate);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+size_t WorkspaceDiff::Summary::operations() const {
+    return boardsAdded + boardsRemoved + columnsAdded + columnsChanged + columnsRemoved +
+           cardsAdded + cardsChanged + cardsRemoved;
+}
+
+/**
+ * Quatro passadas em streaming (estrutura e cards de cada arquivo). Do lado
+ * "from" ficam em memória só ID, hash e localização de cada card; o lado
+ * "to" é sondado card a card e emite putCard na hora. Os não encontrados
+ * saem no fim como removeCard.
+ */
+WorkspaceDiff::Summary WorkspaceDiff::diff(const std::string& fromFile, const std::string& toFile,
+                                           const Sink& sink) {
+    Structure from = readStructure(fromFile);
+    Structure to = readStructure(toFile);
+
+    Summary summary;
+    sink(json{{"op", "delta"}, {"format", FORMAT_VERSION}, {"from", fromFile}, {"to", toFile}});
+    std::unordered_set<std::string> removedBoards;
+    std::unordered_set<std::string> removedColumns;
+    diffStructure(from, to, sink, summary, removedBoards, removedColumns);
+
+    struct Entry {
+        std::uint64_t hash;
+        std::uint32_t board;
+        std::uint32_t column;
+        bool matched;
+    };
+    std::unordered_map<std::string, Entry> table;
+    readCards(fromFile, [&](size_t board, size_t column, json& card) {
+        auto id = card.find("id");
+        if (id != card.end() && id->is_string() && columnName(from, board, column)) {
+            table[id->get<std::string>()] = Entry{contentHash(card, from.descriptions),
+                                                  static_cast<std::uint32_t>(board),
+                                                  static_cast<std::uint32_t>(column), false};
+        }
+    });
+
+    std::unordered_set<std::string> sentDescriptions;
+    readCards(toFile, [&](size_t board, size_t column, json& card) {
+        auto id = card.find("id");
+        const std::string* name = columnName(to, board, column);
+        if (id == card.end() || !id->is_string() || !name) {
+            return;
+        }
+        const std::string& boardId = to.boards[board].id;
+        json op = {{"op", "putCard"}, {"board", boardId}, {"column", *name}};
+
+        auto existing = table.find(id->get_ref<const std::string&>());
+        if (existing != table.end()) {
+            Entry& entry = existing->second;
+            entry.matched = true;
+            const std::string& fromBoard = from.boards[entry.board].id;
+            const std::string& fromColumn = from.boards[entry.board].columns[entry.column].name;
+            if (entry.hash == contentHash(card, to.descriptions) && fromBoard == boardId && fromColumn == *name) {
+                return;
+            }
+            op["from"] = {{"board", fromBoard}, {"column", fromColumn}};
+            ++summary.cardsChanged;
+        } else {
+            ++summary.cardsAdded;
+        }
+
+        auto ref = card.find("descriptionRef");
+        if (ref != card.end() && ref->is_string() && sentDescriptions.insert(ref->get<std::string>()).second) {
+            auto body = to.descriptions.find(ref->get_ref<const std::string&>());
+            if (body == to.descriptions.end()) {
+                throw std::runtime_error("Invalid workspace '" + toFile + "': unknown description reference in card '" +
+                                         id->get<std::string>() + "'");
+            }
+            sink(json{{"op", "description"}, {"ref", *ref}, {"text", *body}});
+        }
+        op["card"] = std::move(card);
+        sink(op);
+    });
+
+    for (const auto& [id, entry] : table) {
+        const auto& board = from.boards[entry.board];
+        const std::string& column = board.columns[entry.column].name;
+        if (entry.matched || removedBoards.count(board.id) || removedColumns.count(board.id + '\n' + column)) {
+            continue;
+        }
+        sink(json{{"op", "removeCard"}, {"board", board.id}, {"column", column}, {"card", id}});
+        ++summary.cardsRemoved;
+    }
+
+    sink(json{{"op", "end"}, {"operations", summary.operations()}});
+    return summary;
+}
+
+/**
+ * Três passadas sobre o delta: validação (nada muda se o arquivo está
+ * truncado ou malformado), retirada dos cards removidos/alterados e
+ * aplicação na ordem do arquivo. Com os cards alterados já fora, a
+ * reinserção nunca excede os limites WIP do workspace de destino.
+ */
+WorkspaceDiff::PatchResult WorkspaceDiff::apply(const std::string& deltaFile,
+                                                std::vector<std::unique_ptr<Board>>& boards,
+                                                const std::function<void(Board&)>& attach) {
+    validateDelta(deltaFile);
+
+    PatchResult result;
+    std::unordered_map<std::string, Detached> detached; // Versões anteriores dos cards alterados
+    forEachOp(deltaFile, [&](const json& op, size_t) {
+        const std::string& name = op["op"].get_ref<const std::string&>();
+        if (name == "removeCard") {
+            const std::string& cardId = op["card"].get_ref<const std::string&>();
+            if (detachCard(boards, cardId, op["board"].get<std::string>(), op["column"].get<std::string>())) {
+                ++result.applied.cardsRemoved;
+            } else {
+                result.skipped.push_back("removeCard " + cardId + ": not found");
+            }
+        } else if (name == "putCard") {
+            const json& card = op["card"];
+            std::string cardId = card.value("id", std::string());
+            const json& from = op.contains("from") && op["from"].is_object() ? op["from"] : op;
+            if (cardId.empty()) {
+                return;
+            }
+            if (auto previous = detachCard(boards, cardId, from.value("board", std::string()),
+                                           from.value("column", std::string()))) {
+                detached.emplace(cardId, std::move(*previous));
+            }
+        }
+    });
+
+    json descriptions = json::object();
+    forEachOp(deltaFile, [&](const json& op, size_t) {
+        const std::string& name = op["op"].get_ref<const std::string&>();
+        if (name == "delta" || name == "end" || name == "removeCard") {
+            return;
+        }
+        if (name == "description") {
+            descriptions[op["ref"].get<std::string>()] = op["text"];
+            return;
+        }
+
+        const std::string boardId = op["board"].get<std::string>();
+        Board* board = findBoard(boards, boardId);
+        auto skip = [&](const std::string& what, const std::string& reason) {
+            result.skipped.push_back(name + " " + what + ": " + reason);
+        };
+
+        if (name == "addBoard") {
+            if (board) {
+                skip(boardId, "already exists");
+                return;
+            }
+            boards.push_back(std::make_unique<Board>(boardId, op["name"].get<std::string>()));
+            attach(*boards.back());
+            ++result.applied.boardsAdded;
+            return;
+        }
+        if (!board) {
+            skip(boardId, "board not found");
+            return;
+        }
+        if (name == "removeBoard") {
+            boards.erase(std::find_if(boards.begin(), boards.end(),
+                [board](const std::unique_ptr<Board>& candidate) { return candidate.get() == board; }));
+            ++result.applied.boardsRemoved;
+            return;
+        }
+
+        const std::string column = op["column"].get<std::string>();
+        const std::string where = boardId + "/" + column;
+        size_t position = op.value("position", Board::END_POSITION);
+        int wipLimit = op.value("wipLimit", -1);
+        if (name == "removeColumn") {
+            if (board->removeColumn(column)) {
+                ++result.applied.columnsRemoved;
+            } else {
+                skip(where, "column not found");
+            }
+        } else if (name == "addColumn") {
+            if (board->addColumn(Column(column, wipLimit), position)) {
+                ++result.applied.columnsAdded;
+            } else {
+                skip(where, "already exists");
+            }
+        } else if (name == "updateColumn") {
+            // Pelo Board: alteração registrada no log e na versão do board
+            if (!board->setColumnWipLimit(column, wipLimit)) {
+                skip(where, "column not found");
+                return;
+            }
+            board->moveColumn(column, position);
+            ++result.applied.columnsChanged;
+        } else if (name == "putCard") {
+            json cardJson = op["card"];
+            auto ref = cardJson.find("descriptionRef");
+            if (ref != cardJson.end()) {
+                auto body = ref->is_string() ? descriptions.find(ref->get_ref<const std::string&>()) : descriptions.end();
+                if (body == descriptions.end()) {
+                    skip(where, "unknown description reference");
+                    return;
+                }
+                cardJson["description"] = *body;
+                cardJson.erase("descriptionRef");
+            }
+            Card card = Card::fromJson(cardJson);
+            auto previous = detached.find(card.getId());
+            if (!board->addCardByRank(column, card)) {
+                skip(where + "/" + card.getId(), "column not found or full");
+                if (previous != detached.end()) {
+                    // Devolve a versão anterior ao lugar de origem
+                    Board* origin = findBoard(boards, previous->second.board);
+                    if (origin) {
+                        origin->addCardByRank(previous->second.column, previous->second.card);
+                    }
+                }
+                return;
+            }
+            if (previous != detached.end()) {
+                ++result.applied.cardsChanged;
+            } else {
+                ++result.applied.cardsAdded;
+            }
+        }
+    });
+    return result;
+}
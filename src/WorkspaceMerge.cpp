@@ -0,0 +1,326 @@
+#include "WorkspaceMerge.h"
+#include "Board.h"
+#include "Column.h"
+#include "Card.h"
+#include "FlowMetrics.h"
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+using json = nlohmann::json;
+
+/**
+ * @file WorkspaceMerge.cpp
+ * @brief Implementação do merge de três vias de boards.
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+namespace {
+
+std::uint64_t versionOf(const json& j) {
+    return j.value("version", std::uint64_t(0));
+}
+
+// Só a versão: o conteúdo lido pode diferir do gravado sem que nada tenha mudado
+bool unchanged(const json* current, const json* base) {
+    if (!current || !base) {
+        return current == base;
+    }
+    return versionOf(*current) == versionOf(*base);
+}
+
+// Referência (não cópia): os índices guardam ponteiros para os elementos
+const json& columnsOf(const json* board) {
+    static const json none = json::array();
+    if (!board || !board->contains("columns")) {
+        return none;
+    }
+    return board->at("columns");
+}
+
+std::unordered_map<std::string, const json*> indexBy(const json& items, const char* key) {
+    std::unordered_map<std::string, const json*> index;
+    if (items.is_array()) {
+        for (const auto& item : items) {
+            index.emplace(item.at(key).get<std::string>(), &item);
+        }
+    }
+    return index;
+}
+
+const json* find(const std::unordered_map<std::string, const json*>& index, const std::string& key) {
+    auto it = index.find(key);
+    return it != index.end() ? it->second : nullptr;
+}
+
+/**
+ * @struct Placement
+ * @brief Card e a coluna onde está.
+ */
+struct Placement {
+    std::string column;
+    const json* card;
+};
+
+std::unordered_map<std::string, Placement> indexCards(const json* board) {
+    std::unordered_map<std::string, Placement> index;
+    if (board) {
+        for (const auto& column : columnsOf(board)) {
+            std::string name = column.at("name").get<std::string>();
+            for (const auto& card : column.at("cards")) {
+                index[card.at("id").get<std::string>()] = Placement{name, &card};
+            }
+        }
+    }
+    return index;
+}
+
+const Placement* find(const std::unordered_map<std::string, Placement>& index, const std::string& id) {
+    auto it = index.find(id);
+    return it != index.end() ? &it->second : nullptr;
+}
+
+bool unchangedPlacement(const Placement* current, const Placement* base) {
+    if (!current || !base) {
+        return current == base;
+    }
+    return current->column == base->column && unchanged(current->card, base->card);
+}
+
+// Mesmo resultado dos dois lados (versões iguais não bastam entre sessões)
+bool samePlacement(const Placement* a, const Placement* b) {
+    if (!a || !b) {
+        return a == b;
+    }
+    return a->column == b->column && *a->card == *b->card;
+}
+
+} // namespace
+
+/**
+ * @brief Merge de três vias dos boards.
+ * @param base Boards da última leitura/gravação
+ * @param ours Boards em memória
+ * @param theirs Boards no arquivo
+ * @return Resultado do merge
+ */
+WorkspaceMerge::Result WorkspaceMerge::merge(const json& base, const json& ours, const json& theirs) {
+    Result result;
+    auto baseIndex = indexBy(base, "id");
+    auto theirIndex = indexBy(theirs, "id");
+    std::unordered_set<std::string> ourIds;
+
+    for (const auto& board : ours) {
+        std::string id = board.at("id").get<std::string>();
+        ourIds.insert(id);
+        const json* baseBoard = find(baseIndex, id);
+        const json* theirBoard = find(theirIndex, id);
+
+        if (!theirBoard) {
+            // Removido em disco: some também daqui se não foi tocado
+            if (baseBoard && unchanged(&board, baseBoard)) {
+                ++result.fromDisk;
+            } else {
+                result.boards.push_back(board);
+            }
+        } else if (unchanged(theirBoard, baseBoard)) {
+            result.boards.push_back(board);
+        } else if (unchanged(&board, baseBoard)) {
+            result.boards.push_back(*theirBoard);
+            ++result.fromDisk;
+        } else {
+            result.boards.push_back(mergeBoard(baseBoard, board, *theirBoard, result));
+        }
+    }
+
+    // Boards que só existem em disco
+    if (theirs.is_array()) {
+        for (const auto& board : theirs) {
+            std::string id = board.at("id").get<std::string>();
+            if (ourIds.count(id)) {
+                continue;
+            }
+            const json* baseBoard = find(baseIndex, id);
+            if (!baseBoard) {
+                result.boards.push_back(board); // Criado por outro processo
+                ++result.fromDisk;
+            } else if (!unchanged(&board, baseBoard)) {
+                result.boards.push_back(board); // Removido aqui, alterado lá
+                result.conflicts.push_back(board.at("name").get<std::string>());
+                ++result.fromDisk;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Merge card a card.
+ * @param base Board na base (nullptr se criado dos dois lados)
+ * @param ours Board em memória
+ * @param theirs Board em disco
+ * @param result Recebe conflitos e contagem
+ * @return Board combinado
+ */
+json WorkspaceMerge::mergeBoard(const json* base, const json& ours, const json& theirs, Result& result) {
+    const std::string boardName = ours.at("name").get<std::string>();
+    auto baseColumns = indexBy(columnsOf(base), "name");
+    auto ourColumns = indexBy(columnsOf(&ours), "name");
+    auto theirColumns = indexBy(columnsOf(&theirs), "name");
+
+    // 1. Colunas: ordem deste lado, depois as criadas em disco
+    json columns = json::array();
+    std::unordered_map<std::string, size_t> slots;
+    std::uint64_t columnVersion = 0;
+    auto addColumn = [&](const json& column) {
+        json shell = column;
+        shell["cards"] = json::array();
+        columnVersion = std::max(columnVersion, versionOf(column));
+        slots[column.at("name").get<std::string>()] = columns.size();
+        columns.push_back(std::move(shell));
+    };
+    for (const auto& column : columnsOf(&ours)) {
+        std::string name = column.at("name").get<std::string>();
+        const json* baseColumn = find(baseColumns, name);
+        const json* theirColumn = find(theirColumns, name);
+        if (baseColumn && !theirColumn && versionOf(column) == versionOf(*baseColumn)) {
+            continue; // Removida em disco, intocada aqui
+        }
+        bool oursTouched = !baseColumn || versionOf(column) != versionOf(*baseColumn);
+        addColumn(theirColumn && !oursTouched ? *theirColumn : column);
+    }
+    for (const auto& column : columnsOf(&theirs)) {
+        std::string name = column.at("name").get<std::string>();
+        const json* baseColumn = find(baseColumns, name);
+        if (!ourColumns.count(name) && (!baseColumn || versionOf(column) != versionOf(*baseColumn))) {
+            addColumn(column);
+        }
+    }
+
+    // 2. Cards: escolhe um lado por card
+    auto baseCards = indexCards(base);
+    auto ourCards = indexCards(&ours);
+    auto theirCards = indexCards(&theirs);
+
+    std::vector<std::string> ids;
+    std::unordered_set<std::string> seen;
+    for (const auto* index : {&ourCards, &theirCards}) {
+        for (const auto& entry : *index) {
+            if (seen.insert(entry.first).second) {
+                ids.push_back(entry.first);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    auto place = [&](const Placement& placement) {
+        auto slot = slots.find(placement.column);
+        if (slot == slots.end()) {
+            return false;
+        }
+        json& column = columns[slot->second];
+        int wipLimit = column.value("wipLimit", -1);
+        if (wipLimit != -1 && column["cards"].size() >= static_cast<size_t>(std::max(wipLimit, 0))) {
+            return false;
+        }
+        column["cards"].push_back(*placement.card);
+        return true;
+    };
+    // Versão do disco sempre entra, mesmo que a coluna tenha sido removida aqui
+    auto placeFromDisk = [&](const Placement& placement) {
+        const json* column = find(theirColumns, placement.column);
+        if (!slots.count(placement.column) && column) {
+            addColumn(*column);
+        }
+        place(placement);
+    };
+
+    // Cards do disco (ou intocados) primeiro: cabem, pois o disco respeita o WIP
+    std::vector<std::pair<const Placement*, const Placement*>> ourChanges;
+    for (const auto& id : ids) {
+        const Placement* basePlacement = find(baseCards, id);
+        const Placement* ourPlacement = find(ourCards, id);
+        const Placement* theirPlacement = find(theirCards, id);
+        bool oursChanged = !unchangedPlacement(ourPlacement, basePlacement);
+        bool theirsChanged = !unchangedPlacement(theirPlacement, basePlacement);
+
+        if (!oursChanged || samePlacement(ourPlacement, theirPlacement)) {
+            if (theirPlacement && !place(*theirPlacement)) {
+                result.conflicts.push_back(boardName + "/" + id);
+            }
+            if (theirsChanged && !samePlacement(ourPlacement, theirPlacement)) {
+                ++result.fromDisk;
+            }
+        } else if (!theirsChanged) {
+            if (ourPlacement) {
+                ourChanges.emplace_back(ourPlacement, theirPlacement);
+            }
+        } else {
+            // Alterado dos dois lados: prevalece o disco
+            if (theirPlacement) {
+                placeFromDisk(*theirPlacement);
+            }
+            result.conflicts.push_back(boardName + "/" + id);
+            ++result.fromDisk;
+        }
+    }
+    for (const auto& change : ourChanges) {
+        if (!place(*change.first)) {
+            // Coluna removida em disco ou cheia: fica a versão do disco
+            if (change.second) {
+                placeFromDisk(*change.second);
+            }
+            result.conflicts.push_back(boardName + "/" + change.first->card->at("id").get<std::string>());
+        }
+    }
+
+    // 3. Ordem por chave (Column::fromJson reposiciona chaves repetidas)
+    for (auto& column : columns) {
+        auto& cards = column["cards"];
+        std::stable_sort(cards.begin(), cards.end(), [](const json& a, const json& b) {
+            return a.value("rank", std::string()) < b.value("rank", std::string());
+        });
+        column["version"] = columnVersion + 1;
+    }
+
+    json merged = ours;
+    merged["columns"] = std::move(columns);
+    merged["version"] = std::max(versionOf(ours), versionOf(theirs)) + 1;
+    return merged;
+}
+
+/**
+ * @brief Substitui os boards em memória pelos do merge.
+ * @param merged Boards combinados
+ * @param diskMetrics Métricas salvas pela outra sessão
+ * @param boards Boards em memória
+ * @param log Log dos boards
+ * @param metrics Métricas do workspace
+ */
+void WorkspaceMerge::adopt(const json& merged, const json& diskMetrics, std::vector<std::unique_ptr<Board>>& boards,
+                           ActivityLog* log, FlowMetrics& metrics) {
+    std::vector<std::unique_ptr<Board>> rebuilt;
+    rebuilt.reserve(merged.size());
+    for (const auto& boardJson : merged) {
+        rebuilt.push_back(std::make_unique<Board>(Board::fromJson(boardJson)));
+    }
+
+    std::unordered_set<std::string> previous;
+    for (const auto& board : boards) {
+        previous.insert(board->getName());
+    }
+    for (auto& board : rebuilt) {
+        // Antes de anexar: track() não recomeça um board já acompanhado
+        metrics.reconcile(*board, diskMetrics);
+        board->attachActivityLog(log);
+        board->attachFlowMetrics(&metrics);
+        board->checkpoint();
+        previous.erase(board->getName());
+    }
+    for (const auto& name : previous) {
+        metrics.removeBoard(name);
+    }
+    boards = std::move(rebuilt);
+}
@@ -3,16 +3,38 @@
 #include "Card.h"
 #include "User.h"
 #include "ActivityLog.h"
+#include "CardIdAllocator.h"
+#include "BoardBatch.h"
+#include "Command.h"
+#include "CommandHistory.h"
+#include "CommandDispatcher.h"
+#include "CommandLine.h"
+#include "CardImporter.h"
+#include "BoardReplay.h"
+#include "FlowMetrics.h"
+#include "WorkspaceMerge.h"
+#include "LocalSocket.h"
+#include "JsonLinesWriter.h"
+#include "CsvWriter.h"
+#include "CardExporter.h"
+#include "Compression.h"
+#include "DescriptionStore.h"
+#include "CardArchive.h"
+#include "WorkspaceDiff.h"
 #include "external/json.hpp"
+#include <array>
 #include <iostream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
 #include <fstream>
 #include <algorithm>
+#include <filesystem>
+#include <unordered_set>
 
 using json = nlohmann::json;
 
@@ -23,17 +45,37 @@ using json = nlohmann::json;
  * @date 01/10/2025
  */
 
+// Redireciona std::cout/std::cerr enquanto existir (resposta de um comando no modo servidor)
+struct OutputCapture {
+    OutputCapture(std::ostream& out, std::ostream& err)
+        : savedOut(std::cout.rdbuf(out.rdbuf())), savedErr(std::cerr.rdbuf(err.rdbuf())) {}
+    ~OutputCapture() {
+        std::cout.rdbuf(savedOut);
+        std::cerr.rdbuf(savedErr);
+    }
+    std::streambuf* savedOut;
+    std::streambuf* savedErr;
+};
+
 class KanbanCLI {
 private:
     std::vector<std::unique_ptr<Board>> boards;
     std::vector<std::unique_ptr<User>> users;
     std::unique_ptr<ActivityLog> activityLog;
-    static int cardIdCounter; // Contador estático para IDs únicos
+    FlowMetrics flowMetrics; // Lead/cycle time, throughput e CFD por board
+    CommandHistory history;  // Desfazer/refazer da sessão (modo interativo)
+    CommandDispatcher commands; // Verbo/subverbo → handler (registerCommands)
+    json baseBoards = json::array(); // Boards da última leitura/gravação de baseFile (base do merge)
+    std::string baseFile;
+    Compression::Codec baseCodec = Compression::Codec::None; // Codec de baseFile (mantido ao salvar de novo)
+    enum class OutputFormat { Text, Jsonl, Csv };
+    OutputFormat outputFormat = OutputFormat::Text; // --format do comando atual (jsonl/csv: uma linha por card/entrada)
     
 public:
     KanbanCLI() : activityLog(std::make_unique<ActivityLog>()) {
         // Cria usuário padrão para demonstração
         users.push_back(std::make_unique<User>("default", "Default User", "user@example.com"));
+        registerCommands();
     }
     
     void showUsage() {
@@ -43,539 +85,1406 @@ public:
         std::cout << "  board create <name>                    - Create new board\n";
         std::cout << "  board list                             - List all boards\n";
         std::cout << "  board remove <name>                    - Remove board\n";
+        std::cout << "  board at <name> <date>                 - Show board as of YYYY-MM-DD[THH:MM[:SS]] (replay)\n";
         std::cout << "  column add <board> <name> [wip_limit]  - Add column to board\n";
         std::cout << "  column list <board>                    - List columns in board\n";
         std::cout << "  column remove <board> <name>           - Remove column from board\n";
         std::cout << "  card add <board> <column> <title>      - Add card to column\n";
         std::cout << "  card list <board> [column]             - List cards in board/column\n";
-        std::cout << "  card move <card_id> <from_col> <to_col> <board> - Move card between columns\n";
+        std::cout << "  card move <card_id> <from_col> <to_col> <board> [position] - Move card between columns\n";
+        std::cout << "  card reorder <board> <column> <card_id> <before_id|end> - Reorder card in column\n";
         std::cout << "  card remove <board> <column> <card_id> - Remove card\n";
         std::cout << "  card tag <board> <card_id> <tag>       - Add tag to card\n";
         std::cout << "  card untag <board> <card_id> <tag>     - Remove tag from card\n";
+        std::cout << "  card bulk-move <board> <from_col> <to_col> [tag] - Move all (tagged) cards at once\n";
+        std::cout << "  card bulk-tag <board> <tag> [tag=<t>|priority=<n>|column=<c>] - Tag all matching cards\n";
+        std::cout << "  import <board> <file> [column]         - Import cards in one batch (.json array, .csv, .jsonl)\n";
         std::cout << "  filter tag <board> <tag>               - Show cards with specific tag\n";
         std::cout << "  filter priority <board> <min_priority> - Show cards with priority >= value\n";
         std::cout << "  tags <board>                           - List all tags in board\n";
-        std::cout << "  history                                - Show activity history\n";
-        std::cout << "  save <filename>                        - Save state to file (suggestion: data/my_board.json)\n";
+        std::cout << "  metrics <board>                        - Show lead/cycle time, throughput and CFD\n";
+        std::cout << "  undo                                   - Undo last change (interactive mode)\n";
+        std::cout << "  redo                                   - Redo last undone change\n";
+        std::cout << "  history [--page <n>]                   - Show activity history (--page: full trail, 50 per page)\n";
+        std::cout << "  history --last <n> | --since <date>    - Show last n entries / entries since YYYY-MM-DD[THH:MM[:SS]]\n";
+        std::cout << "  save <filename> [--compress]           - Save state to file (suggestion: data/my_board.json; .gz = gzip)\n";
         std::cout << "  load <filename>                        - Load state from file (suggestion: data/my_board.json)\n";
+        std::cout << "  --batch <script|-> [--load <file>] [--save <file>] - Run one command per line, load/save once\n";
+        std::cout << "  serve --socket <path> [file]           - Keep workspace in memory and serve commands on a Unix socket\n";
+        std::cout << "  --socket <path> [command]              - Run command (or each stdin line) on a running server\n";
+        std::cout << "  export <board> [--fields <f1,f2,...>] [--output <file>] [column=<c>] [tag=<t>] [priority=<n>]\n";
+        std::cout << "                                         - Stream cards as CSV (default) or JSON Lines\n";
+        std::cout << "  archive <board> <column> [--older-than <n>d|h|w] - Move cards to the compressed archive\n";
+        std::cout << "  archive get <card_id> | search <text> [limit] - Look up archived cards\n";
+        std::cout << "  diff <a> <b> [delta_file] [--compress] - Card/column-level changes between two workspace files\n";
+        std::cout << "  patch <delta_file>                     - Apply a delta written by diff to the current workspace\n";
+        std::cout << "  <query> --format jsonl|csv             - One row per card/entry (card list, filter, board at, history, export)\n";
         std::cout << "  help                                   - Show this help\n";
         std::cout << "  exit                                   - Exit interactive mode\n\n";
         std::cout << "Interactive mode: Run without arguments\n";
     }
     
-    bool processCommand(const std::vector<std::string>& args) {
-        if (args.empty()) {
+    bool processCommand(const std::vector<std::string_view>& args) {
+        if (args.empty() || args[0] == "exit") {
             return false;
         }
         
-        const std::string& command = args[0];
+        auto format = std::find(args.begin(), args.end(), "--format");
+        if (format != args.end()) {
+            if (format + 1 == args.end() || (format[1] != "jsonl" && format[1] != "csv" && format[1] != "text")) {
+                std::cerr << "Error: Invalid format (use --format jsonl|csv|text).\n";
+                return true;
+            }
+            std::vector<std::string_view> rest(args.begin(), format);
+            rest.insert(rest.end(), format + 2, args.end());
+            FormatScope scope(outputFormat, format[1] == "jsonl" ? OutputFormat::Jsonl
+                                          : format[1] == "csv" ? OutputFormat::Csv : OutputFormat::Text);
+            return processCommand(rest);
+        }
         
-        if (command == "help") {
-            showUsage();
-            return true;
+        std::string message;
+        switch (commands.dispatch(args, message)) {
+            case CommandDispatcher::Result::Handled:
+                break;
+            case CommandDispatcher::Result::UnknownVerb:
+                std::cerr << "Error: Unknown command '" << args[0] << "'. Use 'help' for usage.\n";
+                break;
+            case CommandDispatcher::Result::UnknownSubverb:
+                std::cerr << "Error: Invalid " << args[0] << " command. Use 'help' for usage.\n";
+                break;
+            case CommandDispatcher::Result::BadArity:
+                std::cerr << "Usage: " << message << "\n";
+                break;
+            case CommandDispatcher::Result::BadArgument:
+                std::cerr << "Error: " << message << "\n";
+                break;
         }
+        return true;
+    }
+
+private:
+    // Troca o formato de saída só durante um comando
+    struct FormatScope {
+        FormatScope(OutputFormat& target, OutputFormat value) : format(target), saved(target) { format = value; }
+        ~FormatScope() { format = saved; }
+        OutputFormat& format;
+        OutputFormat saved;
+    };
+    
+    // Tabela de comandos: verbo [subverbo], operandos mín./máx., sintaxe e handler
+    void registerCommands() {
+        using Args = CommandArgs;
         
-        if (command == "exit") {
-            return false;
+        commands.add("help", 0, 0, "help", [this](const Args&) { showUsage(); });
+        commands.add("undo", 0, 0, "undo", [this](const Args&) { undo(); });
+        commands.add("redo", 0, 0, "redo", [this](const Args&) { redo(); });
+        commands.add("save", 1, 2, "save <filename> [--compress]", [this](const Args& a) {
+            if (a.size() == 2 && a[1] != "--compress") {
+                throw CommandArgs::Error("Invalid option '" + std::string(a[1]) + "' (use --compress).");
+            }
+            saveState(std::string(a[0]), a.size() == 2);
+        });
+        commands.add("load", 1, 1, "load <filename>", [this](const Args& a) { loadState(std::string(a[0])); });
+        commands.add("import", 2, 3, "import <board> <file.json|file.csv|file.jsonl> [column]",
+                     [this](const Args& a) { importCards(a[0], std::string(a[1]), std::string(a.get(2, ""))); });
+        commands.add("metrics", 1, 1, "metrics <board>", [this](const Args& a) { showMetrics(a[0]); });
+        commands.add("tags", 1, 1, "tags <board>", [this](const Args& a) { showTags(a[0]); });
+        commands.add("export", 1, 8,
+                     "export <board> [--format csv|jsonl] [--fields <f1,f2,...>] [--output <file>] "
+                     "[column=<c>] [tag=<t>] [priority=<n>]",
+                     [this](const Args& a) { exportCards(a); });
+        
+        commands.add("archive", 2, 4, "archive <board> <column> [--older-than <n>d|h|w]",
+                     [this](const Args& a) { archiveCards(a); });
+        commands.add("archive", "get", 1, 1, "archive get <card_id>",
+                     [this](const Args& a) { archiveGet(std::string(a[0])); });
+        commands.add("archive", "search", 1, 2, "archive search <text> [limit]",
+                     [this](const Args& a) { archiveSearch(a[0], a.size() == 2 ? a.count(1, "limit") : 20); });
+        commands.add("diff", 2, 4, "diff <a> <b> [delta_file] [--compress]",
+                     [this](const Args& a) { diffWorkspaces(a); });
+        commands.add("patch", 1, 1, "patch <delta_file>", [this](const Args& a) { patchWorkspace(std::string(a[0])); });
+        
+        const char* historyUsage = "history [--page <n> | --last <n> | --since <date>]";
+        commands.add("history", 0, 0, historyUsage, [this](const Args&) { showHistory(); });
+        commands.add("history", "--page", 1, 1, historyUsage,
+                     [this](const Args& a) { showHistoryPage(a.count(0, "page")); });
+        commands.add("history", "--last", 1, 1, historyUsage,
+                     [this](const Args& a) { showHistoryLast(a.count(0, "count")); });
+        commands.add("history", "--since", 1, 1, historyUsage, [this](const Args& a) {
+            std::chrono::system_clock::time_point since;
+            if (!parseTimestamp(a[0], since)) {
+                throw Args::Error("Invalid date '" + std::string(a[0]) + "' (use YYYY-MM-DD[THH:MM[:SS]]).");
+            }
+            showHistorySince(since);
+        });
+        
+        commands.add("board", "create", 1, 1, "board create <name>", [this](const Args& a) { boardCreate(a[0]); });
+        commands.add("board", "list", 0, 0, "board list", [this](const Args&) { listBoards(); });
+        commands.add("board", "remove", 1, 1, "board remove <name>", [this](const Args& a) { boardRemove(a[0]); });
+        commands.add("board", "at", 2, 2, "board at <name> <date>", [this](const Args& a) { boardAt(a); });
+        
+        commands.add("column", "add", 2, 3, "column add <board> <name> [wip_limit]",
+                     [this](const Args& a) { columnAdd(a); });
+        commands.add("column", "list", 1, 1, "column list <board>", [this](const Args& a) { listColumns(a[0]); });
+        commands.add("column", "remove", 2, 2, "column remove <board> <name>",
+                     [this](const Args& a) { columnRemove(a[0], std::string(a[1])); });
+        
+        commands.add("card", "add", 3, 3, "card add <board> <column> <title>", [this](const Args& a) { cardAdd(a); });
+        commands.add("card", "list", 1, 2, "card list <board> [column]",
+                     [this](const Args& a) { listCards(a[0], std::string(a.get(1, ""))); });
+        commands.add("card", "move", 4, 5, "card move <card_id> <from_col> <to_col> <board> [position]",
+                     [this](const Args& a) { cardMove(a); });
+        commands.add("card", "reorder", 4, 4, "card reorder <board> <column> <card_id> <before_id|end>",
+                     [this](const Args& a) { cardReorder(a); });
+        commands.add("card", "remove", 3, 3, "card remove <board> <column> <card_id>",
+                     [this](const Args& a) { cardRemove(a); });
+        commands.add("card", "tag", 3, 3, "card tag <board> <card_id> <tag>",
+                     [this](const Args& a) { cardTag(a, true); });
+        commands.add("card", "untag", 3, 3, "card untag <board> <card_id> <tag>",
+                     [this](const Args& a) { cardTag(a, false); });
+        commands.add("card", "bulk-move", 3, 4, "card bulk-move <board> <from_col> <to_col> [tag]",
+                     [this](const Args& a) { cardBulkMove(a); });
+        commands.add("card", "bulk-tag", 2, 3, "card bulk-tag <board> <tag> [tag=<t>|priority=<n>|column=<c>]",
+                     [this](const Args& a) { cardBulkTag(a); });
+        
+        commands.add("filter", "tag", 2, 2, "filter tag <board> <tag>", [this](const Args& a) { filterTag(a); });
+        commands.add("filter", "priority", 2, 2, "filter priority <board> <min_priority>",
+                     [this](const Args& a) { filterPriority(a); });
+    }
+    
+    // Board do comando ou nullptr (com a mensagem de erro já impressa)
+    Board* requireBoard(std::string_view name) {
+        Board* board = findBoard(name);
+        if (!board) {
+            std::cerr << "Error: Board '" << name << "' not found.\n";
+        }
+        return board;
+    }
+    
+    void undo() {
+        std::string description = history.undoDescription();
+        if (description.empty()) {
+            std::cout << "Nothing to undo.\n";
+        } else if (history.undo()) {
+            std::cout << "Undone: " << description << "\n";
+        } else {
+            std::cerr << "Error: Could not undo '" << description << "'. History cleared.\n";
+        }
+    }
+    
+    void redo() {
+        std::string description = history.redoDescription();
+        if (description.empty()) {
+            std::cout << "Nothing to redo.\n";
+        } else if (history.redo()) {
+            std::cout << "Redone: " << description << "\n";
+        } else {
+            std::cerr << "Error: Could not redo '" << description << "'. History cleared.\n";
+        }
+    }
+    
+    void showTags(std::string_view boardName) {
+        Board* board = requireBoard(boardName);
+        if (!board) {
+            return;
         }
         
-        if (command == "history") {
-            showHistory();
-            return true;
+        std::vector<std::string> allTags = board->getAllTags();
+        if (allTags.empty()) {
+            std::cout << "No tags found in board '" << boardName << "'.\n";
+        } else {
+            std::cout << "Tags in board '" << boardName << "':\n";
+            for (const auto& tag : allTags) {
+                std::cout << "  - " << tag << "\n";
+            }
+        }
+    }
+    
+    void boardCreate(std::string_view name) {
+        auto board = std::make_unique<Board>(std::string(name), std::string(name));
+        board->attachActivityLog(activityLog.get());
+        board->attachFlowMetrics(&flowMetrics);
+        board->checkpoint(); // Ponto de partida para replay
+        boards.push_back(std::move(board));
+        std::cout << "Board '" << name << "' created successfully.\n";
+    }
+    
+    void boardAt(const CommandArgs& a) {
+        std::chrono::system_clock::time_point when;
+        if (!parseTimestamp(a[1], when)) {
+            throw CommandArgs::Error("Invalid date '" + std::string(a[1]) + "' (use YYYY-MM-DD[THH:MM[:SS]]).");
         }
         
-        if (command == "save") {
-            if (args.size() == 2) {
-                saveState(args[1]);
-            } else {
-                std::cerr << "Usage: save <filename>\n";
-                std::cerr << "Example: save data/my_board.json\n";
+        auto board = BoardReplay::at(*activityLog, std::string(a[0]), when);
+        if (!board) {
+            std::cerr << "Error: Cannot reconstruct board '" << a[0] << "' at "
+                     << formatTimestamp(when) << " (no checkpoint in activity trail).\n";
+            return;
+        }
+        if (outputFormat == OutputFormat::Text) {
+            std::cout << "Board '" << a[0] << "' as of " << formatTimestamp(when) << ":\n";
+        }
+        printBoardCards(*board);
+    }
+    
+    void boardRemove(std::string_view name) {
+        auto it = std::find_if(boards.begin(), boards.end(),
+            [&name](const std::unique_ptr<Board>& board) {
+                return board->getName() == name;
+            });
+        
+        if (it != boards.end()) {
+            history.clear(); // Comandos guardam ponteiro para o board
+            flowMetrics.removeBoard(std::string(name));
+            boards.erase(it);
+            std::cout << "Board '" << name << "' removed successfully.\n";
+        } else {
+            std::cerr << "Error: Board '" << name << "' not found.\n";
+        }
+    }
+    
+    void columnAdd(const CommandArgs& a) {
+        std::string_view boardName = a[0];
+        std::string columnName(a[1]);
+        int wipLimit = -1;
+        if (a.size() == 3) {
+            try {
+                wipLimit = a.integer(2, "WIP limit");
+            } catch (const CommandArgs::Error&) {
+                std::cerr << "Error: Invalid WIP limit value. Using no limit (-1).\n";
             }
-            return true;
         }
         
-        if (command == "load") {
-            if (args.size() == 2) {
-                loadState(args[1]);
-            } else {
-                std::cerr << "Usage: load <filename>\n";
-                std::cerr << "Example: load data/my_board.json\n";
+        Board* board = requireBoard(boardName);
+        if (!board) {
+            return;
+        }
+        
+        if (history.execute(*board, std::make_unique<AddColumnCommand>(Column(columnName, wipLimit)))) {
+            std::cout << "Column '" << columnName << "' added to board '" << boardName << "'";
+            if (wipLimit != -1) {
+                std::cout << " with WIP limit " << wipLimit;
             }
-            return true;
+            std::cout << ".\n";
+        } else {
+            std::cerr << "Error: Column '" << columnName << "' already exists in board.\n";
+        }
+    }
+    
+    void columnRemove(std::string_view boardName, const std::string& columnName) {
+        Board* board = requireBoard(boardName);
+        if (!board) {
+            return;
         }
         
-        if (command == "board") {
-            return processBoardCommand(args);
+        if (history.execute(*board, std::make_unique<RemoveColumnCommand>(columnName))) {
+            std::cout << "Column '" << columnName << "' removed from board '" << boardName << "'.\n";
+        } else {
+            std::cerr << "Error: Column '" << columnName << "' not found in board.\n";
         }
+    }
+    
+    void cardAdd(const CommandArgs& a) {
+        std::string_view boardName = a[0];
+        std::string columnName(a[1]);
+        std::string title(a[2]);
         
-        if (command == "column") {
-            return processColumnCommand(args);
+        Board* board = requireBoard(boardName);
+        if (!board) {
+            return;
         }
         
-        if (command == "card") {
-            return processCardCommand(args);
+        // Gera ID único (seguro entre processos quando há workspace anexado)
+        std::string cardId = CardIdAllocator::instance().nextCardId();
+        Card card(cardId, title);
+        card.setAssignee(users[0].get()); // Atribui ao usuário padrão
+        
+        if (history.execute(*board, std::make_unique<AddCardCommand>(columnName, card))) {
+            std::cout << "Card '" << title << "' (ID: " << cardId << ") added to column '"
+                     << columnName << "' in board '" << boardName << "'.\n";
+        } else {
+            std::cerr << "Error: Could not add card. Check if column exists and is not full.\n";
         }
+    }
+    
+    void cardMove(const CommandArgs& a) {
+        std::string cardId(a[0]);
+        std::string fromCol(a[1]);
+        std::string toCol(a[2]);
+        size_t position = a.size() == 5 ? a.count(4, "position") : Board::END_POSITION;
         
-        if (command == "filter") {
-            return processFilterCommand(args);
+        Board* board = requireBoard(a[3]);
+        if (!board) {
+            return;
         }
         
-        if (command == "tags" && args.size() == 2) {
-            const std::string& boardName = args[1];
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
-            }
-            
-            std::vector<std::string> allTags = board->getAllTags();
-            if (allTags.empty()) {
-                std::cout << "No tags found in board '" << boardName << "'.\n";
-            } else {
-                std::cout << "Tags in board '" << boardName << "':\n";
-                for (const auto& tag : allTags) {
-                    std::cout << "  - " << tag << "\n";
-                }
-            }
-            return true;
+        if (history.execute(*board, std::make_unique<MoveCardCommand>(cardId, fromCol, toCol, position))) {
+            std::cout << "Card '" << cardId << "' moved from '" << fromCol
+                     << "' to '" << toCol << "'.\n";
+        } else {
+            std::cerr << "Error: Could not move card. Check card ID and column names.\n";
         }
+    }
+    
+    void cardReorder(const CommandArgs& a) {
+        std::string columnName(a[1]);
+        std::string cardId(a[2]);
+        std::string anchorId = (a[3] == "end") ? std::string() : std::string(a[3]);
         
-        std::cerr << "Error: Unknown command '" << command << "'. Use 'help' for usage.\n";
-        return true;
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
+        }
+        
+        const Column* column = board->findColumn(columnName);
+        if (!column) {
+            std::cerr << "Error: Column '" << columnName << "' not found.\n";
+            return;
+        }
+        
+        // Converte a âncora em índice final (o card sai antes de ser reinserido)
+        int from = column->indexOfCard(cardId);
+        int anchor = anchorId.empty() ? -1 : column->indexOfCard(anchorId);
+        size_t position = Board::END_POSITION;
+        if (anchor >= 0) {
+            position = static_cast<size_t>(anchor > from ? anchor - 1 : anchor);
+        }
+        
+        if (from >= 0 && (anchorId.empty() || anchor >= 0) &&
+            history.execute(*board, std::make_unique<MoveCardCommand>(cardId, columnName, columnName, position))) {
+            std::cout << "Card '" << cardId << "' reordered in column '" << columnName << "'.\n";
+        } else {
+            std::cerr << "Error: Could not reorder card. Check card IDs.\n";
+        }
     }
     
-private:
-    bool processBoardCommand(const std::vector<std::string>& args) {
-        if (args.size() < 2) {
-            std::cerr << "Error: Board command requires subcommand\n";
-            return true;
+    void cardRemove(const CommandArgs& a) {
+        std::string columnName(a[1]);
+        std::string cardId(a[2]);
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
         }
         
-        const std::string& subcommand = args[1];
+        if (!board->findColumn(columnName)) {
+            std::cerr << "Error: Column '" << columnName << "' not found.\n";
+            return;
+        }
         
-        if (subcommand == "create" && args.size() == 3) {
-            const std::string& name = args[2];
-            auto board = std::make_unique<Board>(name, name);
-            board->attachActivityLog(activityLog.get());
-            boards.push_back(std::move(board));
-            std::cout << "Board '" << name << "' created successfully.\n";
-            return true;
+        if (history.execute(*board, std::make_unique<RemoveCardCommand>(columnName, cardId))) {
+            std::cout << "Card '" << cardId << "' removed from column '" << columnName << "'.\n";
+        } else {
+            std::cerr << "Error: Card '" << cardId << "' not found in column.\n";
         }
+    }
+    
+    void cardTag(const CommandArgs& a, bool add) {
+        std::string cardId(a[1]);
+        std::string tag(a[2]);
         
-        if (subcommand == "list" && args.size() == 2) {
-            listBoards();
-            return true;
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
         }
         
-        if (subcommand == "remove" && args.size() == 3) {
-            const std::string& name = args[2];
-            auto it = std::find_if(boards.begin(), boards.end(),
-                [&name](const std::unique_ptr<Board>& board) {
-                    return board->getName() == name;
-                });
-            
-            if (it != boards.end()) {
-                boards.erase(it);
-                std::cout << "Board '" << name << "' removed successfully.\n";
-            } else {
-                std::cerr << "Error: Board '" << name << "' not found.\n";
-            }
-            return true;
+        if (!history.execute(*board, std::make_unique<TagCardCommand>(cardId, tag, add))) {
+            std::cerr << "Error: Card '" << cardId << "' not found in board.\n";
+            return;
         }
         
-        std::cerr << "Error: Invalid board command. Use 'help' for usage.\n";
-        return true;
+        std::cout << "Tag '" << tag << "' " << (add ? "added to" : "removed from")
+                 << " card '" << cardId << "'.\n";
     }
     
-    bool processColumnCommand(const std::vector<std::string>& args) {
-        if (args.size() < 3) {
-            std::cerr << "Error: Column command requires more arguments\n";
-            return true;
+    void cardBulkMove(const CommandArgs& a) {
+        std::string fromCol(a[1]);
+        std::string toCol(a[2]);
+        std::string tag(a.get(3, ""));
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
         }
         
-        const std::string& subcommand = args[1];
+        const Column* column = board->findColumn(fromCol);
+        if (!column) {
+            std::cerr << "Error: Column '" << fromCol << "' not found.\n";
+            return;
+        }
         
-        if (subcommand == "add" && args.size() >= 4) {
-            const std::string& boardName = args[2];
-            const std::string& columnName = args[3];
-            int wipLimit = -1;
-            if (args.size() >= 5) {
-                try {
-                    wipLimit = std::stoi(args[4]);
-                } catch (const std::exception& e) {
-                    std::cerr << "Error: Invalid WIP limit value. Using no limit (-1).\n";
-                }
+        BoardBatch batch;
+        batch.reserve(column->getCardCount());
+        for (const auto& card : column->getCards()) {
+            if (tag.empty() || card.hasTag(tag)) {
+                batch.moveCard(card.getId(), fromCol, toCol);
             }
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        }
+        
+        if (board->applyBatch(batch)) {
+            std::cout << batch.size() << " card(s) moved from '" << fromCol
+                     << "' to '" << toCol << "'.\n";
+        } else {
+            std::cerr << "Error: Could not move cards. Check column names and WIP limits.\n";
+        }
+    }
+    
+    void cardBulkTag(const CommandArgs& a) {
+        std::string tag(a[1]);
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
+        }
+        
+        // Filtro opcional no formato chave=valor
+        std::string_view filterKey;
+        std::string filterValue;
+        int minPriority = 0;
+        if (a.size() == 3) {
+            size_t eq = a[2].find('=');
+            if (eq != std::string_view::npos) {
+                filterKey = a[2].substr(0, eq);
+                filterValue = a[2].substr(eq + 1);
             }
-            
-            Column column(columnName, wipLimit);
-            if (board->addColumn(column)) {
-                std::cout << "Column '" << columnName << "' added to board '" << boardName << "'";
-                if (wipLimit != -1) {
-                    std::cout << " with WIP limit " << wipLimit;
+            if (filterKey != "tag" && filterKey != "priority" && filterKey != "column") {
+                std::cerr << "Error: Invalid filter '" << a[2]
+                         << "'. Use tag=<t>, priority=<n> or column=<c>.\n";
+                return;
+            }
+            if (filterKey == "priority") {
+                minPriority = CommandArgs::toInteger(filterValue, "priority");
+            }
+        }
+        
+        BoardBatch batch;
+        for (const auto& column : board->getColumns()) {
+            if (filterKey == "column" && column.getName() != filterValue) {
+                continue;
+            }
+            for (const auto& card : column.getCards()) {
+                bool matches = filterKey.empty() || filterKey == "column" ||
+                               (filterKey == "tag" && card.hasTag(filterValue)) ||
+                               (filterKey == "priority" && card.getPriority() >= minPriority);
+                if (matches && !card.hasTag(tag)) {
+                    batch.addTag(card.getId(), tag);
                 }
-                std::cout << ".\n";
-            } else {
-                std::cerr << "Error: Column '" << columnName << "' already exists in board.\n";
             }
-            return true;
         }
         
-        if (subcommand == "list" && args.size() == 3) {
-            const std::string& boardName = args[2];
-            listColumns(boardName);
-            return true;
+        if (board->applyBatch(batch)) {
+            std::cout << "Tag '" << tag << "' added to " << batch.size() << " card(s).\n";
+        } else {
+            std::cerr << "Error: Could not tag cards.\n";
+        }
+    }
+    
+    void filterTag(const CommandArgs& a) {
+        std::string tag(a[1]);
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
         }
         
-        if (subcommand == "remove" && args.size() == 4) {
-            const std::string& boardName = args[2];
-            const std::string& columnName = args[3];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        if (outputFormat != OutputFormat::Text) {
+            CardExporter::Filter filter;
+            filter.tag = tag;
+            cardRows().writeBoard(*board, filter);
+            return;
+        }
+        
+        std::vector<Card*> cards = board->findCardsByTag(tag);
+        if (cards.empty()) {
+            std::cout << "No cards found with tag '" << tag << "'.\n";
+        } else {
+            std::cout << "Cards with tag '" << tag << "':\n";
+            for (const auto* card : cards) {
+                std::cout << "  - [" << card->getId() << "] " << card->getTitle()
+                         << " (Priority: " << card->getPriority() << ")\n";
+            }
+        }
+    }
+    
+    void filterPriority(const CommandArgs& a) {
+        int minPriority = a.integer(1, "priority");
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
+        }
+        
+        if (outputFormat != OutputFormat::Text) {
+            CardExporter::Filter filter;
+            filter.minPriority = minPriority;
+            cardRows().writeBoard(*board, filter);
+            return;
+        }
+        
+        std::vector<Card*> cards = board->filterByPriority(minPriority);
+        if (cards.empty()) {
+            std::cout << "No cards found with priority >= " << minPriority << ".\n";
+        } else {
+            std::cout << "Cards with priority >= " << minPriority << ":\n";
+            for (const auto* card : cards) {
+                std::cout << "  - [" << card->getId() << "] " << card->getTitle()
+                         << " (Priority: " << card->getPriority() << ")\n";
+            }
+        }
+    }
+    
+    /**
+     * @brief Importa cards de um arquivo JSON (array de objetos) em um único lote.
+     *
+     * Cada objeto segue o formato de Card::toJson(); "id" é opcional (gerado
+     * pelo alocador) e "column" define a coluna destino (padrão: defaultColumn).
+     */
+    void importCards(std::string_view boardName, const std::string& filename,
+                     const std::string& defaultColumn) {
+        Board* board = findBoard(boardName);
+        if (!board) {
+            std::cerr << "Error: Board '" << boardName << "' not found.\n";
+            return;
+        }
+        
+        try {
+            BoardBatch batch;
+            std::vector<std::unique_ptr<User>> newUsers; // Só entram em users se o lote for aplicado
+            if (CardImporter::detectFormat(filename) != CardImporter::Format::JsonArray) {
+                importRows(CardImporter::parseFile(filename), defaultColumn, batch, newUsers);
+            } else {
+                importJsonArray(filename, defaultColumn, batch);
             }
             
-            if (board->removeColumn(columnName)) {
-                std::cout << "Column '" << columnName << "' removed from board '" << boardName << "'.\n";
+            if (board->applyBatch(batch)) {
+                for (auto& user : newUsers) {
+                    users.push_back(std::move(user));
+                }
+                std::cout << "Imported " << batch.size() << " card(s) into board '" << boardName << "'.\n";
             } else {
-                std::cerr << "Error: Column '" << columnName << "' not found in board.\n";
+                std::cerr << "Error: Import rejected. Check column names, duplicate IDs and WIP limits.\n";
             }
-            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Error importing cards: " << e.what() << "\n";
         }
-        
-        std::cerr << "Error: Invalid column command. Use 'help' for usage.\n";
-        return true;
     }
     
-    bool processCardCommand(const std::vector<std::string>& args) {
-        if (args.size() < 3) {
-            std::cerr << "Error: Card command requires more arguments\n";
-            return true;
+    void importJsonArray(const std::string& filename, const std::string& defaultColumn, BoardBatch& batch) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open file for reading: " + filename);
         }
         
-        const std::string& subcommand = args[1];
+        json rows;
+        file >> rows;
+        if (!rows.is_array()) {
+            throw std::runtime_error("Import file must contain a JSON array of cards");
+        }
         
-        if (subcommand == "add" && args.size() == 5) {
-            const std::string& boardName = args[2];
-            const std::string& columnName = args[3];
-            const std::string& title = args[4];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        // IDs explícitos primeiro, para que os gerados não colidam com eles
+        auto& idAllocator = CardIdAllocator::instance();
+        std::uint64_t highestId = 0;
+        for (const auto& row : rows) {
+            if (row.contains("id") && row["id"].is_string()) {
+                highestId = std::max(highestId, CardIdAllocator::parseCardId(row["id"].get<std::string>()));
             }
-            
-            // Gera ID único simples para o card
-            std::string cardId = "card_" + std::to_string(++cardIdCounter);
-            Card card(cardId, title);
-            card.setAssignee(users[0].get()); // Atribui ao usuário padrão
-            
-            if (board->addCard(columnName, card)) {
-                std::cout << "Card '" << title << "' (ID: " << cardId << ") added to column '" 
-                         << columnName << "' in board '" << boardName << "'.\n";
-            } else {
-                std::cerr << "Error: Could not add card. Check if column exists and is not full.\n";
+        }
+        idAllocator.reserveThrough(highestId);
+        
+        batch.reserve(rows.size());
+        for (auto& row : rows) {
+            std::string columnName = row.value("column", defaultColumn);
+            if (columnName.empty()) {
+                throw std::runtime_error("Card without column and no default column given");
+            }
+            if (!row.contains("id")) {
+                row["id"] = idAllocator.nextCardId();
+            }
+            Card card = Card::fromJson(row);
+            card.setAssignee(users.empty() ? nullptr : users[0].get());
+            batch.addCard(std::move(columnName), std::move(card));
+        }
+    }
+    
+    // Linhas de CSV/JSON Lines (já analisadas em paralelo) → cards do lote;
+    // responsáveis desconhecidos são criados em newUsers, não em users
+    void importRows(std::vector<CardImporter::Row> rows, const std::string& defaultColumn, BoardBatch& batch,
+                    std::vector<std::unique_ptr<User>>& newUsers) {
+        // IDs explícitos primeiro, para que os gerados não colidam com eles
+        auto& idAllocator = CardIdAllocator::instance();
+        std::uint64_t highestId = 0;
+        for (const auto& row : rows) {
+            if (!row.id.empty()) {
+                highestId = std::max(highestId, CardIdAllocator::parseCardId(row.id));
             }
-            return true;
         }
+        idAllocator.reserveThrough(highestId);
         
-        if (subcommand == "list" && (args.size() == 3 || args.size() == 4)) {
-            const std::string& boardName = args[2];
-            std::string columnName = (args.size() == 4) ? args[3] : "";
-            listCards(boardName, columnName);
-            return true;
+        std::unordered_map<std::string, User*> assignees; // ID ou nome → usuário
+        for (const auto& user : users) {
+            assignees.emplace(user->getName(), user.get());
+            assignees[user->getId()] = user.get();
         }
         
-        if (subcommand == "move" && args.size() == 6) {
-            const std::string& cardId = args[2];
-            const std::string& fromCol = args[3];
-            const std::string& toCol = args[4];
-            const std::string& boardName = args[5];
+        batch.reserve(rows.size());
+        for (auto& row : rows) {
+            std::string columnName = row.column.empty() ? defaultColumn : std::move(row.column);
+            if (columnName.empty()) {
+                throw std::runtime_error("Card '" + row.title + "' without column and no default column given");
+            }
+            if (row.id.empty()) {
+                row.id = idAllocator.nextCardId();
+            }
             
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+            Card card(std::move(row.id), std::move(row.title));
+            card.setDescription(row.description);
+            card.setPriority(row.priority);
+            for (const auto& tag : row.tags) {
+                card.addTag(tag);
             }
             
-            if (board->moveCard(cardId, fromCol, toCol)) {
-                std::cout << "Card '" << cardId << "' moved from '" << fromCol 
-                         << "' to '" << toCol << "'.\n";
-            } else {
-                std::cerr << "Error: Could not move card. Check card ID and column names.\n";
+            User* assignee = users.empty() ? nullptr : users[0].get();
+            if (!row.assignee.empty()) {
+                auto known = assignees.find(row.assignee);
+                if (known == assignees.end()) {
+                    newUsers.push_back(std::make_unique<User>(row.assignee, row.assignee, ""));
+                    known = assignees.emplace(row.assignee, newUsers.back().get()).first;
+                }
+                assignee = known->second;
             }
-            return true;
+            card.setAssignee(assignee);
+            batch.addCard(std::move(columnName), std::move(card));
+        }
+    }
+    
+    /**
+     * @brief Associa o processo ao workspace salvo/carregado.
+     *
+     * IDs de cards passam a ser arrendados de "<arquivo>.ids", evitando
+     * colisões com outros processos (CLI ou GUI) no mesmo workspace, e o
+     * histórico antigo passa a ser gravado em "<arquivo>.log.d/".
+     */
+    void attachWorkspace(const std::string& filename, Compression::Codec codec) {
+        CardIdAllocator::instance().attachLeaseFile(filename + ".ids");
+        attachActivityTrail(filename);
+        activityLog->setSegmentCodec(codec); // Segmentos selados seguem o workspace
+    }
+    
+    /**
+     * @brief Anexa "<arquivo>.log.d/" ao activity log, se nenhuma outra sessão o detém.
+     *
+     * Sem o lease o histórico desta sessão fica só em memória (as entradas
+     * mais antigas são descartadas) e a trilha da outra sessão não é tocada.
+     */
+    void attachActivityTrail(const std::string& filename) {
+        if (!activityLog->attachSpillDirectory(filename + ".log.d")) {
+            std::cerr << "Warning: Activity history of '" << filename
+                      << "' is in use by another session; older entries of this session are not kept on disk.\n";
+        }
+    }
+    
+    Board* findBoard(std::string_view name) {
+        auto it = std::find_if(boards.begin(), boards.end(),
+            [&name](const std::unique_ptr<Board>& board) {
+                return board->getName() == name;
+            });
+        return (it != boards.end()) ? it->get() : nullptr;
+    }
+    
+    void listBoards() {
+        if (boards.empty()) {
+            std::cout << "No boards found.\n";
+            return;
         }
         
-        if (subcommand == "remove" && args.size() == 5) {
-            const std::string& boardName = args[2];
-            const std::string& columnName = args[3];
-            const std::string& cardId = args[4];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        std::cout << "Boards:\n";
+        for (const auto& board : boards) {
+            std::cout << "  - " << board->getName() << " (ID: " << board->getId() 
+                     << ", Columns: " << board->getColumns().size() << ")\n";
+        }
+    }
+    
+    void listColumns(std::string_view boardName) {
+        Board* board = findBoard(boardName);
+        if (!board) {
+            std::cerr << "Error: Board '" << boardName << "' not found.\n";
+            return;
+        }
+        
+        const auto& columns = board->getColumns();
+        if (columns.empty()) {
+            std::cout << "No columns found in board '" << boardName << "'.\n";
+            return;
+        }
+        
+        std::cout << "Columns in board '" << boardName << "':\n";
+        for (const auto& column : columns) {
+            std::cout << "  - " << column.getName() << " (Cards: " << column.getCardCount();
+            if (column.getWipLimit() != -1) {
+                std::cout << "/" << column.getWipLimit();
             }
-            
-            Column* column = board->findColumn(columnName);
+            std::cout << ")\n";
+        }
+    }
+    
+    void listCards(std::string_view boardName, const std::string& columnName = "") {
+        Board* board = findBoard(boardName);
+        if (!board) {
+            std::cerr << "Error: Board '" << boardName << "' not found.\n";
+            return;
+        }
+        
+        if (!columnName.empty()) {
+            // Lista cards de uma coluna específica
+            const Column* column = board->findColumn(columnName);
             if (!column) {
                 std::cerr << "Error: Column '" << columnName << "' not found.\n";
-                return true;
+                return;
             }
             
-            if (column->removeCard(cardId)) {
-                std::cout << "Card '" << cardId << "' removed from column '" << columnName << "'.\n";
-                if (activityLog) {
-                    activityLog->record("Card '" + cardId + "' removed from column '" + columnName + "' in board '" + boardName + "'");
+            const auto& cards = column->getCards();
+            if (outputFormat != OutputFormat::Text) {
+                CardExporter out = cardRows();
+                for (const auto& card : cards) {
+                    out.write(boardName, columnName, card);
                 }
+                return;
+            }
+            if (cards.empty()) {
+                std::cout << "No cards found in column '" << columnName << "'.\n";
+                return;
+            }
+            
+            std::cout << "Cards in column '" << columnName << "':\n";
+            for (const auto& card : cards) {
+                std::cout << "  - " << card.getTitle() << " (ID: " << card.getId() 
+                         << ", Priority: " << card.getPriority() << ")\n";
+            }
+        } else {
+            // Lista cards de todas as colunas
+            if (outputFormat == OutputFormat::Text) {
+                std::cout << "All cards in board '" << boardName << "':\n";
+            }
+            printBoardCards(*board);
+        }
+    }
+    
+    void printBoardCards(const Board& board) {
+        if (outputFormat != OutputFormat::Text) {
+            cardRows().writeBoard(board);
+            return;
+        }
+        
+        for (const auto& column : board.getColumns()) {
+            std::cout << "\n  Column: " << column.getName() << "\n";
+            const auto& cards = column.getCards();
+            if (cards.empty()) {
+                std::cout << "    (no cards)\n";
             } else {
-                std::cerr << "Error: Card '" << cardId << "' not found in column.\n";
+                for (const auto& card : cards) {
+                    std::cout << "    - " << card.getTitle() << " (ID: " << card.getId() 
+                             << ", Priority: " << card.getPriority() << ")\n";
+                }
             }
-            return true;
+        }
+    }
+    
+    // Arquivo frio fica ao lado do workspace (como o spill do activity log)
+    bool requireWorkspace() {
+        if (baseFile.empty()) {
+            std::cerr << "Error: Save or load a workspace first (the archive is kept next to it).\n";
+            return false;
+        }
+        return true;
+    }
+    
+    // "30d", "12h", "2w"
+    static std::chrono::hours parseAge(std::string_view text) {
+        int hoursPerUnit = 0;
+        switch (text.empty() ? '\0' : text.back()) {
+            case 'h': hoursPerUnit = 1; break;
+            case 'd': hoursPerUnit = 24; break;
+            case 'w': hoursPerUnit = 24 * 7; break;
+            default:
+                throw CommandArgs::Error("Invalid age '" + std::string(text) + "' (use <n>d, <n>h or <n>w).");
+        }
+        int amount = CommandArgs::toInteger(text.substr(0, text.size() - 1), "age");
+        if (amount < 0) {
+            throw CommandArgs::Error("Invalid age '" + std::string(text) + "' (must not be negative).");
+        }
+        return std::chrono::hours(static_cast<long long>(amount) * hoursPerUnit);
+    }
+    
+    void archiveCards(const CommandArgs& a) {
+        std::string columnName(a[1]);
+        std::chrono::hours minAge(0);
+        if (a.size() > 2) {
+            if (a[2] != "--older-than" || a.size() != 4) {
+                throw CommandArgs::Error("Usage: archive <board> <column> [--older-than <n>d|h|w]");
+            }
+            minAge = parseAge(a[3]);
+        }
+        if (!requireWorkspace()) {
+            return;
+        }
+        Board* board = requireBoard(a[0]);
+        if (!board) {
+            return;
+        }
+        const Column* column = board->findColumn(columnName);
+        if (!column) {
+            std::cerr << "Error: Column '" << columnName << "' not found.\n";
+            return;
         }
         
-        if (subcommand == "tag" && args.size() == 5) {
-            const std::string& boardName = args[2];
-            const std::string& cardId = args[3];
-            const std::string& tag = args[4];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        // Idade desde a chegada do card na coluna (FlowMetrics); sem esse
+        // histórico (estado salvo antigo), desde a última alteração do card
+        auto cutoff = std::chrono::system_clock::now() - minAge;
+        std::vector<Card> selected;
+        std::unordered_set<std::string> ids;
+        for (const auto& card : column->getCards()) {
+            auto entered = flowMetrics.enteredColumn(board->getName(), card.getId());
+            if (entered.value_or(card.getUpdatedAt()) <= cutoff) {
+                selected.push_back(card);
+                ids.insert(card.getId());
             }
-            
-            Card* card = findCardInBoard(board, cardId);
-            if (!card) {
-                std::cerr << "Error: Card '" << cardId << "' not found in board.\n";
-                return true;
+        }
+        if (selected.empty()) {
+            std::cout << "No cards to archive in '" << columnName << "'.\n";
+            return;
+        }
+        
+        // Grava antes de retirar do board: falha no arquivo não perde cards
+        CardArchive archive(baseFile + ".archive.d");
+        try {
+            archive.append(board->getName(), columnName, selected);
+        } catch (const std::exception& e) {
+            std::cerr << "Error archiving cards: " << e.what() << "\n";
+            return;
+        }
+        std::vector<Card> extracted;
+        extracted.reserve(selected.size());
+        board->extractCards(columnName, ids, extracted);
+        history.clear(); // Comandos guardados podem referir os cards retirados
+        
+        // O arquivo já tem os cards; o workspace só deixa de tê-los no próximo
+        // save. Arquivar de novo antes disso só acrescenta um registro mais recente
+        std::cout << "Archived " << extracted.size() << " card(s) from '" << columnName
+                  << "' to '" << archive.directory() << "'.\n";
+        std::cout << "  Save the workspace to remove them from '" << baseFile << "'.\n";
+    }
+    
+    void archiveGet(const std::string& cardId) {
+        if (!requireWorkspace()) {
+            return;
+        }
+        std::optional<CardArchive::Record> record;
+        try {
+            record = CardArchive(baseFile + ".archive.d").find(cardId);
+        } catch (const std::exception& e) {
+            std::cerr << "Error reading archive: " << e.what() << "\n";
+            return;
+        }
+        if (!record) {
+            std::cerr << "Error: Card '" << cardId << "' not found in archive.\n";
+            return;
+        }
+        if (outputFormat != OutputFormat::Text) {
+            cardRows().write(record->board, record->column, record->card);
+            return;
+        }
+        
+        const Card& card = record->card;
+        std::cout << "Card '" << card.getTitle() << "' (ID: " << card.getId()
+                  << ", Priority: " << card.getPriority() << ")\n";
+        std::cout << "  Archived from '" << record->board << "/" << record->column << "' on "
+                  << formatTimestamp(record->archivedAt) << "\n";
+        if (!card.getDescription().empty()) {
+            std::cout << "  Description: " << card.getDescription() << "\n";
+        }
+        if (!card.getTags().empty()) {
+            std::cout << "  Tags:";
+            for (const auto& tag : card.getTags()) {
+                std::cout << " " << tag;
             }
-            
-            card->addTag(tag);
-            std::cout << "Tag '" << tag << "' added to card '" << cardId << "'.\n";
-            return true;
+            std::cout << "\n";
+        }
+    }
+    
+    void archiveSearch(std::string_view text, size_t limit) {
+        if (!requireWorkspace()) {
+            return;
+        }
+        std::vector<CardArchive::Record> records;
+        try {
+            records = CardArchive(baseFile + ".archive.d").search(text, limit);
+        } catch (const std::exception& e) {
+            std::cerr << "Error reading archive: " << e.what() << "\n";
+            return;
+        }
+        if (outputFormat != OutputFormat::Text) {
+            CardExporter out = cardRows();
+            for (const auto& record : records) {
+                out.write(record.board, record.column, record.card);
+            }
+            return;
+        }
+        if (records.empty()) {
+            std::cout << "No archived cards match '" << text << "'.\n";
+            return;
+        }
+        std::cout << "Archived cards matching '" << text << "':\n";
+        for (const auto& record : records) {
+            std::cout << "  - " << record.card.getTitle() << " (ID: " << record.card.getId()
+                      << ", Priority: " << record.card.getPriority() << ") ["
+                      << record.board << "/" << record.column << "]\n";
+        }
+    }
+    
+    void diffWorkspaces(const CommandArgs& a) {
+        bool compress = a.size() > 2 && a[a.size() - 1] == "--compress";
+        size_t operands = a.size() - (compress ? 1 : 0);
+        if (operands > 3 || (compress && operands != 3)) {
+            throw CommandArgs::Error("Usage: diff <a> <b> [delta_file] [--compress]");
+        }
+        if (operands == 2 && outputFormat == OutputFormat::Csv) {
+            throw CommandArgs::Error("diff writes text or JSON Lines (use --format jsonl).");
         }
+        std::string fromFile(a[0]);
+        std::string toFile(a[1]);
         
-        if (subcommand == "untag" && args.size() == 5) {
-            const std::string& boardName = args[2];
-            const std::string& cardId = args[3];
-            const std::string& tag = args[4];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+        try {
+            if (operands == 3) {
+                std::string deltaFile(a[2]);
+                Compression::Codec codec = compress ? Compression::Codec::Gzip : Compression::forFilename(deltaFile);
+                CompressedOFStream out(deltaFile, codec);
+                if (!out.is_open()) {
+                    throw std::runtime_error("Could not open file for writing: " + deltaFile);
+                }
+                WorkspaceDiff::Summary summary = WorkspaceDiff::diff(fromFile, toFile,
+                    [&out](const json& op) { out << op.dump() << '\n'; });
+                out.close();
+                if (!out) {
+                    throw std::runtime_error("Could not write file: " + deltaFile);
+                }
+                std::cout << "✓ Delta written to '" << deltaFile << "' (" << summary.operations()
+                          << " operation(s), " << std::filesystem::file_size(deltaFile) << " bytes).\n";
+                return;
             }
             
-            Card* card = findCardInBoard(board, cardId);
-            if (!card) {
-                std::cerr << "Error: Card '" << cardId << "' not found in board.\n";
-                return true;
+            if (outputFormat == OutputFormat::Jsonl) {
+                WorkspaceDiff::diff(fromFile, toFile, [](const json& op) { std::cout << op.dump() << '\n'; });
+                return;
             }
-            
-            card->removeTag(tag);
-            std::cout << "Tag '" << tag << "' removed from card '" << cardId << "'.\n";
-            return true;
+            WorkspaceDiff::Summary summary = WorkspaceDiff::diff(fromFile, toFile, printDiffOperation);
+            if (summary.operations() == 0) {
+                std::cout << "No differences.\n";
+                return;
+            }
+            std::cout << "Cards: +" << summary.cardsAdded << " ~" << summary.cardsChanged << " -" << summary.cardsRemoved
+                      << " | Columns: +" << summary.columnsAdded << " ~" << summary.columnsChanged << " -"
+                      << summary.columnsRemoved << " | Boards: +" << summary.boardsAdded << " -"
+                      << summary.boardsRemoved << "\n";
+        } catch (const std::exception& e) {
+            std::cerr << "Error computing diff: " << e.what() << "\n";
         }
-        
-        std::cerr << "Error: Invalid card command. Use 'help' for usage.\n";
-        return true;
     }
     
-    bool processFilterCommand(const std::vector<std::string>& args) {
-        if (args.size() < 3) {
-            std::cerr << "Error: Filter command requires more arguments\n";
-            return true;
-        }
-        
-        const std::string& filterType = args[1];
-        
-        if (filterType == "tag" && args.size() == 4) {
-            const std::string& boardName = args[2];
-            const std::string& tag = args[3];
-            
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+    // Uma linha por operação; cabeçalho, rodapé e corpos de descrição ficam de fora
+    static void printDiffOperation(const json& op) {
+        const std::string& name = op["op"].get_ref<const std::string&>();
+        std::string where = op.value("board", "") + "/" + op.value("column", "");
+        if (name == "addBoard" || name == "removeBoard") {
+            std::cout << (name == "addBoard" ? "+" : "-") << " board '" << op["board"].get<std::string>() << "'\n";
+        } else if (name == "addColumn" || name == "updateColumn") {
+            std::cout << (name == "addColumn" ? "+" : "~") << " column " << where << " (position "
+                      << op["position"].get<size_t>();
+            int wipLimit = op["wipLimit"].get<int>();
+            if (wipLimit >= 0) {
+                std::cout << ", WIP " << wipLimit;
             }
-            
-            std::vector<Card*> cards = board->findCardsByTag(tag);
-            if (cards.empty()) {
-                std::cout << "No cards found with tag '" << tag << "'.\n";
-            } else {
-                std::cout << "Cards with tag '" << tag << "':\n";
-                for (const auto* card : cards) {
-                    std::cout << "  - [" << card->getId() << "] " << card->getTitle() 
-                             << " (Priority: " << card->getPriority() << ")\n";
+            std::cout << ")\n";
+        } else if (name == "removeColumn") {
+            std::cout << "- column " << where << "\n";
+        } else if (name == "putCard") {
+            const json& card = op["card"];
+            std::cout << (op.contains("from") ? "~" : "+") << " card " << card.value("id", "") << " '"
+                      << card.value("title", "") << "' in " << where;
+            if (op.contains("from")) {
+                std::string from = op["from"].value("board", "") + "/" + op["from"].value("column", "");
+                if (from != where) {
+                    std::cout << " (from " << from << ")";
                 }
             }
-            return true;
+            std::cout << "\n";
+        } else if (name == "removeCard") {
+            std::cout << "- card " << op["card"].get<std::string>() << " (" << where << ")\n";
         }
-        
-        if (filterType == "priority" && args.size() == 4) {
-            const std::string& boardName = args[2];
-            int minPriority = std::stoi(args[3]);
+    }
+    
+    void patchWorkspace(const std::string& filename) {
+        try {
+            WorkspaceDiff::PatchResult result = WorkspaceDiff::apply(filename, boards, [this](Board& board) {
+                board.attachActivityLog(activityLog.get());
+                board.attachFlowMetrics(&flowMetrics);
+                board.checkpoint();
+            });
+            history.clear(); // Comandos guardados referem o estado anterior ao patch
             
-            Board* board = findBoard(boardName);
-            if (!board) {
-                std::cerr << "Error: Board '" << boardName << "' not found.\n";
-                return true;
+            std::cout << "✓ Applied " << result.applied.operations() << " operation(s) from '" << filename << "'.\n";
+            for (const auto& skipped : result.skipped) {
+                std::cout << "  Skipped: " << skipped << "\n";
             }
-            
-            std::vector<Card*> cards = board->filterByPriority(minPriority);
-            if (cards.empty()) {
-                std::cout << "No cards found with priority >= " << minPriority << ".\n";
-            } else {
-                std::cout << "Cards with priority >= " << minPriority << ":\n";
-                for (const auto* card : cards) {
-                    std::cout << "  - [" << card->getId() << "] " << card->getTitle() 
-                             << " (Priority: " << card->getPriority() << ")\n";
-                }
+            if (activityLog) {
+                activityLog->record("Patch '" + filename + "' applied");
             }
-            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Error applying patch: " << e.what() << "\n";
         }
-        
-        std::cerr << "Error: Invalid filter command. Use 'help' for usage.\n";
-        return true;
     }
     
-    Board* findBoard(const std::string& name) {
-        auto it = std::find_if(boards.begin(), boards.end(),
-            [&name](const std::unique_ptr<Board>& board) {
-                return board->getName() == name;
-            });
-        return (it != boards.end()) ? it->get() : nullptr;
+    // Linhas de card no formato do comando (jsonl/csv), campos padrão
+    CardExporter cardRows() {
+        return CardExporter(std::cout, outputFormat == OutputFormat::Csv ? CardExporter::Format::Csv
+                                                                         : CardExporter::Format::JsonLines,
+                            CardExporter::defaultFields());
     }
     
-    Card* findCardInBoard(Board* board, const std::string& cardId) {
-        if (!board) return nullptr;
-        
-        for (const auto& column : board->getColumns()) {
-            for (auto& card : column.getCards()) {
-                if (card.getId() == cardId) {
-                    return const_cast<Card*>(&card);
+    // Exportação com projeção e filtros; stdout ou arquivo, memória constante
+    void exportCards(const CommandArgs& a) {
+        std::vector<CardExporter::Field> fields = CardExporter::defaultFields();
+        CardExporter::Filter filter;
+        std::string output;
+        for (size_t i = 1; i < a.size(); ++i) {
+            std::string_view option = a[i];
+            size_t eq = option.find('=');
+            if ((option == "--fields" || option == "--output") && i + 1 < a.size()) {
+                if (option == "--output") {
+                    output = a[++i];
+                    continue;
+                }
+                try {
+                    fields = CardExporter::parseFields(a[++i]);
+                } catch (const std::invalid_argument& e) {
+                    throw CommandArgs::Error(std::string(e.what()) + ".");
                 }
+            } else if (option.substr(0, eq) == "column" && eq != std::string_view::npos) {
+                filter.column = option.substr(eq + 1);
+            } else if (option.substr(0, eq) == "tag" && eq != std::string_view::npos) {
+                filter.tag = option.substr(eq + 1);
+            } else if (option.substr(0, eq) == "priority" && eq != std::string_view::npos) {
+                filter.minPriority = CommandArgs::toInteger(option.substr(eq + 1), "priority");
+            } else {
+                throw CommandArgs::Error("Invalid export option '" + std::string(option) + "'.");
             }
         }
-        return nullptr;
-    }
-    
-    void listBoards() {
-        if (boards.empty()) {
-            std::cout << "No boards found.\n";
+        
+        Board* board = requireBoard(a[0]);
+        if (!board) {
             return;
         }
         
-        std::cout << "Boards:\n";
-        for (const auto& board : boards) {
-            std::cout << "  - " << board->getName() << " (ID: " << board->getId() 
-                     << ", Columns: " << board->getColumns().size() << ")\n";
+        CardExporter::Format format = outputFormat == OutputFormat::Jsonl ? CardExporter::Format::JsonLines
+                                                                         : CardExporter::Format::Csv;
+        if (output.empty()) {
+            CardExporter(std::cout, format, std::move(fields)).writeBoard(*board, filter);
+            return;
+        }
+        
+        std::ofstream file(output, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not open file for writing: " << output << "\n";
+            return;
         }
+        CardExporter out(file, format, std::move(fields));
+        size_t written = out.writeBoard(*board, filter);
+        out.flush();
+        if (!file) {
+            std::cerr << "Error: Could not write to file: " << output << "\n";
+            return;
+        }
+        std::cout << "Exported " << written << " card(s) to '" << output << "'.\n";
     }
     
-    void listColumns(const std::string& boardName) {
+    void showMetrics(std::string_view boardName) {
         Board* board = findBoard(boardName);
         if (!board) {
             std::cerr << "Error: Board '" << boardName << "' not found.\n";
             return;
         }
         
-        const auto& columns = board->getColumns();
-        if (columns.empty()) {
-            std::cout << "No columns found in board '" << boardName << "'.\n";
+        FlowMetrics::Report report = flowMetrics.report(*board);
+        std::cout << "Flow metrics for board '" << boardName << "' (" << report.completed
+                 << " completed):\n";
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "  Lead time  (h) p50/p85/p95: " << report.leadHours[0] << " / "
+                 << report.leadHours[1] << " / " << report.leadHours[2] << "\n";
+        std::cout << "  Cycle time (h) p50/p85/p95: " << report.cycleHours[0] << " / "
+                 << report.cycleHours[1] << " / " << report.cycleHours[2] << "\n";
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout << std::setprecision(6);
+        
+        if (report.cfd.empty()) {
+            std::cout << "  No flow recorded yet.\n";
             return;
         }
         
-        std::cout << "Columns in board '" << boardName << "':\n";
-        for (const auto& column : columns) {
-            std::cout << "  - " << column.getName() << " (Cards: " << column.getCardCount();
-            if (column.getWipLimit() != -1) {
-                std::cout << "/" << column.getWipLimit();
+        // Uma linha por dia (UTC): concluídos no dia e cards por coluna
+        std::cout << "\n  " << std::left << std::setw(12) << "Day" << std::setw(6) << "Done";
+        for (const auto& column : report.columns) {
+            std::cout << " " << std::setw(std::max<int>(static_cast<int>(column.size()), 4)) << column;
+        }
+        std::cout << std::right << "\n";
+        for (size_t day = 0; day < report.cfd.size(); ++day) {
+            std::cout << "  " << std::left << std::setw(12)
+                     << formatDay(report.firstDay + static_cast<long long>(day))
+                     << std::setw(6) << report.throughput[day];
+            for (size_t c = 0; c < report.columns.size(); ++c) {
+                std::cout << " " << std::setw(std::max<int>(static_cast<int>(report.columns[c].size()), 4))
+                         << report.cfd[day][c];
             }
-            std::cout << ")\n";
+            std::cout << std::right << "\n";
         }
     }
     
-    void listCards(const std::string& boardName, const std::string& columnName = "") {
-        Board* board = findBoard(boardName);
-        if (!board) {
-            std::cerr << "Error: Board '" << boardName << "' not found.\n";
+    static std::string formatDay(long long day) {
+        std::time_t time = static_cast<std::time_t>(day * 86400);
+        std::ostringstream out;
+        out << std::put_time(std::gmtime(&time), "%Y-%m-%d");
+        return out.str();
+    }
+    
+    void showHistory() {
+        if (outputFormat != OutputFormat::Text) {
+            printEvents(activityLog->events());
+            return;
+        }
+        if (activityLog->size() == 0) {
+            std::cout << "No activity recorded.\n";
             return;
         }
         
-        const auto& columns = board->getColumns();
+        std::cout << "Activity History:\n";
+        printEvents(activityLog->events());
         
-        if (!columnName.empty()) {
-            // Lista cards de uma coluna específica
-            const Column* column = board->findColumn(columnName);
-            if (!column) {
-                std::cerr << "Error: Column '" << columnName << "' not found.\n";
-                return;
+        size_t older = activityLog->totalSize() - activityLog->size();
+        if (older > 0) {
+            std::cout << "  (" << older << " older entries on disk; use 'history --page <n>')\n";
+        }
+    }
+    
+    void showHistoryPage(size_t page) {
+        const size_t pageSize = 50;
+        size_t total = activityLog->totalSize();
+        size_t pages = (total + pageSize - 1) / pageSize;
+        if (page == 0 || page > pages) {
+            std::cerr << "Error: Page " << page << " out of range (1-" << pages << ").\n";
+            return;
+        }
+        
+        if (outputFormat == OutputFormat::Text) {
+            std::cout << "Activity History (page " << page << "/" << pages << ", "
+                     << total << " entries):\n";
+        }
+        printRecords(activityLog->records((page - 1) * pageSize, pageSize));
+    }
+    
+    void showHistoryLast(size_t count) {
+        size_t total = activityLog->totalSize();
+        count = std::min(count, total);
+        if (outputFormat == OutputFormat::Text) {
+            std::cout << "Activity History (last " << count << " of " << total << " entries):\n";
+        }
+        
+        // Só vai ao disco se o pedido passar do que está em memória
+        if (count <= activityLog->size()) {
+            printEvents(activityLog->last(count));
+        } else {
+            printRecords(activityLog->records(total - count, count));
+        }
+    }
+    
+    void showHistorySince(std::chrono::system_clock::time_point since) {
+        size_t offset = activityLog->lowerBound(since);
+        size_t total = activityLog->totalSize();
+        size_t onDisk = total - activityLog->size();
+        if (outputFormat == OutputFormat::Text) {
+            std::cout << "Activity History (" << total - offset << " entries since "
+                     << formatTimestamp(since) << "):\n";
+        }
+        
+        if (offset >= onDisk) {
+            printEvents(activityLog->between(since, std::chrono::system_clock::time_point::max()));
+        } else {
+            printRecords(activityLog->records(offset, total - offset));
+        }
+    }
+    
+    // Aceita YYYY-MM-DD, YYYY-MM-DDTHH:MM ou YYYY-MM-DDTHH:MM:SS (hora local)
+    static bool parseTimestamp(std::string_view text, std::chrono::system_clock::time_point& result) {
+        for (const char* format : {"%Y-%m-%dT%H:%M:%S", "%Y-%m-%dT%H:%M", "%Y-%m-%d"}) {
+            std::tm tm = {};
+            std::istringstream stream{std::string(text)};
+            stream >> std::get_time(&tm, format);
+            if (stream.fail() || stream.peek() != std::char_traits<char>::eof()) {
+                continue;
             }
-            
-            const auto& cards = column->getCards();
-            if (cards.empty()) {
-                std::cout << "No cards found in column '" << columnName << "'.\n";
-                return;
+            tm.tm_isdst = -1;
+            std::time_t time = std::mktime(&tm);
+            if (time == -1) {
+                return false;
             }
-            
-            std::cout << "Cards in column '" << columnName << "':\n";
-            for (const auto& card : cards) {
-                std::cout << "  - " << card.getTitle() << " (ID: " << card.getId() 
-                         << ", Priority: " << card.getPriority() << ")\n";
+            result = std::chrono::system_clock::from_time_t(time);
+            return true;
+        }
+        return false;
+    }
+    
+    static std::string formatTimestamp(std::chrono::system_clock::time_point timestamp) {
+        auto time = std::chrono::system_clock::to_time_t(timestamp);
+        std::ostringstream out;
+        out << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
+        return out.str();
+    }
+    
+    /**
+     * @struct EventRow
+     * @brief Evento do histórico já com nomes resolvidos (memória ou disco).
+     */
+    struct EventRow {
+        std::chrono::system_clock::time_point timestamp;
+        std::uint64_t sequence { 0 };
+        std::string type;
+        std::string board;
+        std::string column;
+        std::string card;
+        std::string target;
+        bool hasCounts { false };                  // Só BatchApplied
+        std::array<std::uint32_t, 3> counts {};
+        std::string message;
+        json payload;
+    };
+    
+    // Mesmo esquema (campos tipados, como no activityLog salvo) venha o
+    // trecho do buffer em memória ou dos segmentos em disco
+    template <typename Source, typename ToRow>
+    void printEventRows(const Source& source, ToRow toRow) {
+        if (outputFormat == OutputFormat::Csv) {
+            CsvWriter out(std::cout);
+            for (const char* header : {"timestamp", "sequence", "type", "board", "column", "card", "target",
+                                       "added", "moved", "tagChanges", "message", "payload"}) {
+                out.field(header);
             }
-        } else {
-            // Lista cards de todas as colunas
-            std::cout << "All cards in board '" << boardName << "':\n";
-            for (const auto& column : columns) {
-                std::cout << "\n  Column: " << column.getName() << "\n";
-                const auto& cards = column.getCards();
-                if (cards.empty()) {
-                    std::cout << "    (no cards)\n";
+            out.endRow();
+            for (const auto& item : source) {
+                EventRow row = toRow(item);
+                out.field(row.timestamp).field(row.sequence).field(row.type).field(row.board)
+                   .field(row.column).field(row.card).field(row.target);
+                if (row.hasCounts) {
+                    out.field(row.counts[0]).field(row.counts[1]).field(row.counts[2]);
                 } else {
-                    for (const auto& card : cards) {
-                        std::cout << "    - " << card.getTitle() << " (ID: " << card.getId() 
-                                 << ", Priority: " << card.getPriority() << ")\n";
-                    }
+                    out.field("").field("").field("");
                 }
+                out.field(row.message).field(row.payload.is_null() ? std::string() : row.payload.dump()).endRow();
             }
+            return;
         }
-    }
-    
-    void showHistory() {
-        auto entries = activityLog->all();
-        if (entries.empty()) {
-            std::cout << "No activity recorded.\n";
+        if (outputFormat == OutputFormat::Jsonl) {
+            JsonLinesWriter out(std::cout);
+            for (const auto& item : source) {
+                EventRow row = toRow(item);
+                out.beginObject().field("timestamp", row.timestamp).field("sequence", row.sequence)
+                   .field("type", row.type);
+                // Mesmas chaves opcionais de ActivityLog::toJson()
+                const std::pair<const char*, const std::string*> names[] = {
+                    {"board", &row.board}, {"column", &row.column}, {"card", &row.card}, {"target", &row.target}
+                };
+                for (const auto& name : names) {
+                    if (!name.second->empty()) {
+                        out.field(name.first, *name.second);
+                    }
+                }
+                if (row.hasCounts) {
+                    out.field("added", row.counts[0]).field("moved", row.counts[1]).field("tagChanges", row.counts[2]);
+                }
+                out.field("message", row.message);
+                if (!row.payload.is_null()) {
+                    out.raw("payload", row.payload.dump());
+                }
+                out.endObject();
+            }
             return;
         }
-        
-        std::cout << "Activity History:\n";
-        for (const auto& entry : entries) {
-            auto time = std::chrono::system_clock::to_time_t(entry.timestamp);
-            std::cout << "  [" << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S") 
-                     << "] " << entry.message << "\n";
+        for (const auto& item : source) {
+            EventRow row = toRow(item);
+            std::cout << "  [" << formatTimestamp(row.timestamp) << "] " << row.message << "\n";
         }
     }
     
-    void saveState(const std::string& filename) {
+    // Percorre o buffer sem copiar; mensagens são montadas uma a uma
+    void printEvents(const ActivityLog::Range& events) {
+        bool typed = outputFormat != OutputFormat::Text;
+        printEventRows(events, [this, typed](const ActivityEvent& event) {
+            EventRow row;
+            row.timestamp = event.timestamp;
+            row.message = activityLog->format(event);
+            if (typed) {
+                row.sequence = event.sequence;
+                row.type = ActivityLog::typeName(event.type);
+                row.board = activityLog->name(event.board);
+                row.column = activityLog->name(event.column);
+                row.card = activityLog->name(event.card);
+                row.target = activityLog->name(event.target);
+                row.hasCounts = event.type == ActivityType::BatchApplied;
+                row.counts = event.counts;
+                row.payload = activityLog->payload(event);
+            }
+            return row;
+        });
+    }
+    
+    // Entradas de records() (formato de ActivityLog::toJson(), inclusive as do disco)
+    void printRecords(const std::vector<json>& records) {
+        printEventRows(records, [](const json& record) {
+            EventRow row;
+            row.timestamp = std::chrono::system_clock::time_point(
+                std::chrono::milliseconds(record.value("timestamp", 0LL)));
+            row.sequence = record.value("sequence", std::uint64_t(0));
+            row.type = record.value("type", std::string(ActivityLog::typeName(ActivityType::Custom)));
+            row.board = record.value("board", std::string());
+            row.column = record.value("column", std::string());
+            row.card = record.value("card", std::string());
+            row.target = record.value("target", std::string());
+            if (record.contains("counts") && record["counts"].is_array() && record["counts"].size() == 3) {
+                row.hasCounts = true;
+                row.counts = record["counts"].get<std::array<std::uint32_t, 3>>();
+            }
+            row.message = record.value("message", std::string());
+            row.payload = record.value("payload", json());
+            return row;
+        });
+    }
+    
+    // gzip pela extensão, por --compress ou porque o arquivo já era comprimido
+    bool saveState(const std::string& filename, bool compress = false) {
         try {
+            Compression::Codec codec = Compression::forFilename(filename);
+            if (compress || (filename == baseFile && baseCodec != Compression::Codec::None)) {
+                codec = Compression::Codec::Gzip;
+            }
+            
             json state;
             
-            // Serializa todos os boards
+            // Serializa todos os boards; checkpoint no log quando o replay ficaria longo
             json boardsArray = json::array();
             for (const auto& board : boards) {
+                if (activityLog &&
+                    activityLog->eventsSinceCheckpoint(board->getName()) >= BoardReplay::CHECKPOINT_INTERVAL) {
+                    board->checkpoint();
+                }
                 boardsArray.push_back(board->toJson());
             }
+            boardsArray = mergeWithDisk(filename, boardsArray);
             state["boards"] = boardsArray;
             
             // Serializa todos os usuários
@@ -589,37 +1498,86 @@ private:
             if (activityLog) {
                 state["activityLog"] = activityLog->toJson();
             }
+            state["flowMetrics"] = flowMetrics.toJson();
             
             // Salva metadata
             state["metadata"] = {
                 {"version", "1.0"},
-                {"cardIdCounter", cardIdCounter}
+                {"cardIdCounter", CardIdAllocator::instance().highestIssued()}
             };
+            DescriptionStore::pack(state); // Descrições repetidas gravadas uma vez
             
-            // Escreve arquivo JSON com indentação
-            std::ofstream file(filename);
+            // Escreve arquivo JSON com indentação direto no stream (sem string intermediária)
+            CompressedOFStream file(filename, codec);
             if (!file.is_open()) {
                 throw std::runtime_error("Could not open file for writing: " + filename);
             }
             
-            file << state.dump(2); // Pretty print com indentação de 2 espaços
+            file << std::setw(2) << state; // Pretty print com indentação de 2 espaços
             file.close();
+            if (!file) {
+                throw std::runtime_error("Could not write file: " + filename);
+            }
+            baseBoards = boardsArray;
+            baseFile = filename;
+            baseCodec = codec;
+            
+            attachWorkspace(filename, codec);
+            activityLog->flush();
             
-            std::cout << "✓ State saved to '" << filename << "' (JSON format).\n";
-            std::cout << "  File size: " << state.dump(2).size() << " bytes\n";
+            std::cout << "✓ State saved to '" << filename << "' (JSON format"
+                      << (codec == Compression::Codec::None ? "" : ", gzip") << ").\n";
+            std::cout << "  File size: " << std::filesystem::file_size(filename) << " bytes\n";
             
             if (activityLog) {
                 activityLog->record("State saved to file '" + filename + "'");
             }
+            return true;
             
         } catch (const std::exception& e) {
             std::cerr << "Error saving state: " << e.what() << "\n";
         }
+        return false;
+    }
+    
+    // Outro processo salvou no mesmo arquivo desde a última leitura: merge por card
+    json mergeWithDisk(const std::string& filename, const json& ours) {
+        if (filename != baseFile) {
+            return ours;
+        }
+        json disk;
+        try {
+            CompressedIFStream file(filename);
+            if (!file.is_open()) {
+                return ours;
+            }
+            file >> disk;
+            DescriptionStore::unpack(disk);
+        } catch (const std::exception&) {
+            return ours; // Arquivo ilegível (JSON ou gzip): sobrescreve
+        }
+        
+        WorkspaceMerge::Result merged =
+            WorkspaceMerge::merge(baseBoards, ours, disk.value("boards", json::array()));
+        if (merged.fromDisk == 0 && merged.conflicts.empty()) {
+            return ours;
+        }
+        
+        // Boards em memória passam a refletir o que será gravado
+        history.clear();
+        WorkspaceMerge::adopt(merged.boards, disk.value("flowMetrics", json::object()), boards,
+                              activityLog.get(), flowMetrics);
+        std::cout << "  Merged " << merged.fromDisk << " change(s) saved by another session.\n";
+        for (const auto& conflict : merged.conflicts) {
+            std::cout << "  Conflict: kept saved version of '" << conflict << "'\n";
+        }
+        return merged.boards;
     }
     
-    void loadState(const std::string& filename) {
+    bool loadState(const std::string& filename) {
         try {
-            std::ifstream file(filename);
+            // gzip detectado pelos bytes mágicos; texto puro segue sem custo extra
+            CompressedIFStream file(filename);
             if (!file.is_open()) {
                 throw std::runtime_error("Could not open file for reading: " + filename);
             }
@@ -627,15 +1585,18 @@ private:
             // Parse JSON
             json state;
             file >> state;
-            file.close();
+            Compression::Codec codec = file.codec();
+            DescriptionStore::unpack(state);
             
             // Limpa estado atual
+            history.clear();
             boards.clear();
             users.clear();
             
             // Carrega metadata
+            CardIdAllocator& idAllocator = CardIdAllocator::instance();
             if (state.contains("metadata") && state["metadata"].contains("cardIdCounter")) {
-                cardIdCounter = state["metadata"]["cardIdCounter"].get<int>();
+                idAllocator.reserveThrough(state["metadata"]["cardIdCounter"].get<std::uint64_t>());
             }
             
             // Carrega usuários primeiro (necessários para resolver assignees)
@@ -662,24 +1623,54 @@ private:
                 }
             }
             
-            // Carrega activity log
+            // Carrega activity log (spill anexado antes: excedente vai para o disco)
+            activityLog = std::make_unique<ActivityLog>();
+            attachActivityTrail(filename);
             if (state.contains("activityLog")) {
                 try {
-                    activityLog = std::make_unique<ActivityLog>(
-                        ActivityLog::fromJson(state["activityLog"])
-                    );
+                    activityLog->load(state["activityLog"]);
                 } catch (const std::exception& e) {
                     std::cerr << "Warning: Failed to load activity log: " << e.what() << "\n";
-                    activityLog = std::make_unique<ActivityLog>();
                 }
             }
             
+            // Métricas salvas antes do attach: boards sem histórico são registrados do zero
+            try {
+                flowMetrics.load(state.value("flowMetrics", json::object()));
+            } catch (const std::exception& e) {
+                std::cerr << "Warning: Failed to load flow metrics: " << e.what() << "\n";
+                flowMetrics.load(json::object());
+            }
+            
             // Re-attach activity log aos boards carregados
             for (auto& board : boards) {
                 board->attachActivityLog(activityLog.get());
+                board->attachFlowMetrics(&flowMetrics);
+            }
+            
+            // Arquivos sem cardIdCounter (ex.: salvos pela GUI antiga) ainda
+            // precisam reservar os IDs já presentes nos cards
+            std::uint64_t highestCardId = 0;
+            for (const auto& board : boards) {
+                for (const auto& column : board->getColumns()) {
+                    for (const auto& card : column.getCards()) {
+                        highestCardId = std::max(highestCardId,
+                                                 CardIdAllocator::parseCardId(card.getId()));
+                    }
+                }
+            }
+            idAllocator.reserveThrough(highestCardId);
+            // Base do merge como serializada daqui (o arquivo pode ter campos que o load descarta)
+            baseBoards = json::array();
+            for (const auto& board : boards) {
+                baseBoards.push_back(board->toJson());
             }
+            baseFile = filename;
+            baseCodec = codec;
+            attachWorkspace(filename, codec);
             
-            std::cout << "✓ State loaded from '" << filename << "' (JSON format).\n";
+            std::cout << "✓ State loaded from '" << filename << "' (JSON format"
+                      << (codec == Compression::Codec::None ? "" : ", gzip") << ").\n";
             std::cout << "  Loaded " << boards.size() << " board(s), " 
                      << users.size() << " user(s)\n";
             
@@ -695,35 +1686,39 @@ private:
             if (activityLog) {
                 activityLog->record("State loaded from file '" + filename + "'");
             }
+            return true;
             
         } catch (const json::exception& e) {
             std::cerr << "Error parsing JSON: " << e.what() << "\n";
         } catch (const std::exception& e) {
             std::cerr << "Error loading state: " << e.what() << "\n";
         }
+        return false;
     }
     
 public:
+    // Separa a linha (aspas e escapes) em views para a própria linha
+    static bool splitLine(std::string& line, std::vector<std::string_view>& args) {
+        if (!CommandLine::tokenize(line, args)) {
+            std::cerr << "Error: Unterminated quote or trailing '\\' in command line.\n";
+            return false;
+        }
+        return true;
+    }
+    
     void runInteractive() {
         std::cout << "Kanban-Lite CLI - Interactive Mode\n";
         std::cout << "Type 'help' for commands or 'exit' to quit.\n\n";
         
         std::string line;
+        std::vector<std::string_view> args; // Linha e vetor reaproveitados a cada comando
         while (true) {
             std::cout << "kanban> ";
             if (!std::getline(std::cin, line)) {
                 break; // EOF
             }
             
-            if (line.empty()) continue;
-            
-            // Parse linha em argumentos
-            std::vector<std::string> args;
-            std::istringstream iss(line);
-            std::string arg;
-            while (iss >> arg) {
-                args.push_back(arg);
-            }
+            if (!splitLine(line, args) || args.empty()) continue;
             
             if (!processCommand(args)) {
                 break; // exit command
@@ -733,17 +1728,180 @@ public:
         std::cout << "Goodbye!\n";
     }
     
-    int runCommand(int argc, char* argv[]) {
-        std::vector<std::string> args;
-        for (int i = 1; i < argc; ++i) {
-            args.push_back(argv[i]);
+    // Modo lote: uma leitura e uma gravação por execução, saída bufferizada e sem prompt
+    int runBatch(const std::string& script, const std::string& loadFile, const std::string& saveFile) {
+        std::ifstream file;
+        std::istream* input = &std::cin;
+        if (script != "-") {
+            file.open(script);
+            if (!file.is_open()) {
+                std::cerr << "Error: Could not open batch script '" << script << "'.\n";
+                return 1;
+            }
+            input = &file;
+        }
+        
+        // Sem sincronizar com stdio e sem flush de cout a cada leitura de cin
+        std::ios::sync_with_stdio(false);
+        std::cin.tie(nullptr);
+        
+        // Falha no load não pode terminar em save sobrescrevendo o arquivo
+        if (!loadFile.empty() && !loadState(loadFile)) {
+            return 1;
+        }
+        
+        size_t executed = 0;
+        std::string line;
+        std::vector<std::string_view> args;
+        while (std::getline(*input, line)) {
+            if (!splitLine(line, args) || args.empty() || args[0].substr(0, 1) == "#") {
+                continue; // Linha inválida, vazia ou comentário
+            }
+            ++executed;
+            if (!processCommand(args)) {
+                break; // exit
+            }
+        }
+        
+        bool saved = saveFile.empty() || saveState(saveFile);
+        std::cout << "Batch finished: " << executed << " command(s).\n";
+        std::cout.flush();
+        return saved ? 0 : 1;
+    }
+    
+    // Requisição do socket: argumentos separados por '\0' (preserva espaços de argv)
+    static std::string joinArgs(const std::vector<std::string_view>& args) {
+        std::string request;
+        for (size_t i = 0; i < args.size(); ++i) {
+            if (i > 0) {
+                request.push_back('\0');
+            }
+            request += args[i];
+        }
+        return request;
+    }
+    
+    static void splitArgs(const std::string& request, std::vector<std::string_view>& args) {
+        args.clear();
+        size_t start = 0;
+        while (start <= request.size() && !request.empty()) {
+            size_t end = request.find('\0', start);
+            if (end == std::string::npos) {
+                end = request.size();
+            }
+            args.emplace_back(request.data() + start, end - start);
+            start = end + 1;
+        }
+    }
+    
+    // Modo servidor: o workspace fica em memória; resposta = status, stdout, stderr
+    int serve(const std::string& path, const std::string& workspace) {
+        if (!workspace.empty() && !loadState(workspace)) {
+            return 1;
+        }
+        LocalServer server(path);
+        std::cout << "Serving on '" << path << "'. Send 'shutdown' to stop.\n" << std::flush;
+        
+        std::vector<std::string_view> args;
+        server.run([this, &args](const std::string& request, std::vector<std::string>& reply) {
+            splitArgs(request, args);
+            bool shutdown = !args.empty() && args[0] == "shutdown";
+            bool keepGoing = true;
+            std::ostringstream out;
+            std::ostringstream err;
+            if (shutdown) {
+                out << "Server stopped.\n";
+            } else {
+                OutputCapture capture(out, err);
+                try {
+                    keepGoing = processCommand(args);
+                } catch (const std::exception& e) {
+                    std::cerr << "Error: " << e.what() << "\n";
+                }
+            }
+            reply = {keepGoing ? "0" : "1", out.str(), err.str()};
+            return !shutdown;
+        });
+        
+        std::cout << "Server stopped.\n";
+        return 0;
+    }
+    
+    // Cliente: envia o comando (ou cada linha da entrada) ao servidor e imprime a resposta
+    int runClient(const std::string& path, const std::vector<std::string_view>& command) {
+        LocalSocket connection = LocalSocket::connect(path);
+        std::string status;
+        std::string out;
+        std::string err;
+        auto send = [&](const std::vector<std::string_view>& args) {
+            if (!connection.sendFrame(joinArgs(args)) || !connection.receiveFrame(status) ||
+                !connection.receiveFrame(out) || !connection.receiveFrame(err)) {
+                throw std::runtime_error("Connection to '" + path + "' closed by server");
+            }
+            std::cout << out;
+            std::cerr << err;
+            return status == "0";
+        };
+        
+        if (!command.empty()) {
+            return send(command) ? 0 : 1;
         }
+        std::string line;
+        std::vector<std::string_view> args;
+        while (std::getline(std::cin, line)) {
+            if (splitLine(line, args) && !args.empty() && !send(args)) {
+                break; // exit
+            }
+        }
+        return 0;
+    }
+    
+    int runCommand(int argc, char* argv[]) {
+        std::vector<std::string_view> args(argv + 1, argv + argc); // argv já vem separado pelo shell
         
         if (args.empty()) {
             runInteractive();
             return 0;
         }
         
+        if (args[0] == "--batch") {
+            std::string_view loadFile;
+            std::string_view saveFile;
+            bool valid = args.size() >= 2;
+            for (size_t i = 2; valid && i < args.size(); i += 2) {
+                if (i + 1 >= args.size()) {
+                    valid = false;
+                } else if (args[i] == "--load") {
+                    loadFile = args[i + 1];
+                } else if (args[i] == "--save") {
+                    saveFile = args[i + 1];
+                } else {
+                    valid = false;
+                }
+            }
+            if (!valid) {
+                std::cerr << "Usage: --batch <script|-> [--load <file>] [--save <file>]\n";
+                return 1;
+            }
+            return runBatch(std::string(args[1]), std::string(loadFile), std::string(saveFile));
+        }
+        
+        if (args[0] == "serve") {
+            if (args.size() < 3 || args.size() > 4 || args[1] != "--socket") {
+                std::cerr << "Usage: serve --socket <path> [file]\n";
+                return 1;
+            }
+            return serve(std::string(args[2]), std::string(args.size() == 4 ? args[3] : ""));
+        }
+        
+        if (args[0] == "--socket") {
+            if (args.size() < 2) {
+                std::cerr << "Usage: --socket <path> [command]\n";
+                return 1;
+            }
+            return runClient(std::string(args[1]), std::vector<std::string_view>(args.begin() + 2, args.end()));
+        }
+        
         if (!processCommand(args)) {
             return 1;
         }
@@ -752,9 +1910,6 @@ public:
     }
 };
 
-// Definição do contador estático
-int KanbanCLI::cardIdCounter = 0;
-
 int main(int argc, char* argv[]) {
     try {
         KanbanCLI cli;
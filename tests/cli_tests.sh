@@ -185,6 +185,185 @@ run_test "Complex workflow" \
     "board create Workflow\ncolumn add Workflow Backlog\ncolumn add Workflow InProgress 2\ncolumn add Workflow Done\ncard add Workflow Backlog Feature1\ncard add Workflow Backlog Feature2\ncard move card_1 Backlog InProgress Workflow\ncard list Workflow\nhistory" \
     "Feature1.*card_1"
 
+# Test 21: Two processes on the same workspace never reuse card IDs
+TESTS_RUN=$((TESTS_RUN + 1))
+echo -n "Test ${TESTS_RUN}: Card IDs unique across processes... "
+echo -e "board create IdBoard\ncolumn add IdBoard ToDo\ncard add IdBoard ToDo First\nsave ${TEST_OUTPUT_DIR}/ids.json\nexit" | ${CLI_EXECUTABLE} > /dev/null 2>&1
+first_id=$(echo -e "load ${TEST_OUTPUT_DIR}/ids.json\ncard add IdBoard ToDo Second\nexit" | ${CLI_EXECUTABLE} 2>&1 | grep -o "ID: card_[0-9]*")
+second_id=$(echo -e "load ${TEST_OUTPUT_DIR}/ids.json\ncard add IdBoard ToDo Third\nexit" | ${CLI_EXECUTABLE} 2>&1 | grep -o "ID: card_[0-9]*")
+if [ -n "${first_id}" ] && [ -n "${second_id}" ] && [ "${first_id}" != "${second_id}" ] && [ "${first_id}" != "ID: card_1" ]; then
+    echo -e "${GREEN}PASSED${NC}"
+    TESTS_PASSED=$((TESTS_PASSED + 1))
+else
+    echo -e "${RED}FAILED${NC}"
+    echo "  Expected distinct IDs, got '${first_id}' and '${second_id}'"
+fi
+
+# Test 22: Card reordering inside a column
+run_test "Card reorder" \
+    "board create R\ncolumn add R ToDo\ncard add R ToDo First\ncard add R ToDo Second\ncard reorder R ToDo card_2 card_1\ncard list R ToDo" \
+    "Card 'card_2' reordered in column 'ToDo'"
+
+# Test 23: Bulk move of a whole column
+run_test "Card bulk-move" \
+    "board create B\ncolumn add B ToDo\ncolumn add B Done\ncard add B ToDo T1\ncard add B ToDo T2\ncard bulk-move B ToDo Done\ncolumn list B" \
+    "Done (Cards: 2)"
+
+# Test 24: Batch import from JSON
+echo '[{"title": "Imported A", "column": "ToDo", "priority": 2, "tags": ["imp"]}, {"title": "Imported B"}]' > "${TEST_OUTPUT_DIR}/import.json"
+run_test "Import cards" \
+    "board create I\ncolumn add I ToDo\nimport I ${TEST_OUTPUT_DIR}/import.json ToDo\nfilter tag I imp" \
+    "Imported A (Priority: 2)"
+
+# Test 25: Undo/redo in interactive mode
+run_test "Undo and redo" \
+    "board create U\ncolumn add U ToDo\ncolumn add U Done\ncard add U ToDo Task\ncard move card_1 ToDo Done U\nundo\nredo\nundo\ncolumn list U" \
+    "ToDo (Cards: 1)"
+
+# Test 26: Paged history over the full audit trail
+run_test "History paging" \
+    "board create H\ncolumn add H ToDo\nhistory --page 1" \
+    "Activity History (page 1/1, 2 entries)"
+
+# Test 27: Recent history without copying the whole log
+run_test "History last and since" \
+    "board create H\ncolumn add H ToDo\ncolumn add H Done\nhistory --last 1\nhistory --since 2000-01-01" \
+    "3 entries since 2000-01-01"
+
+# Test 28: Point-in-time board reconstruction from the activity stream
+run_test "Board at timestamp" \
+    "board create T\ncolumn add T ToDo\ncard add T ToDo Task\nboard at T 2100-01-01" \
+    "Task (ID: card_1, Priority: 0)"
+
+# Test 29: Flow metrics maintained incrementally from board events
+run_test "Flow metrics" \
+    "board create F\ncolumn add F ToDo\ncolumn add F Done\ncard add F ToDo Task\ncard move card_1 ToDo Done F\nmetrics F" \
+    "Flow metrics for board 'F' (1 completed)"
+
+# Test 30: Dispatcher validates arity before running the handler
+run_test "Command arity" \
+    "board create P\ncard add P ToDo" \
+    "Usage: card add <board> <column> <title>"
+
+# Test 31: Typed operands are rejected with a clear message
+run_test "Typed arguments" \
+    "board create P\nfilter priority P high" \
+    "Error: Invalid priority 'high'."
+
+# Test 32: Resident workspace served over a Unix socket (state kept between clients)
+TESTS_RUN=$((TESTS_RUN + 1))
+echo -n "Test ${TESTS_RUN}: Socket server... "
+SOCKET_PATH="${TEST_OUTPUT_DIR}/kanban.sock"
+${CLI_EXECUTABLE} serve --socket "${SOCKET_PATH}" > /dev/null 2>&1 &
+SERVER_PID=$!
+for _ in $(seq 1 50); do
+    [ -S "${SOCKET_PATH}" ] && break
+    sleep 0.1
+done
+output=$( (echo -e "board create S\ncolumn add S ToDo\ncard add S ToDo Task" | ${CLI_EXECUTABLE} --socket "${SOCKET_PATH}"
+           ${CLI_EXECUTABLE} --socket "${SOCKET_PATH}" card list S
+           ${CLI_EXECUTABLE} --socket "${SOCKET_PATH}" shutdown) 2>&1 )
+# A server that did not shut down must not block the remaining tests
+for _ in $(seq 1 50); do
+    kill -0 ${SERVER_PID} 2>/dev/null || break
+    sleep 0.1
+done
+kill ${SERVER_PID} 2>/dev/null || true
+wait ${SERVER_PID} 2>/dev/null || true
+if echo "${output}" | grep -q "Task (ID: card_1, Priority: 0)" && [ ! -e "${SOCKET_PATH}" ]; then
+    echo -e "${GREEN}PASSED${NC}"
+    TESTS_PASSED=$((TESTS_PASSED + 1))
+else
+    echo -e "${RED}FAILED${NC}"
+    echo "  Expected output to contain: Task (ID: card_1, Priority: 0)"
+    echo "  Actual output:"
+    echo "${output}" | sed 's/^/    /'
+fi
+
+# Test 33: Batch script runs every line with one load/save per run
+BATCH_SCRIPT="${TEST_OUTPUT_DIR}/script.txt"
+BATCH_FILE="${TEST_OUTPUT_DIR}/batch.json"
+echo -e "# setup\nboard create B\ncolumn add B ToDo\n\ncard add B ToDo Task" > "${BATCH_SCRIPT}"
+${CLI_EXECUTABLE} --batch "${BATCH_SCRIPT}" --save "${BATCH_FILE}" > /dev/null
+run_test "Batch mode" \
+    "load ${BATCH_FILE}\ncard list B" \
+    "Task (ID: card_1, Priority: 0)"
+
+# Test 34: Streaming JSON Lines output for queries
+run_test "JSON Lines output" \
+    "board create P\ncolumn add P ToDo\ncard add P ToDo Task\ncard list P --format jsonl" \
+    '{"board":"P","column":"ToDo","id":"card_1","title":"Task","description":"","priority":0,"tags":\[\]'
+
+# Test 35: Quoted arguments keep spaces in interactive/batch input
+run_test "Quoted arguments" \
+    "board create P\ncolumn add P 'To Do'\ncard add P 'To Do' \"Write the docs\"\ncard list P 'To Do'" \
+    "Write the docs (ID: card_1, Priority: 0)"
+
+# Test 36: CSV import parsed in chunks and applied as one batch
+IMPORT_CSV="${TEST_OUTPUT_DIR}/cards.csv"
+printf 'title,status,priority,labels\n"Write, docs",ToDo,high,doc\nShip,ToDo,1,\n' > "${IMPORT_CSV}"
+run_test "CSV import" \
+    "board create I\ncolumn add I ToDo\nimport I ${IMPORT_CSV}\nfilter tag I doc" \
+    "Write, docs (Priority: 3)"
+
+# Test 37: Streaming export with field projection and filter
+run_test "CSV export" \
+    "board create E\ncolumn add E ToDo\ncard add E ToDo Task\ncard add E ToDo Other\ncard tag E card_1 bi\nexport E --format csv --fields id,title,tags tag=bi" \
+    "card_1,Task,bi"
+
+# Test 38: Compressed workspace (.gz) saved and detected on load
+GZIP_FILE="${TEST_OUTPUT_DIR}/workspace.json.gz"
+echo -e "board create Z\ncolumn add Z ToDo\ncard add Z ToDo Packed\nsave ${GZIP_FILE}\nexit" | ${CLI_EXECUTABLE} > /dev/null
+run_test "Compressed workspace" \
+    "load ${GZIP_FILE}\ncard list Z" \
+    "Packed (ID: card_1, Priority: 0)"
+
+# Test 39: Repeated descriptions survive the shared table on save/load
+TEMPLATE_CSV="${TEST_OUTPUT_DIR}/template.csv"
+TEMPLATE_FILE="${TEST_OUTPUT_DIR}/template.json"
+printf 'title,description\nA,Steps to reproduce: open the board and click\nB,Steps to reproduce: open the board and click\n' > "${TEMPLATE_CSV}"
+echo -e "board create T\ncolumn add T ToDo\nimport T ${TEMPLATE_CSV} ToDo\nsave ${TEMPLATE_FILE}\nexit" | ${CLI_EXECUTABLE} > /dev/null
+run_test "Shared descriptions" \
+    "load ${TEMPLATE_FILE}\nexport T --fields title,description column=ToDo" \
+    "B,Steps to reproduce: open the board and click"
+
+# Test 40: Archived cards leave the board but stay searchable
+ARCHIVE_FILE="${TEST_OUTPUT_DIR}/archive.json"
+run_test "Archive cards" \
+    "board create A\ncolumn add A Done\ncard add A Done Shipped\nsave ${ARCHIVE_FILE}\narchive A Done --older-than 0d\ncard list A\narchive get card_1" \
+    "Archived from 'A/Done'"
+
+# Test 41: Delta between two saved workspaces, applied back onto the first
+DIFF_FROM="${TEST_OUTPUT_DIR}/diff_from.json"
+DIFF_TO="${TEST_OUTPUT_DIR}/diff_to.json"
+DIFF_DELTA="${TEST_OUTPUT_DIR}/diff.jsonl.gz"
+echo -e "board create D\ncolumn add D ToDo\ncolumn add D Done\ncard add D ToDo First\ncard add D ToDo Second\nsave ${DIFF_FROM}\ncard move card_1 ToDo Done D\ncard remove D ToDo card_2\nsave ${DIFF_TO}\nexit" | ${CLI_EXECUTABLE} > /dev/null
+run_test "Workspace diff and patch" \
+    "diff ${DIFF_FROM} ${DIFF_TO} ${DIFF_DELTA}\nload ${DIFF_FROM}\npatch ${DIFF_DELTA}" \
+    "Applied 2 operation(s)"
+
+# Test 42: Activity history as JSON Lines keeps the typed event fields
+run_test "History JSON Lines" \
+    "board create H\ncolumn add H ToDo\ncard add H ToDo Task\nhistory --format jsonl" \
+    '"type":"card_added","board":"H","column":"ToDo","card":"card_1"'
+
+# Test 43: JSON import reserves explicit IDs before generating the missing ones
+IMPORT_JSON="${TEST_OUTPUT_DIR}/cards.json"
+echo '[{"title":"Generated"},{"id":"card_2","title":"Explicit"}]' > "${IMPORT_JSON}"
+run_test "JSON import keeps explicit IDs" \
+    "board create J\ncolumn add J ToDo\nimport J ${IMPORT_JSON} ToDo\ncard add J ToDo Later\ncard list J" \
+    "Later (ID: card_4, Priority: 0)"
+
+# Test 44: History page read from spilled segments keeps the typed fields
+SPILL_FILE="${TEST_OUTPUT_DIR}/spill.json"
+SPILL_COMMANDS="board create H\ncolumn add H ToDo\nsave ${SPILL_FILE}"
+for i in $(seq 1 1000); do
+    SPILL_COMMANDS="${SPILL_COMMANDS}\ncard add H ToDo T${i}"
+done
+run_test "History page from disk as JSON Lines" \
+    "${SPILL_COMMANDS}\nhistory --page 1 --format jsonl" \
+    '"sequence":2,"type":"column_added","board":"H","column":"ToDo"'
+
 # Cleanup
 rm -rf "${TEST_OUTPUT_DIR}"
 
@@ -0,0 +1,357 @@
+/**
+ * @file concurrency_tests.cpp
+ * @brief Testes de estresse multithread de SharedBoard/SharedWorkspace
+ * @author Anne Fernandes da Costa Oliveira
+ * @date 18/10/2026
+ */
+
+#include "Board.h"
+#include "Column.h"
+#include "Card.h"
+#include "ActivityLog.h"
+#include "BoardBatch.h"
+#include "FlowMetrics.h"
+#include "SharedBoard.h"
+#include "BoardSnapshot.h"
+#include "LocalSocket.h"
+#include <iostream>
+#include <iomanip>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Contadores de testes
+int tests_run = 0;
+int tests_passed = 0;
+
+#define TEST(name) \
+    void name(); \
+    struct name##_runner { \
+        name##_runner() { \
+            tests_run++; \
+            std::cout << "Running " #name "... "; \
+            try { \
+                name(); \
+                tests_passed++; \
+                std::cout << "PASSED\n"; \
+            } catch (const std::exception& e) { \
+                std::cout << "FAILED: " << e.what() << "\n"; \
+            } \
+        } \
+    } name##_instance; \
+    void name()
+
+namespace {
+
+const size_t CARD_COUNT = 200;
+const std::vector<std::string> COLUMNS = {"ToDo", "Doing", "Done"};
+
+Board makeBoard(const std::string& name) {
+    Board board(name, name);
+    for (const auto& column : COLUMNS) {
+        board.addColumn(Column(column, -1));
+    }
+    for (size_t i = 0; i < CARD_COUNT; ++i) {
+        Card card(name + "_" + std::to_string(i), "Card " + std::to_string(i));
+        card.setPriority(static_cast<int>(i % 5));
+        if (i % 2 == 0) {
+            card.addTag("even");
+        }
+        board.addCard("ToDo", card);
+    }
+    return board;
+}
+
+// Invariante: todo card em exatamente uma coluna, nenhum perdido ou duplicado
+bool consistent(const Board& board) {
+    std::set<std::string> ids;
+    size_t total = 0;
+    for (const auto& column : board.getColumns()) {
+        for (const auto& card : column.getCards()) {
+            ids.insert(card.getId());
+            ++total;
+        }
+    }
+    return total == CARD_COUNT && ids.size() == CARD_COUNT;
+}
+
+bool consistentSnapshot(const BoardSnapshot& snapshot) {
+    std::set<std::string> ids;
+    for (const auto& column : snapshot.getColumns()) {
+        for (const auto& card : column->getCards()) {
+            ids.insert(card->getId());
+        }
+    }
+    return snapshot.getCardCount() == CARD_COUNT && ids.size() == CARD_COUNT;
+}
+
+// Escritor: gira cards entre colunas até stop
+void churn(SharedBoard& board, const std::atomic<bool>& stop, size_t seed) {
+    size_t step = seed;
+    while (!stop.load(std::memory_order_relaxed)) {
+        std::string id = board.getName() + "_" + std::to_string(step % CARD_COUNT);
+        // Outro escritor pode mover o card antes: moveCard apenas falha
+        BoardSnapshot current = board.snapshot();
+        for (size_t c = 0; c < COLUMNS.size(); ++c) {
+            if (current.findColumn(COLUMNS[c])->findCard(id)) {
+                board.moveCard(id, COLUMNS[c], COLUMNS[(c + 1) % COLUMNS.size()], step % 7);
+                break;
+            }
+        }
+        board.tagCard(id, "touched", step % 3 != 0);
+        step += 7;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// TESTES DE SHARED BOARD
+// ============================================================================
+
+TEST(test_shared_board_readers_see_consistent_state) {
+    ActivityLog log;
+    log.startConcurrent();
+    FlowMetrics metrics;
+    SharedBoard board(makeBoard("stress"));
+    board.write([&](Board& b) {
+        b.attachActivityLog(&log);
+        b.attachFlowMetrics(&metrics);
+        return true;
+    });
+
+    std::atomic<bool> stop { false };
+    std::atomic<size_t> violations { 0 };
+    std::vector<std::thread> threads;
+    threads.emplace_back(churn, std::ref(board), std::cref(stop), 1);
+    threads.emplace_back(churn, std::ref(board), std::cref(stop), 2);
+    for (int r = 0; r < 4; ++r) {
+        threads.emplace_back([&] {
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (!board.read(consistent) || !consistentSnapshot(board.snapshot()) ||
+                    board.findCardsByTag("even").size() != CARD_COUNT / 2) {
+                    ++violations;
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    log.stopConcurrent();
+
+    assert(violations == 0);
+    assert(board.read(consistent));
+    FlowMetrics::Report report = metrics.report(board.copy());
+    size_t inFlow = 0;
+    for (size_t count : report.cfd.back()) {
+        inFlow += count;
+    }
+    assert(inFlow == CARD_COUNT);
+}
+
+TEST(test_shared_workspace_boards_do_not_contend) {
+    ActivityLog log;
+    log.startConcurrent();
+    SharedWorkspace workspace;
+    for (const char* name : {"alpha", "beta", "gamma", "delta"}) {
+        auto board = workspace.add(makeBoard(name));
+        assert(board);
+        board->write([&](Board& b) {
+            b.attachActivityLog(&log);
+            return true;
+        });
+    }
+    assert(!workspace.add(makeBoard("alpha")));
+
+    // Um escritor por board; remoção concorrente não invalida quem já tem o board
+    std::atomic<bool> stop { false };
+    std::vector<std::thread> writers;
+    for (const auto& name : workspace.names()) {
+        writers.emplace_back([&workspace, &stop, name] {
+            auto board = workspace.find(name);
+            churn(*board, stop, name.size());
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    assert(workspace.remove("delta"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    stop = true;
+    for (auto& thread : writers) {
+        thread.join();
+    }
+    log.stopConcurrent();
+
+    assert(workspace.size() == 3);
+    assert(!workspace.find("delta"));
+    for (const auto& name : workspace.names()) {
+        assert(workspace.find(name)->read(consistent));
+    }
+}
+
+TEST(test_shared_board_read_throughput) {
+    SharedBoard board(makeBoard("bench"));
+    unsigned hardware = std::max(2u, std::thread::hardware_concurrency());
+
+    // Leituras por segundo com 1 escritor ativo, dobrando os leitores
+    std::cout << "\n";
+    for (unsigned readers = 1; readers <= hardware; readers *= 2) {
+        std::atomic<bool> stop { false };
+        std::atomic<size_t> reads { 0 };
+        std::vector<std::thread> threads;
+        threads.emplace_back(churn, std::ref(board), std::cref(stop), 3);
+        for (unsigned r = 0; r < readers; ++r) {
+            threads.emplace_back([&] {
+                size_t local = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    local += board.filterByPriority(3).empty() ? 0 : 1;
+                }
+                reads += local;
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        stop = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        std::cout << "  " << std::setw(2) << readers << " reader(s): "
+                  << reads.load() * 10 << " reads/s\n";
+        assert(reads > 0);
+    }
+    assert(board.read(consistent));
+}
+
+TEST(test_snapshot_shares_unchanged_structure) {
+    SharedBoard board(makeBoard("cow"));
+    BoardSnapshot before = board.snapshot();
+    BoardSnapshot copy = before; // O(1): mesma versão
+    assert(&copy.getColumns() == &before.getColumns());
+
+    assert(board.moveCard("cow_0", "ToDo", "Doing"));
+    BoardSnapshot after = board.snapshot();
+
+    // Versão antiga intacta para quem ainda a segura
+    assert(before.findColumn("ToDo")->findCard("cow_0"));
+    assert(!before.findColumn("Doing")->findCard("cow_0"));
+    assert(after.findColumn("Doing")->findCard("cow_0"));
+
+    // Coluna não tocada compartilhada; nas tocadas, só o card movido é novo
+    assert(before.getColumns()[2] == after.getColumns()[2]);
+    assert(before.getColumns()[0] != after.getColumns()[0]);
+    assert(before.getColumns()[0]->getCards()[1] == after.getColumns()[0]->getCards()[0]);
+    assert(before.findCard("cow_0") != after.findCard("cow_0"));
+
+    assert(board.tagCard("cow_1", "hot", true));
+    BoardSnapshot tagged = board.snapshot();
+    assert(tagged.getColumns()[1] == after.getColumns()[1]);
+    assert(tagged.findCard("cow_1")->hasTag("hot") && !after.findCard("cow_1")->hasTag("hot"));
+    assert(tagged.findCard("cow_2") == after.findCard("cow_2"));
+
+    // write() genérico republica tudo; conteúdo equivalente ao board vivo
+    board.write([](Board& b) { return b.addColumn(Column("Review", -1), 2); });
+    assert(board.snapshot().toJson() == board.read([](const Board& b) { return b.toJson(); }));
+    assert(board.snapshot().toBoard().toJson() == board.toJson());
+}
+
+TEST(test_snapshot_recopies_renumbered_column) {
+    SharedBoard board(makeBoard("renum"));
+
+    // Ordem alterada direto no vetor (sem chaves novas): próxima inserção renumera
+    board.write([](Board& b) {
+        auto& cards = b.findColumn("ToDo")->getCards();
+        std::swap(cards[0], cards[1]);
+        return true;
+    });
+    BoardSnapshot before = board.snapshot();
+
+    assert(board.addCard("ToDo", Card("renum_new", "Inserted"), 1));
+    BoardSnapshot after = board.snapshot();
+
+    assert(after.toJson() == board.read([](const Board& b) { return b.toJson(); }));
+    assert(before.findCard("renum_5") != after.findCard("renum_5"));
+    assert(before.findCard("renum_5")->getRank() != after.findCard("renum_5")->getRank());
+}
+
+// ============================================================================
+// TESTES DE LOCAL SERVER
+// ============================================================================
+
+#ifndef _WIN32
+TEST(test_local_server_not_blocked_by_partial_frame_or_slow_reader) {
+    const std::string path = "/tmp/kanban_server_test_" + std::to_string(::getpid()) + ".sock";
+    LocalServer server(path);
+    std::thread serving([&server] {
+        server.run([](const std::string& request, std::vector<std::string>& reply) {
+            // "big" responde mais do que o buffer do socket comporta
+            reply.push_back(request == "big" ? std::string(8u * 1024u * 1024u, 'x') : "echo:" + request);
+            return request != "stop";
+        });
+    });
+
+    // Cliente que manda metade de um cabeçalho e para
+    int partial = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::snprintf(address.sun_path, sizeof(address.sun_path), "%s", path.c_str());
+    assert(::connect(partial, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+    assert(::send(partial, "\0\0", 2, 0) == 2);
+
+    // Cliente que pede uma resposta grande e não lê
+    LocalSocket slow = LocalSocket::connect(path);
+    assert(slow.sendFrame("big"));
+
+    LocalSocket client = LocalSocket::connect(path);
+    std::string reply;
+    for (int i = 0; i < 3; ++i) {
+        assert(client.sendFrame("ping" + std::to_string(i)));
+        assert(client.receiveFrame(reply));
+        assert(reply == "echo:ping" + std::to_string(i));
+    }
+
+    // A resposta pendente chega inteira quando o cliente lento lê
+    assert(slow.receiveFrame(reply));
+    assert(reply.size() == 8u * 1024u * 1024u);
+
+    assert(client.sendFrame("stop"));
+    assert(client.receiveFrame(reply) && reply == "echo:stop");
+    serving.join();
+    ::close(partial);
+}
+#endif
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main() {
+    std::cout << "\n=== KANBAN-LITE CONCURRENCY TESTS ===\n\n";
+
+    // Testes são executados automaticamente via construtores estáticos
+
+    std::cout << "\n=== RESULTS ===\n";
+    std::cout << "Tests run: " << tests_run << "\n";
+    std::cout << "Tests passed: " << tests_passed << "\n";
+    std::cout << "Tests failed: " << (tests_run - tests_passed) << "\n";
+
+    if (tests_passed == tests_run) {
+        std::cout << "\n✓ ALL TESTS PASSED\n";
+        return 0;
+    } else {
+        std::cout << "\n✗ SOME TESTS FAILED\n";
+        return 1;
+    }
+}
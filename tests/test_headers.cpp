@@ -7,6 +7,27 @@
 #include "Card.h"
 #include "User.h"
 #include "ActivityLog.h"
+#include "CardIdAllocator.h"
+#include "RankKey.h"
+#include "BoardBatch.h"
+#include "Command.h"
+#include "CommandHistory.h"
+#include "BoardReplay.h"
+#include "FlowMetrics.h"
+#include "BoardSnapshot.h"
+#include "SharedBoard.h"
+#include "WorkspaceMerge.h"
+#include "LocalSocket.h"
+#include "CommandDispatcher.h"
+#include "CommandLine.h"
+#include "CardImporter.h"
+#include "JsonLinesWriter.h"
+#include "CsvWriter.h"
+#include "CardExporter.h"
+#include "Compression.h"
+#include "DescriptionStore.h"
+#include "CardArchive.h"
+#include "WorkspaceDiff.h"
 
 int main() {
     return 0; // Sucesso se compilar e linkar.
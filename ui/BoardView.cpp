@@ -3,15 +3,18 @@
 #include "../include/Board.h"
 #include "../include/Column.h"
 #include "../include/Card.h"
+#include "../include/Command.h"
+#include "../include/CommandHistory.h"
 #include <QInputDialog>
 #include <QMessageBox>
 #include <QLineEdit>
 #include <QFrame>
 #include <QTimer>
 
-BoardView::BoardView(Board *board, QWidget *parent)
+BoardView::BoardView(Board *board, CommandHistory *history, QWidget *parent)
     : QWidget(parent)
     , m_board(board)
+    , m_history(history)
     , m_mainLayout(nullptr)
     , m_titleLabel(nullptr)
     , m_scrollArea(nullptr)
@@ -105,7 +108,7 @@ void BoardView::refreshColumns() {
     // Cria view para cada coluna usando índices para maior segurança
     auto& columns = m_board->getColumns();
     for (size_t i = 0; i < columns.size(); ++i) {
-        ColumnView *columnView = new ColumnView(&columns[i], this);
+        ColumnView *columnView = new ColumnView(&columns[i], m_board, m_history, this);
         connect(columnView, &ColumnView::modified, this, &BoardView::onColumnModified);
         m_columnLayout->addWidget(columnView);
         m_columnViews.push_back(columnView);
@@ -136,10 +139,11 @@ void BoardView::onAddColumn() {
     }
     
     try {
-        // Cria coluna
-        Column column(name.toStdString(), wipLimit);
+        // Cria coluna (via histórico para permitir desfazer)
+        auto command = std::make_unique<AddColumnCommand>(Column(name.toStdString(), wipLimit));
+        bool added = CommandHistory::apply(m_history, *m_board, std::move(command));
         
-        if (m_board->addColumn(column)) {
+        if (added) {
             // IMPORTANTE: Usar QTimer para fazer refresh após event loop processar
             QTimer::singleShot(0, this, [this, name]() {
                 refreshColumns();
@@ -11,6 +11,7 @@
 #include "../include/Board.h"
 
 class ColumnView;
+class CommandHistory;
 
 /**
  * @class BoardView
@@ -25,7 +26,7 @@ class BoardView : public QWidget {
     Q_OBJECT
 
 public:
-    explicit BoardView(Board *board, QWidget *parent = nullptr);
+    BoardView(Board *board, CommandHistory *history, QWidget *parent = nullptr);
     ~BoardView() override = default;
     
     Board* getBoard() const { return m_board; }
@@ -42,6 +43,7 @@ private:
     void refreshColumns();
     
     Board *m_board; // Não owned (gerenciado por MainWindow)
+    CommandHistory *m_history; // Não owned (gerenciado por MainWindow)
     
     // Widgets
     QVBoxLayout *m_mainLayout;
@@ -1,12 +1,16 @@
 #include "CardEditDialog.h"
 #include "../include/Card.h"
+#include "../include/Command.h"
+#include "../include/CommandHistory.h"
 #include <QMessageBox>
 #include <QHBoxLayout>
 #include <QGroupBox>
 
-CardEditDialog::CardEditDialog(Card *card, QWidget *parent)
+CardEditDialog::CardEditDialog(Card *card, Board *board, CommandHistory *history, QWidget *parent)
     : QDialog(parent)
     , m_card(card)
+    , m_board(board)
+    , m_history(history)
 {
     setWindowTitle("Editar Card");
     setMinimumWidth(500);
@@ -126,7 +130,8 @@ void CardEditDialog::onAddTag() {
         return;
     }
     
-    m_card->addTag(tag.toStdString());
+    CommandHistory::apply(m_history, *m_board,
+                          std::make_unique<TagCardCommand>(m_card->getId(), tag.toStdString(), true));
     m_tagInput->clear();
     updateTagsList();
 }
@@ -134,7 +139,8 @@ void CardEditDialog::onAddTag() {
 void CardEditDialog::onRemoveTag() {
     auto tags = m_card->getTags();
     if (!tags.empty()) {
-        m_card->removeTag(tags.back());
+        CommandHistory::apply(m_history, *m_board,
+                              std::make_unique<TagCardCommand>(m_card->getId(), tags.back(), false));
         updateTagsList();
     }
 }
@@ -147,9 +153,24 @@ void CardEditDialog::onSave() {
         return;
     }
     
-    m_card->setTitle(title.toStdString());
-    m_card->setDescription(m_descriptionEdit->toPlainText().toStdString());
-    m_card->setPriority(m_prioritySpinBox->value());
+    // Apenas campos alterados entram no comando (inversa mínima)
+    std::optional<std::string> newTitle;
+    std::optional<std::string> newDescription;
+    std::optional<int> newPriority;
+    if (title.toStdString() != m_card->getTitle()) {
+        newTitle = title.toStdString();
+    }
+    if (m_descriptionEdit->toPlainText().toStdString() != m_card->getDescription()) {
+        newDescription = m_descriptionEdit->toPlainText().toStdString();
+    }
+    if (m_prioritySpinBox->value() != m_card->getPriority()) {
+        newPriority = m_prioritySpinBox->value();
+    }
+    if (newTitle || newDescription || newPriority) {
+        CommandHistory::apply(m_history, *m_board,
+                              std::make_unique<EditCardCommand>(m_card->getId(), std::move(newTitle),
+                                                                std::move(newDescription), newPriority));
+    }
     
     emit cardModified();
     accept();
@@ -9,8 +9,11 @@
 #include <QVBoxLayout>
 #include <QFormLayout>
 #include <QLabel>
+#include <memory>
 
 class Card;
+class Board;
+class CommandHistory;
 
 /**
  * @brief Diálogo para editar propriedades de um Card
@@ -21,7 +24,7 @@ class CardEditDialog : public QDialog {
     Q_OBJECT
     
 public:
-    explicit CardEditDialog(Card *card, QWidget *parent = nullptr);
+    CardEditDialog(Card *card, Board *board, CommandHistory *history, QWidget *parent = nullptr);
     
 signals:
     void cardModified();
@@ -37,6 +40,8 @@ private:
     void updateTagsList();
     
     Card *m_card;
+    Board *m_board; // Não owned (board que contém o card)
+    CommandHistory *m_history; // Não owned (nullptr = sem desfazer)
     QLineEdit *m_titleEdit;
     QTextEdit *m_descriptionEdit;
     QSpinBox *m_prioritySpinBox;
@@ -2,6 +2,9 @@
 #include "CardView.h"
 #include "CardEditDialog.h"
 #include "../include/Card.h"
+#include "../include/CardIdAllocator.h"
+#include "../include/Command.h"
+#include "../include/CommandHistory.h"
 #include <QInputDialog>
 #include <QMessageBox>
 #include <QDrag>
@@ -13,9 +16,11 @@
 #include <QDebug>
 #include <QTimer>
 
-ColumnView::ColumnView(Column *column, QWidget *parent)
+ColumnView::ColumnView(Column *column, Board *board, CommandHistory *history, QWidget *parent)
     : QWidget(parent)
     , m_column(column)
+    , m_board(board)
+    , m_history(history)
     , m_mainLayout(nullptr)
     , m_headerLabel(nullptr)
     , m_addCardButton(nullptr)
@@ -190,13 +195,12 @@ void ColumnView::onAddCard() {
         return;
     }
     
-    // Cria card com ID único
-    static int cardCounter = 1;
-    std::string cardId = "card_" + std::to_string(cardCounter++);
+    // Cria card com ID único (compartilhado com a CLI via lease do workspace)
+    std::string cardId = CardIdAllocator::instance().nextCardId();
     
     Card card(cardId, title.toStdString());
     
-    if (m_column->addCard(card)) {
+    if (CommandHistory::apply(m_history, *m_board, std::make_unique<AddCardCommand>(m_column->getName(), card))) {
         refreshCards();
         emit modified();
     } else {
@@ -218,7 +222,7 @@ void ColumnView::onCardDoubleClicked() {
     }
     
     // Abre diálogo de edição
-    CardEditDialog dialog(cardView->getCard(), this);
+    CardEditDialog dialog(cardView->getCard(), m_board, m_history, this);
     connect(&dialog, &CardEditDialog::cardModified, this, [this, cardView]() {
         cardView->updateDisplay();  // Atualiza a visualização
         emit modified();
@@ -282,36 +286,48 @@ void ColumnView::dropEvent(QDropEvent *event) {
                 return;
             }
             
+            // MoveCardCommand só atua dentro de um board; mover entre boards
+            // seria remover + adicionar, desfeitos em passos separados
+            if (sourceColumn->m_board != m_board) {
+                highlightDropZone(false);
+                event->ignore();
+                // Aviso adiado para o drag->exec() terminar antes do diálogo modal
+                QTimer::singleShot(0, this, [this]() {
+                    QMessageBox::warning(this, "Movimento Não Suportado",
+                                       "Não é possível mover cards entre boards diferentes.");
+                });
+                return;
+            }
+            
             qDebug() << "Movendo card de" << QString::fromStdString(sourceColumn->getColumn()->getName()) 
                      << "para" << QString::fromStdString(m_column->getName());
             
-            // IMPORTANTE: Fazer CÓPIA do card antes de remover!
-            // O ponteiro 'card' fica inválido após removeCard()
+            // IMPORTANTE: copiar o ID antes de mover!
+            // O ponteiro 'card' fica inválido após a movimentação
             std::string cardId = card->getId();
-            Card cardCopy = *card; // Cópia completa antes de remover
             
-            // Move o card entre colunas
-            if (sourceColumn->getColumn()->removeCard(cardId)) {
-                if (m_column->addCard(cardCopy)) {
-                    qDebug() << "Card movido com sucesso!";
-                    event->acceptProposedAction();
-                    emit modified();
-                    
-                    // CRÍTICO: Usar QTimer para adiar refreshCards()
-                    // Isso permite que o drag->exec() termine ANTES de deletar os widgets
-                    QTimer::singleShot(0, sourceColumn, [sourceColumn]() {
-                        sourceColumn->refreshCards();
-                    });
-                    QTimer::singleShot(0, this, [this]() {
-                        this->refreshCards();
-                    });
-                } else {
-                    qDebug() << "Falha ao adicionar card na coluna destino";
-                    // Falha ao adicionar - retorna para coluna original
-                    sourceColumn->getColumn()->addCard(cardCopy);
-                }
+            // Move via Board (WIP verificado lá) para permitir desfazer
+            if (CommandHistory::apply(m_history, *m_board,
+                                      std::make_unique<MoveCardCommand>(cardId, sourceColumn->getColumn()->getName(),
+                                                                        m_column->getName()))) {
+                qDebug() << "Card movido com sucesso!";
+                event->acceptProposedAction();
+                emit modified();
+                
+                // CRÍTICO: Usar QTimer para adiar refreshCards()
+                // Isso permite que o drag->exec() termine ANTES de deletar os widgets
+                QTimer::singleShot(0, sourceColumn, [sourceColumn]() {
+                    sourceColumn->refreshCards();
+                });
+                QTimer::singleShot(0, this, [this]() {
+                    this->refreshCards();
+                });
             } else {
-                qDebug() << "Falha ao remover card da coluna origem";
+                qDebug() << "Falha ao mover card para a coluna destino";
+                QTimer::singleShot(0, this, [this]() {
+                    QMessageBox::warning(this, "Erro",
+                                       "Não foi possível mover o card.");
+                });
             }
         }
         
@@ -6,10 +6,13 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QScrollArea>
+#include <memory>
 #include <vector>
 #include "../include/Column.h"
 
 class CardView;
+class Board;
+class CommandHistory;
 
 /**
  * @class ColumnView
@@ -28,7 +31,7 @@ class ColumnView : public QWidget {
     Q_OBJECT
 
 public:
-    explicit ColumnView(Column *column, QWidget *parent = nullptr);
+    ColumnView(Column *column, Board *board, CommandHistory *history, QWidget *parent = nullptr);
     ~ColumnView() override = default;
     
     Column* getColumn() const { return m_column; }
@@ -55,6 +58,8 @@ private:
     void highlightDropZone(bool highlight);
     
     Column *m_column; // Não owned
+    Board *m_board; // Não owned (dono da coluna)
+    CommandHistory *m_history; // Não owned (nullptr = sem desfazer)
     
     // Widgets
     QVBoxLayout *m_mainLayout;
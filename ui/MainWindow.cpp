@@ -5,6 +5,12 @@
 #include "../include/Card.h"
 #include "../include/User.h"
 #include "../include/ActivityLog.h"
+#include "../include/CardIdAllocator.h"
+#include "../include/CommandHistory.h"
+#include "../include/BoardReplay.h"
+#include "../include/WorkspaceMerge.h"
+#include "../include/Compression.h"
+#include "../include/DescriptionStore.h"
 #include <QMenuBar>
 #include <QMenu>
 #include <QAction>
@@ -21,6 +27,8 @@
 #include <QDebug>
 #include <QCoreApplication>
 #include <fstream>
+#include <iomanip>
+#include <algorithm>
 
 using json = nlohmann::json;
 
@@ -33,6 +41,7 @@ MainWindow::MainWindow(QWidget *parent)
     , m_boardLayout(nullptr)
     , m_statusLabel(nullptr)
     , m_fileMenu(nullptr)
+    , m_editMenu(nullptr)
     , m_helpMenu(nullptr)
     , m_modified(false)
     , m_currentFile("")
@@ -160,6 +169,21 @@ void MainWindow::createMenus() {
     connect(m_exitAction, &QAction::triggered, this, &MainWindow::onExit);
     m_fileMenu->addAction(m_exitAction);
     
+    // Menu Editar
+    m_editMenu = menuBar()->addMenu("&Editar");
+    
+    m_undoAction = new QAction("&Desfazer", this);
+    m_undoAction->setShortcut(QKeySequence::Undo);
+    connect(m_undoAction, &QAction::triggered, this, &MainWindow::onUndo);
+    m_editMenu->addAction(m_undoAction);
+    
+    m_redoAction = new QAction("&Refazer", this);
+    m_redoAction->setShortcut(QKeySequence::Redo);
+    connect(m_redoAction, &QAction::triggered, this, &MainWindow::onRedo);
+    m_editMenu->addAction(m_redoAction);
+    
+    updateUndoActions();
+    
     // Menu Ajuda
     m_helpMenu = menuBar()->addMenu("A&juda");
     
@@ -268,7 +292,7 @@ void MainWindow::refreshBoardView() {
     
     // Cria views para cada board
     for (auto& board : m_boards) {
-        BoardView *boardView = new BoardView(board.get(), this);
+        BoardView *boardView = new BoardView(board.get(), &m_commandHistory, this);
         connect(boardView, &BoardView::modified, this, &MainWindow::onBoardModified);
         
         // Se há apenas 1 board, ele deve ocupar TODO o espaço (stretch = 1)
@@ -293,6 +317,8 @@ void MainWindow::onNewBoard() {
     if (ok && !name.isEmpty()) {
         auto board = std::make_unique<Board>(name.toStdString(), name.toStdString());
         board->attachActivityLog(m_activityLog.get());
+        board->attachFlowMetrics(&m_flowMetrics);
+        board->checkpoint();
         m_boards.push_back(std::move(board));
         
         refreshBoardView();
@@ -308,8 +334,13 @@ void MainWindow::onSaveState() {
         // Serializa boards
         json boardsArray = json::array();
         for (const auto& board : m_boards) {
+            // Checkpoint periódico limita o replay (BoardReplay::at)
+            if (m_activityLog->eventsSinceCheckpoint(board->getName()) >= BoardReplay::CHECKPOINT_INTERVAL) {
+                board->checkpoint();
+            }
             boardsArray.push_back(board->toJson());
         }
+        boardsArray = mergeWithDisk(boardsArray);
         state["boards"] = boardsArray;
         
         // Serializa users
@@ -323,12 +354,15 @@ void MainWindow::onSaveState() {
         if (m_activityLog) {
             state["activityLog"] = m_activityLog->toJson();
         }
+        state["flowMetrics"] = m_flowMetrics.toJson();
         
         // Metadata
         state["metadata"] = {
             {"version", "1.0"},
-            {"appVersion", "GUI-v4"}
+            {"appVersion", "GUI-v4"},
+            {"cardIdCounter", CardIdAllocator::instance().highestIssued()}
         };
+        DescriptionStore::pack(state); // Descrições repetidas gravadas uma vez
         
         // Cria diretório se não existir
         QFileInfo fileInfo(m_currentFile);
@@ -340,17 +374,36 @@ void MainWindow::onSaveState() {
             }
         }
         
-        // Salva arquivo
-        std::ofstream file(m_currentFile.toStdString());
+        // Salva arquivo (gzip pela extensão ou se o arquivo já era comprimido)
+        const std::string path = m_currentFile.toStdString();
+        Compression::Codec codec = Compression::forFilename(path);
+        if (Compression::detect(path) == Compression::Codec::Gzip) {
+            codec = Compression::Codec::Gzip;
+        }
+        CompressedOFStream file(path, codec);
         if (!file.is_open()) {
-            throw std::runtime_error("Não foi possível abrir arquivo para escrita: " + m_currentFile.toStdString());
+            throw std::runtime_error("Não foi possível abrir arquivo para escrita: " + path);
         }
         
-        file << state.dump(2);
+        file << std::setw(2) << state;
         file.close();
+        if (!file) {
+            throw std::runtime_error("Falha ao gravar arquivo: " + path);
+        }
+        m_baseBoards = boardsArray;
+        
+        // IDs passam a ser arrendados do workspace (evita colisão com a CLI)
+        CardIdAllocator::instance().attachLeaseFile(path + ".ids");
+        bool trailAttached = m_activityLog->attachSpillDirectory(path + ".log.d");
+        m_activityLog->setSegmentCodec(codec);
+        m_activityLog->flush();
         
         m_modified = false;
         m_statusLabel->setText(QString("✓ Estado salvo em '%1'").arg(m_currentFile));
+        if (!trailAttached) {
+            // Outra sessão detém "<arquivo>.log.d": histórico antigo desta fica só em memória
+            m_statusLabel->setText(m_statusLabel->text() + " (histórico em uso por outra sessão)");
+        }
         
         if (m_activityLog) {
             m_activityLog->record("Estado salvo via GUI");
@@ -367,18 +420,57 @@ void MainWindow::onSaveState() {
     }
 }
 
+json MainWindow::mergeWithDisk(const json& boards) {
+    // Sem leitura anterior não há base: o arquivo é sobrescrito
+    CompressedIFStream file(m_currentFile.toStdString());
+    if (m_baseBoards.is_null() || !file.is_open()) {
+        return boards;
+    }
+    json disk;
+    try {
+        file >> disk;
+        DescriptionStore::unpack(disk);
+    } catch (const std::exception&) {
+        return boards;
+    }
+    
+    WorkspaceMerge::Result merged = WorkspaceMerge::merge(m_baseBoards, boards, disk.value("boards", json::array()));
+    if (merged.fromDisk == 0 && merged.conflicts.empty()) {
+        return boards;
+    }
+    
+    // Alterações de outra sessão entram nos boards abertos
+    m_commandHistory.clear();
+    WorkspaceMerge::adopt(merged.boards, disk.value("flowMetrics", json::object()), m_boards,
+                          m_activityLog.get(), m_flowMetrics);
+    refreshBoardView();
+    updateUndoActions();
+    
+    if (!merged.conflicts.empty()) {
+        QStringList conflicts;
+        for (const auto& conflict : merged.conflicts) {
+            conflicts << QString::fromStdString(conflict);
+        }
+        QMessageBox::warning(this, "Conflitos ao Salvar",
+                             QString("Outra sessão alterou os mesmos cards; a versão salva foi mantida:\n\n%1")
+                             .arg(conflicts.join("\n")));
+    }
+    return merged.boards;
+}
+
 void MainWindow::onLoadState() {
     try {
-        std::ifstream file(m_currentFile.toStdString());
+        CompressedIFStream file(m_currentFile.toStdString());
         if (!file.is_open()) {
             throw std::runtime_error("Arquivo não encontrado");
         }
         
         json state;
         file >> state;
-        file.close();
+        DescriptionStore::unpack(state);
         
-        // Limpa estado atual
+        // Limpa estado atual (histórico aponta para os boards antigos)
+        m_commandHistory.clear();
         m_boards.clear();
         m_users.clear();
         
@@ -398,18 +490,54 @@ void MainWindow::onLoadState() {
             }
         }
         
-        // Carrega activity log
+        // Carrega activity log (entradas além da capacidade vão para o disco)
+        bool trailAttached = true;
         if (state.contains("activityLog")) {
-            m_activityLog = std::make_unique<ActivityLog>(
-                ActivityLog::fromJson(state["activityLog"])
-            );
+            m_activityLog = std::make_unique<ActivityLog>();
+            trailAttached = m_activityLog->attachSpillDirectory(m_currentFile.toStdString() + ".log.d");
+            m_activityLog->setSegmentCodec(file.codec());
+            m_activityLog->load(state["activityLog"]);
+            for (auto& board : m_boards) {
+                board->attachActivityLog(m_activityLog.get());
+            }
+        }
+        
+        // Métricas de fluxo: boards ausentes do arquivo são registrados no attach
+        m_flowMetrics.load(state.value("flowMetrics", json::object()));
+        for (auto& board : m_boards) {
+            board->attachFlowMetrics(&m_flowMetrics);
+        }
+        
+        // Reserva IDs já usados e passa a arrendar do workspace
+        CardIdAllocator& idAllocator = CardIdAllocator::instance();
+        if (state.contains("metadata") && state["metadata"].contains("cardIdCounter")) {
+            idAllocator.reserveThrough(state["metadata"]["cardIdCounter"].get<std::uint64_t>());
+        }
+        std::uint64_t highestCardId = 0;
+        for (const auto& board : m_boards) {
+            for (const auto& column : board->getColumns()) {
+                for (const auto& card : column.getCards()) {
+                    highestCardId = std::max(highestCardId,
+                                             CardIdAllocator::parseCardId(card.getId()));
+                }
+            }
+        }
+        idAllocator.reserveThrough(highestCardId);
+        idAllocator.attachLeaseFile(m_currentFile.toStdString() + ".ids");
+        m_baseBoards = json::array();
+        for (const auto& board : m_boards) {
+            m_baseBoards.push_back(board->toJson());
         }
         
         // Atualiza UI
         refreshBoardView();
+        updateUndoActions();
         
         m_modified = false;
         m_statusLabel->setText(QString("✓ Carregado %1 board(s)").arg(m_boards.size()));
+        if (!trailAttached) {
+            m_statusLabel->setText(m_statusLabel->text() + " (histórico em uso por outra sessão)");
+        }
         
         QMessageBox::information(this, "Carregar",
                                QString("Estado carregado com sucesso!\n\nBoards: %1\nUsuários: %2")
@@ -444,9 +572,47 @@ void MainWindow::onAbout() {
     );
 }
 
+void MainWindow::onUndo() {
+    std::string description = m_commandHistory.undoDescription();
+    if (description.empty()) {
+        return;
+    }
+    
+    if (m_commandHistory.undo()) {
+        m_statusLabel->setText(QString("Desfeito: %1").arg(QString::fromStdString(description)));
+    } else {
+        m_statusLabel->setText("Não foi possível desfazer (histórico descartado)");
+    }
+    m_modified = true;
+    refreshBoardView();
+    updateUndoActions();
+}
+
+void MainWindow::onRedo() {
+    std::string description = m_commandHistory.redoDescription();
+    if (description.empty()) {
+        return;
+    }
+    
+    if (m_commandHistory.redo()) {
+        m_statusLabel->setText(QString("Refeito: %1").arg(QString::fromStdString(description)));
+    } else {
+        m_statusLabel->setText("Não foi possível refazer (histórico descartado)");
+    }
+    m_modified = true;
+    refreshBoardView();
+    updateUndoActions();
+}
+
+void MainWindow::updateUndoActions() {
+    m_undoAction->setEnabled(m_commandHistory.canUndo());
+    m_redoAction->setEnabled(m_commandHistory.canRedo());
+}
+
 void MainWindow::onBoardModified() {
     m_modified = true;
     m_statusLabel->setText("Modificado (não salvo)");
+    updateUndoActions();
 }
 
 void MainWindow::onFilterChanged(const QString &text) {
@@ -16,6 +16,8 @@
 #include "../include/Board.h"
 #include "../include/User.h"
 #include "../include/ActivityLog.h"
+#include "../include/FlowMetrics.h"
+#include "../include/CommandHistory.h"
 
 class BoardView;
 
@@ -49,6 +51,10 @@ private slots:
     void onLoadState();
     void onExit();
     
+    // Menu Editar
+    void onUndo();
+    void onRedo();
+    
     // Menu Ajuda
     void onAbout();
     
@@ -64,6 +70,8 @@ private:
     void createMenus();
     void loadDefaultState();
     void refreshBoardView();
+    void updateUndoActions();
+    nlohmann::json mergeWithDisk(const nlohmann::json& boards);
     
     // Widgets principais
     QWidget *m_centralWidget;
@@ -78,17 +86,23 @@ private:
     
     // Menus e ações
     QMenu *m_fileMenu;
+    QMenu *m_editMenu;
     QMenu *m_helpMenu;
     QAction *m_newBoardAction;
     QAction *m_saveAction;
     QAction *m_loadAction;
     QAction *m_exitAction;
+    QAction *m_undoAction;
+    QAction *m_redoAction;
     QAction *m_aboutAction;
     
     // Dados do backend
     std::vector<std::unique_ptr<Board>> m_boards;
     std::vector<std::unique_ptr<User>> m_users;
     std::unique_ptr<ActivityLog> m_activityLog;
+    FlowMetrics m_flowMetrics; // Mesmo estado da CLI: preservado ao salvar pela GUI
+    CommandHistory m_commandHistory; // Desfazer/refazer (deltas, nunca cópias do board)
+    nlohmann::json m_baseBoards; // Boards como lidos/gravados por último (base do merge ao salvar)
     
     // Views
     std::vector<BoardView*> m_boardViews;